@@ -0,0 +1,30 @@
+/**
+ * @file    Bench.h
+ * @brief   DWT cycle counter helpers for on-target benchmarks
+ * @version 1.0
+ * @date    2025
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "Dwt.h"
+
+/**
+ * @brief Enables and resets the DWT cycle counter (1 count per core clock).
+ */
+static __INLINE void Bench_CycleInit(void)
+{
+    DWT_CYCCNT = 0;
+    Dwt_StartCycleCounter();
+}
+
+/**
+ * @brief Returns the current cycle count (wraps after 2^32 cycles, ~59 s at 72 MHz).
+ */
+static __INLINE uint32_t Bench_CycleGet(void)
+{
+    return DWT_CYCCNT;
+}
+
+#endif /* BENCH_H */
@@ -0,0 +1,125 @@
+/*
+ * Dio_Bench.c
+ * Cycle benchmark of the DIO access paths (SPL, BSRR, bit-band, inline)
+ */
+
+#include "Dio_Bench.h"
+#include "Bench.h"
+
+#define DIO_BENCH_LOOPS     64U
+
+/* Cycles of an empty measurement loop, subtracted from every result */
+static uint32_t Dio_Bench_Overhead(void)
+{
+    uint32_t start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) { }
+    return Bench_CycleGet() - start;
+}
+
+static uint32_t Dio_Bench_PerOp(uint32_t cycles, uint32_t overhead, uint32_t opsPerLoop)
+{
+    return (cycles > overhead) ? (cycles - overhead) / (DIO_BENCH_LOOPS * opsPerLoop) : 0;
+}
+
+/* Dio API, whichever path Dio_Init selected */
+static void Dio_Bench_Api(Dio_ChannelType ch, uint32_t overhead, Dio_BenchPathType* res)
+{
+    uint32_t start;
+    volatile Dio_LevelType sink;
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        Dio_WriteChannel(ch, STD_HIGH);
+        Dio_WriteChannel(ch, STD_LOW);
+    }
+    res->Write = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 2);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        sink = Dio_ReadChannel(ch);
+    }
+    res->Read = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        sink = Dio_FlipChannel(ch);
+    }
+    res->Flip = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+    (void)sink;
+}
+
+/* Measures all paths on an output channel with interrupts disabled */
+void Dio_Bench_Run(Dio_ChannelType ChannelId, Dio_BenchResultType* Result)
+{
+    /* The inline row is compiled for DIO_BENCH_CHANNEL: another pin would mix two pins in one comparison */
+    if (Result == NULL_PTR || ChannelId != DIO_BENCH_CHANNEL) {
+        return;
+    }
+
+    GPIO_TypeDef *port = DIO_CHANNEL_PORT(ChannelId);
+    uint16_t pin = (uint16_t)DIO_GET_PIN(ChannelId);
+    volatile uint32_t sink;
+    uint32_t start, overhead;
+
+    Bench_CycleInit();
+    __disable_irq();
+    overhead = Dio_Bench_Overhead();
+
+    /* 1) SPL out-of-line helpers, as the driver used them before */
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        GPIO_SetBits(port, pin);
+        GPIO_ResetBits(port, pin);
+    }
+    Result->Spl.Write = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 2);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        sink = GPIO_ReadInputDataBit(port, pin);
+    }
+    Result->Spl.Read = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        if (GPIO_ReadOutputDataBit(port, pin) == Bit_SET) GPIO_ResetBits(port, pin);
+        else GPIO_SetBits(port, pin);
+    }
+    Result->Spl.Flip = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+
+    /* 2) Dio API, BSRR path */
+    Dio_Init(NULL_PTR);
+    Dio_Bench_Api(ChannelId, overhead, &Result->Bsrr);
+
+    /* 3) Dio API, bit-band path */
+    const Dio_ConfigType bbCfg = {
+        .AccessMode = DIO_ACCESS_BITBAND,
+        .Channels = &ChannelId,
+        .numChannels = 1
+    };
+    Dio_Init(&bbCfg);
+    Dio_Bench_Api(ChannelId, overhead, &Result->BitBand);
+    Dio_Init(NULL_PTR);
+
+    /* 4) Header fast path, constant channel */
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        DIO_SET_CHANNEL_FAST(DIO_BENCH_CHANNEL);
+        DIO_CLEAR_CHANNEL_FAST(DIO_BENCH_CHANNEL);
+    }
+    Result->Inline.Write = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 2);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        sink = DIO_READ_CHANNEL_FAST(DIO_BENCH_CHANNEL);
+    }
+    Result->Inline.Read = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+
+    start = Bench_CycleGet();
+    for (volatile uint32_t i = 0; i < DIO_BENCH_LOOPS; i++) {
+        sink = Dio_FlipChannelFast(DIO_BENCH_CHANNEL);
+    }
+    Result->Inline.Flip = Dio_Bench_PerOp(Bench_CycleGet() - start, overhead, 1);
+
+    __enable_irq();
+    (void)sink;
+}
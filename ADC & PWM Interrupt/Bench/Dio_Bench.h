@@ -0,0 +1,43 @@
+/**
+ * @file    Dio_Bench.h
+ * @brief   Cycle benchmark of the DIO access paths
+ * @version 1.0
+ * @date    2025
+ */
+
+#ifndef DIO_BENCH_H
+#define DIO_BENCH_H
+
+#include "Dio.h"
+
+/** Channel of the run: the inline path needs it as a compile-time constant,
+    so all four paths are measured on this pin (-DDIO_BENCH_CHANNEL=... to move it) */
+#ifndef DIO_BENCH_CHANNEL
+#define DIO_BENCH_CHANNEL   DIO_CHANNEL_C13
+#endif
+
+/** Cycles per operation of one access path */
+typedef struct {
+    uint32_t Write;     /**< One write (average of high/low) */
+    uint32_t Read;      /**< One read */
+    uint32_t Flip;      /**< One flip */
+} Dio_BenchPathType;
+
+/** Result of Dio_Bench_Run, read it with the debugger */
+typedef struct {
+    Dio_BenchPathType Spl;      /**< SPL GPIO_SetBits/ResetBits/ReadInputDataBit */
+    Dio_BenchPathType Bsrr;     /**< Dio API, BSRR path */
+    Dio_BenchPathType BitBand;  /**< Dio API, bit-band path */
+    Dio_BenchPathType Inline;   /**< Header fast path with a constant channel ID */
+} Dio_BenchResultType;
+
+/**
+ * @brief Measures all paths on an output channel with interrupts disabled.
+ * @param ChannelId Output channel to toggle (it will glitch during the run);
+ *                  must be DIO_BENCH_CHANNEL, otherwise nothing is measured.
+ * @param Result Cycles per operation of each path.
+ * @details Leaves Dio in BSRR mode (Dio_Init(NULL_PTR)).
+ */
+void Dio_Bench_Run(Dio_ChannelType ChannelId, Dio_BenchResultType* Result);
+
+#endif /* DIO_BENCH_H */
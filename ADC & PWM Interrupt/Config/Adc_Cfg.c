@@ -1,28 +1,34 @@
 #include "Adc_Cfg.h"
 #include "stm32f10x_adc.h"
+#include "Trace.h"
 
 
 
-void ADC1_2_IRQHandler(void)
+/* Runs from RAM in RAMFUNC=1 builds */
+RAMFUNC void ADC1_2_IRQHandler(void)
 {
+    TRACE_ISR_ENTER();
     for (uint8 group = 0;group < MAX_ADC_GROUPS; group++ ){
         Adc_GroupDefType* groupDef = &Adc_Groups[group];
         Adc_ConfigType* config = &Adc_Configs[groupDef->AdcInstance];
         if (config->NotificationEnable == ADC_NOTIFICATION_ON) {
             if (groupDef->AdcInstance == ADC_1 && ADC_GetITStatus(ADC1, ADC_IT_EOC)) {
                 ADC_ClearITPendingBit(ADC1, ADC_IT_EOC);
+                TRACE_EMIT(TRACE_EV_ADC_DONE, ADC_1, ADC1->DR);
                 if (config->Adc_NotificationCbType) {
                     config->Adc_NotificationCbType();
                 }
             }
             else if (groupDef->AdcInstance == ADC_2 && ADC_GetITStatus(ADC2, ADC_IT_EOC)) {
                 ADC_ClearITPendingBit(ADC2, ADC_IT_EOC);
+                TRACE_EMIT(TRACE_EV_ADC_DONE, ADC_2, ADC2->DR);
                 if (config->Adc_NotificationCbType) {
                     config->Adc_NotificationCbType();
                 }
             }
         }
     }
+    TRACE_ISR_EXIT(TRACE_ISR_ADC);
 }
 
 
@@ -0,0 +1,15 @@
+
+#ifndef DMA_CFG_H
+#define DMA_CFG_H
+
+#include "Dma.h"
+
+void DMA1_Channel1_IRQHandler(void);
+void DMA1_Channel2_IRQHandler(void);
+void DMA1_Channel3_IRQHandler(void);
+void DMA1_Channel4_IRQHandler(void);
+void DMA1_Channel5_IRQHandler(void);
+void DMA1_Channel6_IRQHandler(void);
+void DMA1_Channel7_IRQHandler(void);
+
+#endif // DMA_CFG_H
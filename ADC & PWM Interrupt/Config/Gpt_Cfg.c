@@ -0,0 +1,11 @@
+#include "Gpt_Cfg.h"
+
+
+
+/* TIM4 is left free by PWM (TIM2) and ICU (TIM3): it runs the GPT software
+ * timers (GptConfig.HwTimer = GPT_HW_TIM4) */
+
+void TIM4_IRQHandler(void)
+{
+    Gpt_IrqHandler();
+}
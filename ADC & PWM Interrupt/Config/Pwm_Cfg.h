@@ -3,7 +3,9 @@
 
 #include "Pwm.h"
 
+void TIM1_UP_IRQHandler(void);
+void TIM1_CC_IRQHandler(void);
 void TIM2_IRQHandler(void);
+void TIM3_IRQHandler(void);
 
 #endif // PWM_CFG_H
-
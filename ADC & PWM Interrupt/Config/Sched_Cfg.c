@@ -0,0 +1,17 @@
+#include "Sched_Cfg.h"
+
+
+
+/* 1 ms tick: the scheduler only releases tasks here, they run in Sched_Run */
+
+void SysTick_Handler(void)
+{
+    Sched_Tick();
+}
+
+/* STOP mode wakeup (SCHED_IDLE_STOP) */
+
+void RTCAlarm_IRQHandler(void)
+{
+    Sched_RtcAlarmIrqHandler();
+}
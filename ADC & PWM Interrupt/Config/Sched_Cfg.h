@@ -0,0 +1,9 @@
+#ifndef SCHED_CFG_H
+#define SCHED_CFG_H
+
+#include "Sched.h"
+
+void SysTick_Handler(void);
+void RTCAlarm_IRQHandler(void);
+
+#endif // SCHED_CFG_H
@@ -4,18 +4,31 @@
 #include "stm32f10x_tim.h"
 #include "stm32f10x_conf.h"
 #include "system_stm32f10x.h"
+#include "Mcu.h"
 #include "Port.h"
 #include "Adc.h"
 #include "Adc_Cfg.h"
 #include "Pwm.h"
 #include "Pwm_Cfg.h"
+#include "Icu.h"
+#include "Gpt.h"
+#include "Gpt_Cfg.h"
+#include "Dma.h"
+#include "Dma_Cfg.h"
+#include "Uart.h"
+#include "Trace.h"
+#include "Sched.h"
+#include "Sched_Cfg.h"
+#ifdef DIO_BENCH
+#include "Dio_Bench.h"
+Dio_BenchResultType Dio_BenchResult;
+#endif
 #include "Std_Types.h"
 
-static volatile uint32_t msTicks;
-void SysTick_Handler(void) { msTicks++; }
+/* Start-up waits only; once Sched_Run is entered everything is a task */
 static void Delay_ms(uint32_t ms) {
-    uint32_t start = msTicks;
-    while ((msTicks - start) < ms) { }
+    uint32_t start = Sched_GetTick();
+    while ((Sched_GetTick() - start) < ms) { }
 }
 
 Adc_ValueGroupType myGroup0Buffer[2];  // For 2 channels
@@ -27,15 +40,11 @@ void MyAdcGroup0_Notification(void)
 
 void Pwm_Channel0_Notification(void)
 {
-	if (Dio_ReadChannel(DIO_CHANNEL_C13) == STD_HIGH) {
-		Dio_WriteChannel(DIO_CHANNEL_C13, STD_LOW);
-	} else {
-		Dio_WriteChannel(DIO_CHANNEL_C13, STD_HIGH);
-	}
+	Dio_FlipChannelFast(DIO_CHANNEL_C13);
 }
 
 /* Port (PA0) */
-Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
+const Port_PinConfigType PortCfg_Pins[] = {
     {
       .PortNum           = PORT_ID_A,
       .PinNum            = 0,
@@ -57,15 +66,45 @@ Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
 	.Pull = PORT_PIN_PULL_UP,
 	.ModeChangeable = 0, 		// Mode cannot be changed at runtime
 	.PortNum = PORT_ID_C		// Port C, Pin 13
-	}
+	},
+	{
+	.PortNum = PORT_ID_A,		// PA6 = TIM3_CH1, ICU input
+	.PinNum = 6,
+	.Mode = PORT_PIN_MODE_ICU,
+	.Direction = PORT_PIN_IN,
+	.speed = 2,
+	.DirectionChangeable = 0,
+	.Level = 0,
+	.Pull = PORT_PIN_PULL_NONE,
+	.ModeChangeable = 0
+	},
+#if TRACE_ENABLE
+	{
+	.PortNum = PORT_ID_A,		// PA9 = USART1_TX, trace output
+	.PinNum = 9,
+	.Mode = PORT_PIN_MODE_LIN,	// AF push-pull, same as a LIN/UART TX
+	.Direction = PORT_PIN_OUT,
+	.speed = 50,
+	.DirectionChangeable = 0,
+	.Level = PORT_PIN_LEVEL_HIGH,	// Idle line
+	.Pull = PORT_PIN_PULL_NONE,
+	.ModeChangeable = 0
+	},
+#endif
+};
+
+#if TRACE_ENABLE
+const Uart_ConfigType UartCfg = {
+	.BaudRate = 115200
 };
+#endif
 
 const Port_ConfigType PortCfg = {
 	.PinConfigs = PortCfg_Pins,
 	.PinCount   = sizeof(PortCfg_Pins)/sizeof(*PortCfg_Pins)
 };
 
-// Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
+// const Port_PinConfigType PortCfg_Pins[] = {
 // 	{
 // 	.PinNum = 0,				// Pin 45 corresponds to PC13
 // 	.Mode = PORT_PIN_MODE_ADC,
@@ -113,6 +152,16 @@ Adc_GroupDefType Adc_Groups[] = {
     }
 };
 
+const Adc_GroupDmaConfigType AdcGroupDmaConfig[] = {
+    {
+		.ADCx = ADC1,
+		.groupId = 0,
+		.channelCount = 1,
+		.Adc_DmaNotificationCbType = NULL_PTR
+	}
+};
+const uint8_t AdcNumGroupsDma = sizeof(AdcGroupDmaConfig)/sizeof(*AdcGroupDmaConfig);
+
 Pwm_ChannelConfigType Pwm_Channels[] = {
 	{
 	.Channel = 4, // Channel 4
@@ -131,15 +180,119 @@ const Pwm_ConfigType PwmConfig = {
 	.numChannels = 1 // Number of configured PWM channels
 };
 
+/* ICU: measure period/duty of the signal on PA6 (e.g. loop PA0 PWM back to PA6) */
+const Icu_ChannelConfigType Icu_Channels[] = {
+	{
+	.HwChannel = 8, 							// TIM3 CH1
+	.MeasurementMode = ICU_MODE_SIGNAL_MEASUREMENT,
+	.Property = ICU_DUTY_CYCLE,
+	.DefaultStartEdge = ICU_RISING_EDGE,
+	.TickUs = 1, 							// 1 us per tick at any clock setting
+	.Filter = 0,
+	.TimestampNotification = NULL_PTR
+	}
+};
+
+const Icu_ConfigType IcuConfig = {
+	.Channels = Icu_Channels,
+	.numChannels = 1
+};
+
+Icu_DutyCycleType myServoPulse;
+
+/* One servo sweep 0.6 ms -> 2.4 ms -> 0.6 ms, one sample per 20 ms period (1 s per sweep) */
+static const uint16_t Servo_SweepTable[50] = {
+	 600,  607,  628,  663,  711,  772,  844,  926, 1018, 1117,
+	1222, 1331, 1443, 1557, 1669, 1778, 1883, 1982, 2074, 2156,
+	2228, 2289, 2337, 2372, 2393, 2400, 2393, 2372, 2337, 2289,
+	2228, 2156, 2074, 1982, 1883, 1778, 1669, 1557, 1443, 1331,
+	1222, 1117, 1018,  926,  844,  772,  711,  663,  628,  607
+};
+
+/* Scheduler tasks */
+#if TRACE_ENABLE
+static void App_Task10ms(void)
+{
+	Trace_MainFunction();		// Hand trace records to the UART ring
+}
+#endif
+
+/* GPT: software timeouts on TIM4 */
+#define APP_GPT_ICU_TIMEOUT		0U		// No new servo period measured for 250 ms
+#define APP_ICU_TIMEOUT_US		250000UL
+
+static uint32_t App_IcuTimeouts;
+
+static void App_IcuTimeout(void)
+{
+	App_IcuTimeouts++;				// Signal lost: the last measurement is stale
+	myServoPulse.ActiveTime = 0;
+	myServoPulse.PeriodTime = 0;
+}
+
+const Gpt_ChannelConfigType Gpt_Channels[] = {
+	[APP_GPT_ICU_TIMEOUT] = { .Mode = GPT_CH_MODE_ONESHOT, .Notification = App_IcuTimeout },
+};
+
+const Gpt_ConfigType GptConfig = {
+	.HwTimer     = GPT_HW_TIM4,
+	.IrqPriority = 6,
+	.Channels    = Gpt_Channels,
+	.numChannels = sizeof(Gpt_Channels)/sizeof(*Gpt_Channels)
+};
+
+static void App_Task100ms(void)
+{
+	if (Icu_GetInputState(0) == ICU_ACTIVE) {
+		Icu_GetDutyCycleValues(0, &myServoPulse);
+		Gpt_StartTimer(APP_GPT_ICU_TIMEOUT, APP_ICU_TIMEOUT_US);	// Restart the timeout
+	}
+}
+
+/* Table order is priority order; 100 ms work lands on its own tick (auto offset) */
+const Sched_TaskConfigType Sched_Tasks[] = {
+#if TRACE_ENABLE
+	{ .Task = App_Task10ms,  .PeriodMs = 10,  .OffsetMs = 0,                 .WcetCycles = 2000 },
+#endif
+	{ .Task = App_Task100ms, .PeriodMs = 100, .OffsetMs = SCHED_OFFSET_AUTO, .WcetCycles = 500 },
+};
+
+const Sched_ConfigType SchedConfig = {
+	.Tasks    = Sched_Tasks,
+	.NumTasks = sizeof(Sched_Tasks)/sizeof(*Sched_Tasks),
+	.IdleMode = SCHED_IDLE_TICKLESS	// PWM/ICU/DMA run continuously: STOP would halt them
+};
+
+const Mcu_ConfigType McuConfig = {
+	.ClockSetting     = MCU_CLOCK_72MHZ,
+	.GateUnusedClocks = TRUE
+};
 
 int main(){
 
-	SystemInit();
-    SystemCoreClockUpdate();
-    SysTick_Config(SystemCoreClock / 1000);
+	// SystemInit already ran in Reset_Handler (before the .data copy);
+	// Mcu_InitClock keeps the PLL and brings ADCCLK back to 12 MHz
+	Mcu_Init(&McuConfig);
+	(void)Mcu_InitClock(McuConfig.ClockSetting);
+	Sched_Init(&SchedConfig);	// SysTick 1 ms; tasks wait for Sched_Start
 
 	// Initialize the pin configuration
 	Port_Init(&PortCfg);
+
+	// DMA channels are requested by the drivers (PWM waveform, ICU timestamps, ADC)
+	Dma_Init();
+
+	// Timebase before Trace_Init: trace records are stamped with Gpt_GetTimestamp
+	Gpt_Init(&GptConfig);
+
+#if TRACE_ENABLE
+	Uart_Init(&UartCfg);		// DMA1 Channel4
+	Trace_Init();
+#endif
+
+#ifdef DIO_BENCH
+	Dio_Bench_Run(DIO_BENCH_CHANNEL, &Dio_BenchResult);
+#endif
 	
 	// Adc_Init(&Adc_Configs[0]);
 	// Adc_StartGroupConversion(0);
@@ -150,16 +303,17 @@ int main(){
     // Enable both edges for channel 0
     Pwm_EnableNotification(0, PWM_BOTH_EDGES);
 
+	Icu_Init(&IcuConfig);
+	Icu_StartSignalMeasurement(0);
+
+	Gpt_StartTimer(APP_GPT_ICU_TIMEOUT, APP_ICU_TIMEOUT_US);
+
 	/* let servo center */
     Delay_ms(500);
 
-    while (1) {
-        /* extreme “0” */
-        Pwm_SetDutyCycle(0, 0);
-        Delay_ms(500);
+	/* sweep the servo by DMA: no CPU work per sample */
+	Pwm_StartWaveform(0, 1, Servo_SweepTable, 50, PWM_WAVEFORM_CIRCULAR);
 
-        /* extreme “100” */
-        Pwm_SetDutyCycle(0, 100);
-        Delay_ms(500);
-    }
+	Sched_Start();
+	Sched_Run();				// Never returns
 }
@@ -28,7 +28,7 @@ void delay_ms(TIM_TypeDef *TIM_Struct,uint16_t time){
 }
 
 
-Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
+Port_PinConfigType PortCfg_Pins[] = {
 	{
 	.PinNum = 0,				// Pin 45 corresponds to PC13
 	.Mode = PORT_PIN_MODE_ADC,
@@ -46,7 +46,7 @@ Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
 Adc_ConfigType Adc_Config = {
 	.ConvMode = ADC_CONV_MODE_CONTINUOUS,
 	.TriggerSource = ADC_TRIGG_SRC_SW,
-	.NotificatioEnable = ADC_NOTIFICATION_OFF,
+	.NotificationEnable = ADC_NOTIFICATION_OFF,
 	.numChannels = 1,
 	.Instance = ADC_1, // Using ADC1
 	.ResultAlignment = ADC_ALIGN_RIGHT,
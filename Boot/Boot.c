@@ -0,0 +1,53 @@
+/*
+ * Boot.c
+ * Boot-phase timestamps implementation
+ */
+
+#include "Boot.h"
+#include "Dwt.h"    /* CYCCNT is started by Reset_Handler */
+
+/* Clock of the CLOCKS phase: the core runs on HSI until SystemInit switches to the PLL */
+#define BOOT_RESET_CLOCK_MHZ    (HSI_VALUE / 1000000UL)
+
+Boot_RecordType Boot_Record __attribute__((section(".noinit")));
+
+void Boot_Init(uint32_t ClockCycles) {
+    uint32_t now = DWT_CYCCNT;
+
+    if (Boot_Record.Magic == BOOT_MAGIC) {
+        Boot_Record.Count++;
+    } else {
+        Boot_Record.Magic = BOOT_MAGIC;     // Power-on: RAM content is random
+        Boot_Record.Count = 1U;
+    }
+    Boot_Record.CoreClockHz = SystemCoreClock;
+    for (uint32_t i = 0; i < BOOT_NUM_PHASES; i++) {
+        Boot_Record.Cycles[i] = 0U;
+    }
+    // CYCCNT is 0 at the release of reset; a nonzero value marks a stamped phase
+    Boot_Record.Cycles[BOOT_PHASE_CLOCKS] = ClockCycles;
+    Boot_Record.Cycles[BOOT_PHASE_RAM_INIT] = now;
+}
+
+void Boot_Stamp(Boot_PhaseType Phase) {
+    if (Phase >= BOOT_NUM_PHASES || Boot_Record.Cycles[Phase] != 0U) {
+        return;
+    }
+    Boot_Record.Cycles[Phase] = DWT_CYCCNT;
+}
+
+uint32_t Boot_GetTimeUs(Boot_PhaseType Phase) {
+    if (Phase == BOOT_PHASE_RESET) {
+        return 0U;
+    }
+    if (Phase >= BOOT_NUM_PHASES || Boot_Record.Cycles[Phase] == 0U) {
+        return 0xFFFFFFFFUL;
+    }
+    uint32_t clocks = Boot_Record.Cycles[BOOT_PHASE_CLOCKS];
+    uint32_t us = clocks / BOOT_RESET_CLOCK_MHZ;
+    if (Phase != BOOT_PHASE_CLOCKS) {
+        uint32_t mhz = Boot_Record.CoreClockHz / 1000000UL;
+        us += (Boot_Record.Cycles[Phase] - clocks) / (mhz ? mhz : 1U);
+    }
+    return us;
+}
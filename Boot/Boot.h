@@ -0,0 +1,75 @@
+/**
+ * @file    Boot.h
+ * @brief   Boot-phase timestamps kept in no-init RAM
+ * @version 1.0
+ * @date    2025
+ *
+ * Reset_Handler starts the DWT cycle counter as its first action, so CYCCNT
+ * counts core cycles since reset. The end of each boot phase is stamped
+ * once per boot into Boot_Record:
+ *   BOOT_PHASE_CLOCKS      SystemInit returned (HSE + PLL locked)
+ *   BOOT_PHASE_RAM_INIT    .data copied, .bss zeroed (Boot_Init, from the startup)
+ *   BOOT_PHASE_PORT_INIT   Port_Init done           (application)
+ *   BOOT_PHASE_CAN_INIT    Can_Init / CanIf_Init done (application)
+ *   BOOT_PHASE_FIRST_CAN_TX first frame queued in a TX mailbox (application)
+ *
+ * Boot_Record lives in .noinit: the startup neither copies nor zeroes it,
+ * so it can be read by a debugger or sent by the application at any time
+ * after the boot, and Boot_Record.Count survives warm resets.
+ *
+ * The CLOCKS phase runs on the 8 MHz HSI, the later ones on SystemCoreClock;
+ * Boot_GetTimeUs converts with the right clock for each part. The time from
+ * power-up to the release of reset (supply ramp, POR) is not included.
+ */
+
+#ifndef BOOT_H
+#define BOOT_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+
+#define BOOT_MAGIC              0xB007B007UL
+
+/** Boot phases, in boot order; each value is the end of that phase */
+typedef enum {
+    BOOT_PHASE_RESET = 0,       /**< Reset released: CYCCNT = 0 by definition */
+    BOOT_PHASE_CLOCKS,
+    BOOT_PHASE_RAM_INIT,
+    BOOT_PHASE_PORT_INIT,
+    BOOT_PHASE_CAN_INIT,
+    BOOT_PHASE_FIRST_CAN_TX,
+    BOOT_NUM_PHASES
+} Boot_PhaseType;
+
+/** Boot record in no-init RAM */
+typedef struct {
+    uint32_t Magic;                         /**< BOOT_MAGIC once the record is valid */
+    uint32_t Count;                         /**< Boots since the record was first valid (power-on) */
+    uint32_t CoreClockHz;                   /**< SystemCoreClock after the CLOCKS phase */
+    uint32_t Cycles[BOOT_NUM_PHASES];       /**< CYCCNT at the end of each phase, 0 = not reached yet */
+} Boot_RecordType;
+
+extern Boot_RecordType Boot_Record;
+
+/**
+ * @brief Starts the record of this boot.
+ * @param ClockCycles CYCCNT read by Reset_Handler right after SystemInit.
+ * @details Called by Reset_Handler after the RAM init, before main; stamps
+ *          BOOT_PHASE_CLOCKS and BOOT_PHASE_RAM_INIT.
+ */
+void Boot_Init(uint32_t ClockCycles);
+
+/**
+ * @brief Stamps the end of a phase with the current CYCCNT.
+ * @details Only the first call per phase and boot counts, so the stamp of
+ *          e.g. BOOT_PHASE_FIRST_CAN_TX can sit on the regular TX path.
+ */
+void Boot_Stamp(Boot_PhaseType Phase);
+
+/**
+ * @brief Time from reset to the end of a phase.
+ * @return Microseconds, or 0xFFFFFFFF if the phase has not been reached in this boot.
+ */
+uint32_t Boot_GetTimeUs(Boot_PhaseType Phase);
+
+#endif /* BOOT_H */
@@ -0,0 +1,597 @@
+#include "CanTp.h"
+#include "canif.h"    // CanIf_Transmit
+
+// Byte PCI (N_PCI): loại frame ở 4 bit cao
+#define CANTP_PCI_SF         0x00U
+#define CANTP_PCI_FF         0x10U
+#define CANTP_PCI_CF         0x20U
+#define CANTP_PCI_FC         0x30U
+
+// Flow status trong FC
+#define CANTP_FC_CTS         0x00U
+#define CANTP_FC_WAIT        0x01U
+#define CANTP_FC_OVFLW       0x02U
+
+#define CANTP_SF_MAX         7U       // byte dữ liệu tối đa của SF (CAN 8 byte)
+#define CANTP_CF_MAX         7U
+#define CANTP_FF12_MAX       4095U    // lớn hơn: FF 32 bit (escape 0x1000)
+
+typedef enum {
+    CANTP_RX_IDLE = 0,
+    CANTP_RX_WAIT_CF,             // đã gửi FC CTS, chờ CF
+    CANTP_RX_WAIT_BUFFER          // đã gửi FC WAIT, chờ ứng dụng trả segment
+} CanTp_RxStateType;
+
+typedef enum {
+    CANTP_TX_IDLE = 0,
+    CANTP_TX_WAIT_FC,             // sau FF hoặc cuối block
+    CANTP_TX_SEND_CF,             // gửi CF theo lịch Gpt
+    CANTP_TX_WAIT_CONF            // STmin > 0: CF đã vào mailbox, chờ nó rời bus
+} CanTp_TxStateType;
+
+// ===============================
+// Trạng thái runtime của kênh (static)
+// ===============================
+typedef struct {
+    // RX
+    uint8_t   RxState;
+    uint8_t   RxSn;               // SN của CF kế tiếp
+    uint8_t   RxBlockLeft;        // CF còn lại trong block (0: không giới hạn)
+    uint8_t   RxWaits;            // FC WAIT liên tiếp
+    uint8_t   RxFcPending;        // FC chưa vào được mailbox, gửi lại theo lịch Gpt
+    uint8_t   RxFc[3];
+    uint8_t   RxGen;              // tăng mỗi lần message bắt đầu/kết thúc: phát hiện hủy khi đã mở khóa
+    uint8_t   RxNotify;           // RxIndication chờ gọi sau khi mở khóa
+    Std_ReturnType RxResult;
+    uint16_t  RxTimerMs;          // N_Cr
+    uint16_t  RxSegSize;
+    uint16_t  RxSegFill;
+    uint8_t*  RxSeg;
+    uint32_t  RxLength;
+    uint32_t  RxCount;
+    uint32_t  RxFcDue;            // Gpt_GetTimeUs
+    // TX
+    uint8_t   TxState;
+    uint8_t   TxSn;
+    uint8_t   TxBs;
+    uint8_t   TxBlockLeft;
+    uint8_t   TxNotify;           // TxConfirmation chờ gọi sau khi mở khóa
+    Std_ReturnType TxResult;
+    uint16_t  TxTimerMs;          // N_Bs, N_As
+    uint32_t  TxStminUs;
+    uint32_t  TxDue;              // Gpt_GetTimeUs của CF kế tiếp
+    const uint8_t* TxData;
+    uint32_t  TxLength;
+    uint32_t  TxCount;
+} CanTp_ChannelType;
+
+static const CanTp_ConfigType* CanTp_Cfg = NULL_PTR;
+// Dùng từ CAN RX ISR, ngắt Gpt và main loop: truy cập trong Compiler_EnterCritical.
+// Callback của ứng dụng gọi ngoài vùng khóa: kết quả ghi lại, CanTp_Notify gọi sau.
+static CanTp_ChannelType CanTp_Channels[CANTP_MAX_CHANNELS];
+
+static void CanTp_Service(void);
+
+/* Thời điểm a đã tới (so với now, modulo 2^32) */
+static __INLINE boolean CanTp_Due(uint32_t a, uint32_t now) {
+    return (int32_t)(now - a) >= 0;
+}
+
+/* Mã STmin (ISO 15765-2) -> us; giá trị dành riêng tính như 127 ms */
+static uint32_t CanTp_StminUs(uint8_t stmin) {
+    if (stmin <= 0x7FU) {
+        return (uint32_t)stmin * 1000U;
+    }
+    if (stmin >= 0xF1U && stmin <= 0xF9U) {
+        return (uint32_t)(stmin - 0xF0U) * 100U;
+    }
+    return 127000U;
+}
+
+/* Ghép PCI + payload (+ padding) và gửi qua CanIf */
+static Std_ReturnType CanTp_SendFrame(PduIdType Channel, const uint8_t* pci, uint8_t pciLen,
+                                      const uint8_t* payload, uint32_t n)
+{
+    const CanTp_ChannelConfigType* cfg = &CanTp_Cfg->Channels[Channel];
+    uint8_t frame[8];
+    uint8_t len = 0;
+    while (len < pciLen) {
+        frame[len] = pci[len];
+        len++;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        frame[len++] = payload[i];
+    }
+    if (cfg->Padding) {
+        while (len < 8U) frame[len++] = cfg->PaddingByte;
+    }
+    return (CanIf_Transmit(cfg->TxPduId, frame, len) == 0) ? E_OK : E_NOT_OK;
+}
+
+/* Gửi FC; mailbox đầy thì giữ lại và gửi lại từ CanTp_Service */
+static void CanTp_SendFc(PduIdType Channel, uint8_t fs, uint8_t bs, uint8_t stmin)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    st->RxFc[0] = (uint8_t)(CANTP_PCI_FC | fs);
+    st->RxFc[1] = bs;
+    st->RxFc[2] = stmin;
+    if (CanTp_SendFrame(Channel, st->RxFc, 3U, NULL_PTR, 0U) == E_OK) {
+        st->RxFcPending = 0U;
+    } else {
+        st->RxFcPending = 1U;
+        st->RxFcDue = Gpt_GetTimeUs() + CANTP_TX_RETRY_US;
+    }
+}
+
+/* Kết thúc nhận/gửi (trong vùng khóa): callback được ghi lại cho CanTp_Notify */
+static void CanTp_RxFinish(PduIdType Channel, Std_ReturnType Result)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    st->RxState = CANTP_RX_IDLE;
+    st->RxFcPending = 0U;
+    st->RxGen++;
+    st->RxNotify = 1U;
+    st->RxResult = Result;
+}
+
+static void CanTp_TxFinish(PduIdType Channel, Std_ReturnType Result)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    st->TxState = CANTP_TX_IDLE;
+    st->TxNotify = 1U;
+    st->TxResult = Result;
+}
+
+/* Gọi các callback kết thúc đang chờ, sau Compiler_ExitCritical. Context nào gọi
+   trước thì báo cho mọi kênh, mỗi kết quả được báo đúng một lần. */
+static void CanTp_Notify(void)
+{
+    for (PduIdType ch = 0; ch < CanTp_Cfg->numChannels; ch++) {
+        CanTp_ChannelType* st = &CanTp_Channels[ch];
+        uint32_t primask = Compiler_EnterCritical();
+        uint8_t rx = st->RxNotify;
+        uint8_t tx = st->TxNotify;
+        Std_ReturnType rxResult = st->RxResult;
+        Std_ReturnType txResult = st->TxResult;
+        st->RxNotify = 0U;
+        st->TxNotify = 0U;
+        Compiler_ExitCritical(primask);
+
+        if (rx && CanTp_Cfg->RxIndication != NULL_PTR) {
+            CanTp_Cfg->RxIndication(ch, rxResult);
+        }
+        if (tx && CanTp_Cfg->TxConfirmation != NULL_PTR) {
+            CanTp_Cfg->TxConfirmation(ch, txResult);
+        }
+    }
+}
+
+/* Sau FF hoặc cuối block: đảm bảo segment còn chỗ cho CF kế tiếp rồi gửi FC.
+   BS được giảm để cả block nằm gọn trong phần trống của segment.
+   Gọi ngoài vùng khóa: RxSegment của ứng dụng chạy khi ngắt mở. */
+static void CanTp_RxContinue(PduIdType Channel)
+{
+    const CanTp_ChannelConfigType* cfg = &CanTp_Cfg->Channels[Channel];
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    uint32_t primask = Compiler_EnterCritical();
+    uint32_t remaining = st->RxLength - st->RxCount;
+    uint32_t need = (remaining < CANTP_CF_MAX) ? remaining : CANTP_CF_MAX;
+    uint32_t space = (uint32_t)st->RxSegSize - st->RxSegFill;
+    boolean send = TRUE;
+
+    if (space < need) {
+        CanTp_SegmentType seg = { st->RxSeg, st->RxSegFill };
+        uint8_t gen = st->RxGen;
+        Compiler_ExitCritical(primask);
+        Std_ReturnType ret = (CanTp_Cfg->RxSegment != NULL_PTR) ? CanTp_Cfg->RxSegment(Channel, &seg) : E_NOT_OK;
+        primask = Compiler_EnterCritical();
+
+        if (st->RxGen != gen) {
+            send = FALSE;                        // message bị hủy trong lúc ứng dụng cấp segment
+        } else if (ret != E_OK || seg.Data == NULL_PTR) {
+            // Chưa có buffer: FC WAIT, hỏi lại ở main function sau
+            send = FALSE;
+            if (st->RxWaits >= cfg->MaxWaits) {
+                CanTp_RxFinish(Channel, E_NOT_OK);
+            } else {
+                st->RxWaits++;
+                st->RxState = CANTP_RX_WAIT_BUFFER;
+                CanTp_SendFc(Channel, CANTP_FC_WAIT, 0U, 0U);
+            }
+        } else if (seg.Size < need) {
+            send = FALSE;
+            CanTp_RxFinish(Channel, E_NOT_OK);   // segment nhỏ hơn một CF
+        } else {
+            st->RxSeg = seg.Data;
+            st->RxSegSize = seg.Size;
+            st->RxSegFill = 0U;
+            space = seg.Size;
+        }
+    }
+    if (send) {
+        st->RxWaits = 0U;
+        uint8_t bs = cfg->BlockSize;
+        if (remaining > space) {
+            uint32_t fit = space / CANTP_CF_MAX;
+            if (fit > 255U) fit = 255U;
+            if (bs == 0U || bs > fit) bs = (uint8_t)fit;
+        }
+        st->RxBlockLeft = bs;
+        st->RxState = CANTP_RX_WAIT_CF;
+        st->RxTimerMs = cfg->TimeoutMs;
+        CanTp_SendFc(Channel, CANTP_FC_CTS, bs, cfg->STmin);
+    }
+    if (st->RxFcPending) {
+        CanTp_Service();                         // FC chưa vào mailbox: hẹn gửi lại
+    }
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+}
+
+/* Chép payload vào segment hiện tại (chỗ trống đã được RxContinue/RxStart bảo đảm) */
+static void CanTp_RxCopy(CanTp_ChannelType* st, const uint8_t* payload, uint32_t n)
+{
+    uint8_t* dst = &st->RxSeg[st->RxSegFill];
+    for (uint32_t i = 0; i < n; i++) {
+        dst[i] = payload[i];
+    }
+    st->RxSegFill = (uint16_t)(st->RxSegFill + n);
+    st->RxCount += n;
+}
+
+/* SF / FF: bắt đầu message mới (message đang nhận dở bị hủy). Gọi ngoài vùng khóa. */
+static void CanTp_RxFirst(PduIdType Channel, const uint8_t* data, uint8_t len)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    uint32_t length;
+    uint8_t offset;
+
+    if ((data[0] & 0xF0U) == CANTP_PCI_SF) {
+        length = data[0] & 0x0FU;
+        offset = 1U;
+        if (length == 0U || length > CANTP_SF_MAX || length > (uint32_t)(len - 1U)) {
+            return;
+        }
+    } else {
+        if (len < 8U) {
+            return;
+        }
+        length = ((uint32_t)(data[0] & 0x0FU) << 8) | data[1];
+        offset = 2U;
+        if (length == 0U) {   // FF 32 bit
+            length = ((uint32_t)data[2] << 24) | ((uint32_t)data[3] << 16) |
+                     ((uint32_t)data[4] << 8) | data[5];
+            offset = 6U;
+            if (length <= CANTP_FF12_MAX) {
+                return;
+            }
+        } else if (length <= CANTP_SF_MAX) {
+            return;
+        }
+    }
+
+    // Message cũ được báo hủy trước khi ứng dụng cấp segment cho message mới
+    uint32_t primask = Compiler_EnterCritical();
+    if (st->RxState != CANTP_RX_IDLE) {
+        CanTp_RxFinish(Channel, E_NOT_OK);
+    }
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+
+    CanTp_SegmentType seg = { NULL_PTR, 0U };
+    uint32_t first = (length < (uint32_t)(8U - offset)) ? length : (uint32_t)(8U - offset);
+    Std_ReturnType ret = (CanTp_Cfg->RxStart != NULL_PTR) ? CanTp_Cfg->RxStart(Channel, length, &seg) : E_NOT_OK;
+
+    primask = Compiler_EnterCritical();
+    if (ret != E_OK || seg.Data == NULL_PTR || seg.Size < first) {
+        if (offset != 1U) {
+            CanTp_SendFc(Channel, CANTP_FC_OVFLW, 0U, 0U);
+            if (st->RxFcPending) {
+                CanTp_Service();
+            }
+        }
+        Compiler_ExitCritical(primask);
+        return;
+    }
+    st->RxGen++;
+    st->RxSeg = seg.Data;
+    st->RxSegSize = seg.Size;
+    st->RxSegFill = 0U;
+    st->RxLength = length;
+    st->RxCount = 0U;
+    st->RxWaits = 0U;
+    CanTp_RxCopy(st, &data[offset], first);
+
+    if (offset == 1U) {
+        CanTp_RxFinish(Channel, E_OK);
+        Compiler_ExitCritical(primask);
+        CanTp_Notify();
+        return;
+    }
+    st->RxSn = 1U;
+    Compiler_ExitCritical(primask);
+    CanTp_RxContinue(Channel);
+}
+
+/* CF (trong vùng khóa); TRUE: hết block, người gọi chạy CanTp_RxContinue sau khi mở khóa */
+static boolean CanTp_RxConsecutive(PduIdType Channel, const uint8_t* data, uint8_t len)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    if (st->RxState != CANTP_RX_WAIT_CF) {
+        return FALSE;
+    }
+    if ((data[0] & 0x0FU) != st->RxSn) {
+        CanTp_RxFinish(Channel, E_NOT_OK);   // mất hoặc lặp frame
+        return FALSE;
+    }
+    uint32_t remaining = st->RxLength - st->RxCount;
+    uint32_t n = (remaining < CANTP_CF_MAX) ? remaining : CANTP_CF_MAX;
+    if ((uint32_t)(len - 1U) < n) {
+        return FALSE;   // frame ngắn hơn dữ liệu còn thiếu: bỏ qua
+    }
+    CanTp_RxCopy(st, &data[1], n);
+    st->RxSn = (uint8_t)((st->RxSn + 1U) & 0x0FU);
+    st->RxTimerMs = CanTp_Cfg->Channels[Channel].TimeoutMs;
+
+    if (st->RxCount >= st->RxLength) {
+        CanTp_RxFinish(Channel, E_OK);
+        return FALSE;
+    }
+    return (st->RxBlockLeft != 0U && --st->RxBlockLeft == 0U) ? TRUE : FALSE;
+}
+
+/* Gửi CF tới khi hết message, hết block, phải chờ STmin hoặc mailbox đầy */
+static void CanTp_TxConsecutive(PduIdType Channel, uint32_t now)
+{
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    for (;;) {
+        uint32_t n = st->TxLength - st->TxCount;
+        if (n > CANTP_CF_MAX) n = CANTP_CF_MAX;
+        uint8_t pci = (uint8_t)(CANTP_PCI_CF | st->TxSn);
+        if (CanTp_SendFrame(Channel, &pci, 1U, &st->TxData[st->TxCount], n) != E_OK) {
+            st->TxDue = now + CANTP_TX_RETRY_US;
+            return;
+        }
+        st->TxCount += n;
+        st->TxSn = (uint8_t)((st->TxSn + 1U) & 0x0FU);
+
+        if (st->TxCount >= st->TxLength) {
+            CanTp_TxFinish(Channel, E_OK);
+            return;
+        }
+        if (st->TxBs != 0U && --st->TxBlockLeft == 0U) {
+            st->TxState = CANTP_TX_WAIT_FC;
+            st->TxTimerMs = CanTp_Cfg->Channels[Channel].TimeoutMs;
+            return;
+        }
+        if (st->TxStminUs != 0U) {
+            // STmin tính từ lúc CF rời bus (CanTp_TxConfirmation): tính từ lúc vào
+            // mailbox thì khoảng trống trên bus hụt mất thời gian frame và arbitration
+            st->TxState = CANTP_TX_WAIT_CONF;
+            st->TxTimerMs = CanTp_Cfg->Channels[Channel].TimeoutMs;
+            return;
+        }
+    }
+}
+
+/* Việc tới hạn của mọi kênh, rồi hẹn kênh Gpt cho việc sớm nhất */
+static void CanTp_Service(void)
+{
+    uint32_t now = Gpt_GetTimeUs();
+    int32_t next = INT32_MAX;
+
+    for (PduIdType ch = 0; ch < CanTp_Cfg->numChannels; ch++) {
+        CanTp_ChannelType* st = &CanTp_Channels[ch];
+        if (st->RxFcPending && CanTp_Due(st->RxFcDue, now)) {
+            CanTp_SendFc(ch, (uint8_t)(st->RxFc[0] & 0x0FU), st->RxFc[1], st->RxFc[2]);
+        }
+        if (st->TxState == CANTP_TX_SEND_CF && CanTp_Due(st->TxDue, now)) {
+            CanTp_TxConsecutive(ch, now);
+        }
+        if (st->RxFcPending && (int32_t)(st->RxFcDue - now) < next) {
+            next = (int32_t)(st->RxFcDue - now);
+        }
+        if (st->TxState == CANTP_TX_SEND_CF && (int32_t)(st->TxDue - now) < next) {
+            next = (int32_t)(st->TxDue - now);
+        }
+    }
+    if (next != INT32_MAX) {
+        Gpt_StartTimer(CanTp_Cfg->GptChannel, (next > 0) ? (Gpt_ValueType)next : 1U);
+    }
+}
+
+// ================================
+// Khởi tạo
+// ================================
+void CanTp_Init(const CanTp_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR || ConfigPtr->numChannels > CANTP_MAX_CHANNELS) {
+        return;
+    }
+    for (uint8_t i = 0; i < CANTP_MAX_CHANNELS; i++) {
+        CanTp_Channels[i].RxState = CANTP_RX_IDLE;
+        CanTp_Channels[i].RxFcPending = 0U;
+        CanTp_Channels[i].TxState = CANTP_TX_IDLE;
+        CanTp_Channels[i].RxNotify = 0U;
+        CanTp_Channels[i].TxNotify = 0U;
+    }
+    CanTp_Cfg = ConfigPtr;
+}
+
+// ================================
+// TX
+// ================================
+Std_ReturnType CanTp_Transmit(PduIdType Channel, const uint8_t* Data, uint32_t Length)
+{
+    if (CanTp_Cfg == NULL_PTR || Channel >= CanTp_Cfg->numChannels || Data == NULL_PTR || Length == 0U) {
+        return E_NOT_OK;
+    }
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    Std_ReturnType ret = E_NOT_OK;
+
+    uint32_t primask = Compiler_EnterCritical();
+    if (st->TxState != CANTP_TX_IDLE) {
+        Compiler_ExitCritical(primask);
+        return E_NOT_OK;
+    }
+    if (Length <= CANTP_SF_MAX) {
+        uint8_t pci = (uint8_t)(CANTP_PCI_SF | Length);
+        ret = CanTp_SendFrame(Channel, &pci, 1U, Data, Length);
+        if (ret == E_OK) {
+            CanTp_TxFinish(Channel, E_OK);
+        }
+    } else {
+        uint8_t pci[6];
+        uint8_t pciLen;
+        if (Length <= CANTP_FF12_MAX) {
+            pci[0] = (uint8_t)(CANTP_PCI_FF | (Length >> 8));
+            pci[1] = (uint8_t)Length;
+            pciLen = 2U;
+        } else {
+            pci[0] = CANTP_PCI_FF;
+            pci[1] = 0U;
+            pci[2] = (uint8_t)(Length >> 24);
+            pci[3] = (uint8_t)(Length >> 16);
+            pci[4] = (uint8_t)(Length >> 8);
+            pci[5] = (uint8_t)Length;
+            pciLen = 6U;
+        }
+        ret = CanTp_SendFrame(Channel, pci, pciLen, Data, 8U - pciLen);
+        if (ret == E_OK) {
+            st->TxData = Data;
+            st->TxLength = Length;
+            st->TxCount = 8U - pciLen;
+            st->TxSn = 1U;
+            st->TxState = CANTP_TX_WAIT_FC;
+            st->TxTimerMs = CanTp_Cfg->Channels[Channel].TimeoutMs;
+        }
+    }
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+    return ret;
+}
+
+void CanTp_GptNotification(void)
+{
+    if (CanTp_Cfg == NULL_PTR) {
+        return;
+    }
+    uint32_t primask = Compiler_EnterCritical();
+    CanTp_Service();
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+}
+
+/* Đếm lùi timer ms theo chu kỳ main function; TRUE khi hết hạn */
+static boolean CanTp_TimerExpired(uint16_t* timer)
+{
+    if (*timer <= CanTp_Cfg->MainFunctionPeriodMs) {
+        *timer = 0U;
+        return TRUE;
+    }
+    *timer = (uint16_t)(*timer - CanTp_Cfg->MainFunctionPeriodMs);
+    return FALSE;
+}
+
+void CanTp_MainFunction(void)
+{
+    if (CanTp_Cfg == NULL_PTR) {
+        return;
+    }
+    for (PduIdType ch = 0; ch < CanTp_Cfg->numChannels; ch++) {
+        CanTp_ChannelType* st = &CanTp_Channels[ch];
+        boolean more = FALSE;
+        uint32_t primask = Compiler_EnterCritical();
+        if (st->RxState == CANTP_RX_WAIT_CF && CanTp_TimerExpired(&st->RxTimerMs)) {
+            CanTp_RxFinish(ch, E_NOT_OK);          // N_Cr
+        } else if (st->RxState == CANTP_RX_WAIT_BUFFER) {
+            more = TRUE;
+        }
+        if ((st->TxState == CANTP_TX_WAIT_FC || st->TxState == CANTP_TX_WAIT_CONF) &&
+            CanTp_TimerExpired(&st->TxTimerMs)) {
+            CanTp_TxFinish(ch, E_NOT_OK);          // N_Bs, N_As (CF không rời được bus)
+        }
+        Compiler_ExitCritical(primask);
+        CanTp_Notify();
+        if (more) {
+            CanTp_RxContinue(ch);                  // FC CTS hoặc thêm một FC WAIT
+        }
+    }
+}
+
+// ================================
+// Xác nhận gửi (từ CanIf, trong CAN TX ISR)
+// ================================
+void CanTp_TxConfirmation(PduIdType TxPduId)
+{
+    if (CanTp_Cfg == NULL_PTR) {
+        return;
+    }
+    boolean due = FALSE;
+    uint32_t primask = Compiler_EnterCritical();
+    for (PduIdType ch = 0; ch < CanTp_Cfg->numChannels; ch++) {
+        CanTp_ChannelType* st = &CanTp_Channels[ch];
+        // Chỉ một CF của kênh nằm trong mailbox; FC của phía nhận cùng TxPduId
+        // xong trước nó thì STmin bắt đầu sớm hơn tối đa một frame
+        if (CanTp_Cfg->Channels[ch].TxPduId == TxPduId && st->TxState == CANTP_TX_WAIT_CONF) {
+            st->TxState = CANTP_TX_SEND_CF;
+            st->TxDue = Gpt_GetTimeUs() + st->TxStminUs;
+            due = TRUE;
+        }
+    }
+    if (due) {
+        CanTp_Service();
+    }
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+}
+
+// ================================
+// RX (từ PduR, trong CAN RX ISR)
+// ================================
+void CanTp_RxIndication(PduIdType Channel, const uint8_t* data, uint8_t len)
+{
+    if (CanTp_Cfg == NULL_PTR || Channel >= CanTp_Cfg->numChannels || data == NULL_PTR || len == 0U) {
+        return;
+    }
+    CanTp_ChannelType* st = &CanTp_Channels[Channel];
+    if ((data[0] & 0xF0U) == CANTP_PCI_SF || (data[0] & 0xF0U) == CANTP_PCI_FF) {
+        CanTp_RxFirst(Channel, data, len);       // tự khóa quanh RxStart của ứng dụng
+        return;
+    }
+
+    boolean more = FALSE;
+    uint32_t primask = Compiler_EnterCritical();
+    switch (data[0] & 0xF0U) {
+    case CANTP_PCI_CF:
+        more = CanTp_RxConsecutive(Channel, data, len);
+        break;
+    case CANTP_PCI_FC:
+        if (st->TxState != CANTP_TX_WAIT_FC || len < 3U) {
+            break;
+        }
+        if ((data[0] & 0x0FU) == CANTP_FC_CTS) {
+            st->TxBs = data[1];
+            st->TxBlockLeft = data[1];
+            st->TxStminUs = CanTp_StminUs(data[2]);
+            st->TxState = CANTP_TX_SEND_CF;
+            st->TxDue = Gpt_GetTimeUs();          // CF đầu tiên gửi ngay
+        } else if ((data[0] & 0x0FU) == CANTP_FC_WAIT) {
+            st->TxTimerMs = CanTp_Cfg->Channels[Channel].TimeoutMs;
+        } else {
+            CanTp_TxFinish(Channel, E_NOT_OK);     // OVFLW hoặc FS không hợp lệ
+        }
+        break;
+    default:
+        break;
+    }
+    // FC CTS vừa nhận hoặc FC của phía nhận chưa gửi được
+    if (st->TxState == CANTP_TX_SEND_CF || st->RxFcPending) {
+        CanTp_Service();
+    }
+    Compiler_ExitCritical(primask);
+    CanTp_Notify();
+    if (more) {
+        CanTp_RxContinue(Channel);               // hết block: segment kế tiếp và FC
+    }
+}
@@ -0,0 +1,138 @@
+#ifndef CANTP_H_
+#define CANTP_H_
+
+/*
+ * CanTp: giao thức vận chuyển ISO 15765-2 trên CanIf (addressing thường, CAN ID 11 bit).
+ *
+ * Message dài hơn 7 byte được chia thành First Frame + Consecutive Frame,
+ * phía nhận điều tiết bằng Flow Control (BS: số CF mỗi block, STmin: khoảng
+ * cách tối thiểu giữa hai CF). Độ dài tới 4095 byte dùng FF 12 bit, dài hơn
+ * dùng FF 32 bit (ISO 15765-2:2016).
+ *
+ * RX không có buffer trung gian: byte của mỗi frame được chép thẳng vào
+ * segment do ứng dụng cấp (RxStart, RxSegment). BS trong FC được tính để
+ * block vừa đúng phần còn trống của segment hiện tại; hết segment mà ứng
+ * dụng chưa có segment mới thì gửi FC WAIT và hỏi lại ở CanTp_MainFunction.
+ * TX gửi thẳng từ buffer của người gọi (RAM hoặc flash), không chép.
+ *
+ * CF được gửi trong notification của một kênh Gpt one-shot: đúng STmin (độ
+ * phân giải 1 us) thay vì theo chu kỳ main function. STmin đếm từ lúc CF
+ * trước rời bus (CanTp_TxConfirmation, qua CanIf trong CAN TX ISR). STmin = 0
+ * thì lấp đủ 3 mailbox và quay lại sau CANTP_TX_RETRY_US (mailbox được gửi
+ * theo thứ tự yêu cầu, xem Can_Init). CanTp_MainFunction chỉ lo timeout và
+ * FC WAIT.
+ *
+ * Callback của ứng dụng chạy ngoài vùng khóa của CanTp, với ngắt mở (trong
+ * CAN RX ISR, ngắt Gpt hoặc main function): RxIndication/TxConfirmation được
+ * ghi lại trong vùng khóa và gọi sau khi mở khóa. Một callback ở main
+ * function có thể bị callback trong ISR chen ngang: chỉ trao đổi con trỏ và
+ * cờ, xử lý dữ liệu ở main loop.
+ */
+
+#include <stdint.h>
+#include "Std_Types.h"
+#include "Gpt.h"      // Gpt_ChannelType: lịch gửi CF theo STmin
+#include "PduR.h"     // PduIdType
+
+// =================== Hằng số giới hạn hệ thống (demo) ===================
+#define CANTP_MAX_CHANNELS   2
+
+// Thử lại khi 3 mailbox đều bận (~ nửa frame 8 byte ở 250 kbit/s)
+#ifndef CANTP_TX_RETRY_US
+#define CANTP_TX_RETRY_US    250U
+#endif
+
+// =================== Kiểu dữ liệu ===================
+/** Buffer do ứng dụng cấp cho dữ liệu nhận */
+typedef struct {
+    uint8_t* Data;
+    uint16_t Size;
+} CanTp_SegmentType;
+
+/**
+ * Bắt đầu nhận message Length byte (SF hoặc FF): điền segment đầu tiên.
+ * E_NOT_OK: từ chối (phía gửi nhận FC OVFLW).
+ */
+typedef Std_ReturnType (*CanTp_RxStartFuncType)(PduIdType Channel, uint32_t Length, CanTp_SegmentType* Segment);
+
+/**
+ * Segment đã đầy: vào Segment->Data/Size là phần đã ghi, ra là segment kế tiếp.
+ * E_NOT_OK: chưa có buffer (FC WAIT), gọi lại với cùng segment ở main function sau.
+ */
+typedef Std_ReturnType (*CanTp_RxSegmentFuncType)(PduIdType Channel, CanTp_SegmentType* Segment);
+
+/** Kết thúc nhận: E_OK khi đủ Length byte, E_NOT_OK khi bị hủy (timeout, sai SN, message mới) */
+typedef void (*CanTp_RxIndicationFuncType)(PduIdType Channel, Std_ReturnType Result);
+
+/** Kết thúc gửi: E_OK khi frame cuối đã vào mailbox, E_NOT_OK khi bị hủy (timeout, FC OVFLW) */
+typedef void (*CanTp_TxConfirmationFuncType)(PduIdType Channel, Std_ReturnType Result);
+
+// =================== Struct cấu hình ===================
+/** Một kênh = một cặp CAN ID (nhận: PduR route tới kênh, gửi: TxPduId của CanIf) */
+typedef struct {
+    PduIdType TxPduId;              // CanIf TxPduId: SF/FF/CF gửi đi và FC khi nhận
+    uint8_t   BlockSize;            // BS tối đa trong FC gửi đi (0 = không giới hạn)
+    uint8_t   STmin;                // STmin trong FC gửi đi (mã ISO: 0..0x7F ms, 0xF1..0xF9 = 100..900 us)
+    uint16_t  TimeoutMs;            // N_Bs (chờ FC), N_Cr (chờ CF) và N_As (chờ CF rời bus)
+    uint8_t   MaxWaits;             // số FC WAIT liên tiếp trước khi hủy nhận (N_WFTmax)
+    boolean   Padding;              // TRUE: frame luôn 8 byte
+    uint8_t   PaddingByte;
+} CanTp_ChannelConfigType;
+
+typedef struct {
+    const CanTp_ChannelConfigType* Channels;
+    uint8_t numChannels;
+    Gpt_ChannelType GptChannel;     // kênh one-shot, Notification = CanTp_GptNotification
+    uint16_t MainFunctionPeriodMs;  // chu kỳ gọi CanTp_MainFunction
+    CanTp_RxStartFuncType RxStart;
+    CanTp_RxSegmentFuncType RxSegment;
+    CanTp_RxIndicationFuncType RxIndication;
+    CanTp_TxConfirmationFuncType TxConfirmation;
+} CanTp_ConfigType;
+
+// =================== Prototype API CanTp ===================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Khởi tạo CanTp; mọi kênh về trạng thái rảnh
+ * @param ConfigPtr: bảng kênh và callback (dùng trực tiếp, không chép)
+ */
+void CanTp_Init(const CanTp_ConfigType* ConfigPtr);
+
+/**
+ * @brief Gửi message; Data phải giữ nguyên tới TxConfirmation
+ * @param Channel: chỉ số kênh
+ * @param Data: dữ liệu (RAM hoặc flash)
+ * @param Length: số byte (1..7: Single Frame)
+ * @return E_OK nếu đã bắt đầu, E_NOT_OK nếu kênh đang gửi hoặc mailbox đầy
+ */
+Std_ReturnType CanTp_Transmit(PduIdType Channel, const uint8_t* Data, uint32_t Length);
+
+/**
+ * @brief Timeout N_Bs/N_Cr và hỏi lại segment sau FC WAIT; gọi mỗi MainFunctionPeriodMs
+ */
+void CanTp_MainFunction(void);
+
+/**
+ * @brief Notification của kênh Gpt CanTp_ConfigType.GptChannel: gửi CF, gửi lại FC
+ */
+void CanTp_GptNotification(void);
+
+/**
+ * @brief Frame TxPduId của CanIf đã rời bus (CAN TX ISR); gọi từ callback
+ *        CanIf_ConfigType.txConfirmation. Bắt đầu đếm STmin tới CF kế tiếp
+ */
+void CanTp_TxConfirmation(PduIdType TxPduId);
+
+/**
+ * @brief Frame của kênh từ PduR (CAN RX ISR)
+ */
+void CanTp_RxIndication(PduIdType Channel, const uint8_t* data, uint8_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CANTP_H_
@@ -40,8 +40,7 @@ void CanIf_Init(const CanIf_ConfigType *ConfigPtr)
 
     // Đăng ký callback với CAN driver
     Can_RegisterRxCallback(CanIf_RxIndication);
-    // Nếu bạn có callback xác nhận gửi (Tx confirmation), hãy đăng ký hàm tương tự (tùy driver)
-    // Can_RegisterTxCallback(CanIf_TxConfirmation);
+    Can_RegisterTxCallback(CanIf_TxConfirmation);   // gọi trong CAN TX ISR khi frame đã rời bus
 }
 
 // ================================
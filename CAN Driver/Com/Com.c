@@ -0,0 +1,191 @@
+#include "Com.h"
+#include "PduR.h"     // PduR_ComTransmit
+
+// Mảng không được rỗng khi node chỉ gửi hoặc chỉ nhận
+#define COM_RX_SLOTS   ((COM_NUM_RX_PDUS) ? (COM_NUM_RX_PDUS) : 1U)
+#define COM_TX_SLOTS   ((COM_NUM_TX_PDUS) ? (COM_NUM_TX_PDUS) : 1U)
+
+#define COM_RX_RECEIVED   0x01U   // đã nhận ít nhất một frame
+#define COM_RX_UPDATED    0x02U   // frame mới chưa được Com_IsRxPduUpdated đọc
+
+// ===============================
+// Trạng thái runtime (static)
+// ===============================
+typedef struct {
+    uint16_t PeriodCounter;       // lần gọi còn lại tới lần gửi chu kỳ
+    uint16_t MdtCounter;          // lần gọi còn lại tới khi được gửi do trigger
+    uint8_t  Pending;             // có trigger chưa gửi
+} Com_TxStateType;
+
+static const Com_ConfigType* Com_Cfg = NULL_PTR;
+
+// Buffer được ghi trong ISR, đọc ở main loop: truy cập trong Compiler_EnterCritical
+static uint8_t Com_RxBuffer[COM_RX_SLOTS][8];
+static volatile uint8_t Com_RxFlags[COM_RX_SLOTS];
+static Gpt_TimestampType Com_RxTimestamp[COM_RX_SLOTS];
+
+static uint8_t Com_TxBuffer[COM_TX_SLOTS][8];
+static Com_TxStateType Com_TxState[COM_TX_SLOTS];
+
+// ================================
+// Khởi tạo
+// ================================
+void Com_Init(const Com_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR || ConfigPtr->numRxPdus > COM_NUM_RX_PDUS ||
+        ConfigPtr->numTxPdus > COM_NUM_TX_PDUS || ConfigPtr->numSignals > COM_NUM_SIGNALS) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < COM_RX_SLOTS; i++) {
+        for (uint8_t b = 0; b < 8U; b++) Com_RxBuffer[i][b] = 0U;
+        Com_RxFlags[i] = 0U;
+        Com_RxTimestamp[i] = 0U;
+    }
+    for (uint16_t i = 0; i < COM_TX_SLOTS; i++) {
+        for (uint8_t b = 0; b < 8U; b++) Com_TxBuffer[i][b] = 0U;
+        Com_TxState[i].PeriodCounter = 1U;   // lần gửi chu kỳ đầu tiên ở main function kế tiếp
+        Com_TxState[i].MdtCounter = 0U;
+        Com_TxState[i].Pending = 0U;
+    }
+    Com_Cfg = ConfigPtr;
+}
+
+// ================================
+// TX
+// ================================
+Std_ReturnType Com_SendSignal(Com_SignalIdType SignalId, const void* SignalDataPtr)
+{
+    if (Com_Cfg == NULL_PTR || SignalId >= Com_Cfg->numSignals || SignalDataPtr == NULL_PTR) {
+        return E_NOT_OK;
+    }
+    const Com_SignalConfigType* sig = &Com_Cfg->Signals[SignalId];
+    if (sig->Direction != COM_SIGNAL_TX || sig->Pack == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    uint32_t primask = Compiler_EnterCritical();
+    boolean changed = sig->Pack(Com_TxBuffer[sig->PduId], SignalDataPtr);
+    if (sig->Transfer == COM_TRIGGERED || (sig->Transfer == COM_TRIGGERED_ON_CHANGE && changed)) {
+        Com_TxState[sig->PduId].Pending = 1U;   // PERIODIC: bỏ qua trong Com_MainFunctionTx
+    }
+    Compiler_ExitCritical(primask);
+    return E_OK;
+}
+
+/* Chép shadow buffer ra stack rồi gửi ngoài critical section. Pending được xóa
+   cùng lúc chép: signal ghi (từ ISR) sau đó trigger lại lần gửi kế tiếp.
+   Mailbox đầy: trigger đã có được giữ lại để thử ở lần gọi sau. */
+static Std_ReturnType Com_SendPdu(PduIdType TxPduId)
+{
+    Com_TxStateType* st = &Com_TxState[TxPduId];
+    uint8_t data[8];
+    uint32_t primask = Compiler_EnterCritical();
+    for (uint8_t b = 0; b < 8U; b++) data[b] = Com_TxBuffer[TxPduId][b];
+    uint8_t pending = st->Pending;
+    st->Pending = 0U;
+    Compiler_ExitCritical(primask);
+
+    Std_ReturnType ret = PduR_ComTransmit(TxPduId, data, Com_Cfg->TxPdus[TxPduId].Dlc);
+    if (ret == E_OK) {
+        st->MdtCounter = Com_Cfg->TxPdus[TxPduId].MdtTicks;
+    } else if (pending) {
+        st->Pending = 1U;
+    }
+    return ret;
+}
+
+Std_ReturnType Com_TriggerIPDUSend(PduIdType TxPduId)
+{
+    if (Com_Cfg == NULL_PTR || TxPduId >= Com_Cfg->numTxPdus) {
+        return E_NOT_OK;
+    }
+    return Com_SendPdu(TxPduId);
+}
+
+void Com_MainFunctionTx(void)
+{
+    if (Com_Cfg == NULL_PTR) {
+        return;
+    }
+    for (PduIdType i = 0; i < Com_Cfg->numTxPdus; i++) {
+        const Com_TxPduConfigType* cfg = &Com_Cfg->TxPdus[i];
+        Com_TxStateType* st = &Com_TxState[i];
+        boolean send = FALSE;
+
+        if (st->MdtCounter != 0U) {
+            st->MdtCounter--;
+        }
+        if (cfg->Mode != COM_TX_MODE_DIRECT && --st->PeriodCounter == 0U) {
+            st->PeriodCounter = cfg->PeriodTicks;
+            send = TRUE;
+        }
+        if (cfg->Mode != COM_TX_MODE_PERIODIC && st->Pending && st->MdtCounter == 0U) {
+            send = TRUE;
+        }
+        if (send) {
+            (void)Com_SendPdu(i);   // lần gửi chu kỳ không thành công thì bỏ, chờ chu kỳ sau
+        }
+    }
+}
+
+// ================================
+// RX
+// ================================
+void Com_RxIndication(PduIdType RxPduId, const uint8_t* data, uint8_t len)
+{
+    if (Com_Cfg == NULL_PTR || RxPduId >= Com_Cfg->numRxPdus || data == NULL_PTR ||
+        len < Com_Cfg->RxPdus[RxPduId].Dlc) {
+        return;
+    }
+    Gpt_TimestampType now = Gpt_GetTimestamp();
+    if (len > 8U) len = 8U;
+
+    // Chạy trong CAN RX ISR: main loop chỉ đọc buffer trong critical section
+    uint32_t primask = Compiler_EnterCritical();
+    for (uint8_t b = 0; b < len; b++) Com_RxBuffer[RxPduId][b] = data[b];
+    Com_RxTimestamp[RxPduId] = now;
+    Com_RxFlags[RxPduId] = COM_RX_RECEIVED | COM_RX_UPDATED;
+    Compiler_ExitCritical(primask);
+}
+
+Std_ReturnType Com_ReceiveSignal(Com_SignalIdType SignalId, void* SignalDataPtr)
+{
+    if (Com_Cfg == NULL_PTR || SignalId >= Com_Cfg->numSignals || SignalDataPtr == NULL_PTR) {
+        return E_NOT_OK;
+    }
+    const Com_SignalConfigType* sig = &Com_Cfg->Signals[SignalId];
+    if (sig->Direction != COM_SIGNAL_RX || sig->Unpack == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    // Unpack chỉ vài lệnh (ngắn hơn chép cả buffer ra stack): chạy luôn khi đã khóa ngắt
+    uint32_t primask = Compiler_EnterCritical();
+    sig->Unpack(Com_RxBuffer[sig->PduId], SignalDataPtr);
+    uint8_t flags = Com_RxFlags[sig->PduId];
+    Compiler_ExitCritical(primask);
+    return (flags & COM_RX_RECEIVED) ? E_OK : E_NOT_OK;
+}
+
+boolean Com_IsRxPduUpdated(PduIdType RxPduId)
+{
+    if (Com_Cfg == NULL_PTR || RxPduId >= Com_Cfg->numRxPdus) {
+        return FALSE;
+    }
+    uint32_t primask = Compiler_EnterCritical();
+    uint8_t flags = Com_RxFlags[RxPduId];
+    Com_RxFlags[RxPduId] = (uint8_t)(flags & ~COM_RX_UPDATED);
+    Compiler_ExitCritical(primask);
+    return (flags & COM_RX_UPDATED) ? TRUE : FALSE;
+}
+
+Gpt_TimestampType Com_GetRxPduTimestamp(PduIdType RxPduId)
+{
+    if (Com_Cfg == NULL_PTR || RxPduId >= Com_Cfg->numRxPdus) {
+        return 0U;
+    }
+    uint32_t primask = Compiler_EnterCritical();   // 64 bit: hai lần đọc
+    Gpt_TimestampType ts = Com_RxTimestamp[RxPduId];
+    Compiler_ExitCritical(primask);
+    return ts;
+}
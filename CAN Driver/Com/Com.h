@@ -0,0 +1,144 @@
+#ifndef COM_H_
+#define COM_H_
+
+/*
+ * Com: signal <-> I-PDU (frame CAN) phía trên PduR/CanIf.
+ *
+ * Bảng signal/I-PDU và hàm pack/unpack riêng cho từng signal được sinh bởi
+ * Host/comgen từ file .dbc (Com_Cfg.c/.h, không sửa tay). Mỗi hàm chỉ gồm
+ * vài phép shift/mask trên đúng các byte của signal, không có vòng lặp bit.
+ *
+ * RX: Com_RxIndication (trong CAN RX ISR) chỉ chép frame vào shadow buffer
+ *     của I-PDU; signal được tách ra khi ứng dụng gọi Com_ReceiveSignal,
+ *     nên frame có 30 signal mà ứng dụng chỉ đọc 2 thì chỉ tốn 2 lần unpack.
+ * TX: Com_SendSignal pack vào shadow buffer TX; Com_MainFunctionTx (gọi mỗi
+ *     COM_MAIN_FUNCTION_PERIOD_MS) gửi theo mode của I-PDU:
+ *       PERIODIC  mỗi PeriodTicks lần gọi
+ *       DIRECT    khi có signal trigger (TRIGGERED: mỗi lần ghi,
+ *                 TRIGGERED_ON_CHANGE: khi giá trị đổi)
+ *       MIXED     cả hai
+ *     MdtTicks (GenMsgDelayTime) giới hạn khoảng cách tối thiểu giữa hai
+ *     lần gửi do trigger.
+ */
+
+#include <stdint.h>
+#include "Std_Types.h"
+#include "Gpt.h"      // Gpt_TimestampType: thời điểm nhận I-PDU
+#include "PduR.h"     // PduIdType
+
+typedef uint16_t Com_SignalIdType;
+
+// =================== Enum cấu hình (giá trị do comgen sinh) ===================
+typedef enum {
+    COM_TX_MODE_PERIODIC = 0,
+    COM_TX_MODE_DIRECT,
+    COM_TX_MODE_MIXED
+} Com_TxModeType;
+
+typedef enum {
+    COM_SIGNAL_RX = 0,
+    COM_SIGNAL_TX
+} Com_SignalDirectionType;
+
+typedef enum {
+    COM_PENDING = 0,              // chỉ cập nhật buffer, gửi theo chu kỳ
+    COM_TRIGGERED,                // mỗi lần Com_SendSignal đều yêu cầu gửi
+    COM_TRIGGERED_ON_CHANGE       // yêu cầu gửi khi giá trị raw thay đổi
+} Com_TransferPropertyType;
+
+// Hàm sinh cho từng signal: value trỏ tới biến đúng kiểu ghi trong Com_Cfg.h
+typedef void    (*Com_UnpackFuncType)(const uint8_t* pdu, void* value);
+typedef boolean (*Com_PackFuncType)(uint8_t* pdu, const void* value);   // TRUE nếu byte trong PDU đổi
+
+// =================== Struct cấu hình ===================
+typedef struct {
+    uint8_t Dlc;                  // frame ngắn hơn bị bỏ (signal sẽ đọc sai)
+} Com_RxPduConfigType;
+
+typedef struct {
+    Com_TxModeType Mode;
+    uint16_t PeriodTicks;         // chu kỳ, tính theo lần gọi Com_MainFunctionTx (0: DIRECT)
+    uint16_t MdtTicks;            // khoảng cách tối thiểu giữa hai lần gửi do trigger
+    uint8_t Dlc;
+} Com_TxPduConfigType;
+
+typedef struct {
+    PduIdType PduId;                        // I-PDU chứa signal (RX hoặc TX theo Direction)
+    Com_SignalDirectionType Direction;
+    Com_TransferPropertyType Transfer;      // chỉ dùng cho TX
+    Com_UnpackFuncType Unpack;              // RX
+    Com_PackFuncType Pack;                  // TX
+} Com_SignalConfigType;
+
+typedef struct {
+    const Com_RxPduConfigType* RxPdus;
+    uint16_t numRxPdus;
+    const Com_TxPduConfigType* TxPdus;
+    uint16_t numTxPdus;
+    const Com_SignalConfigType* Signals;
+    uint16_t numSignals;
+} Com_ConfigType;
+
+#include "Com_Cfg.h"  // ComConf_* ID, số lượng PDU/signal (sinh từ .dbc)
+
+extern const Com_ConfigType Com_Config;
+
+// =================== Prototype API Com ===================
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Khởi tạo Com: xóa shadow buffer (giá trị đầu của mọi signal là 0)
+ * @param ConfigPtr: &Com_Config (Com_Cfg.c)
+ */
+void Com_Init(const Com_ConfigType* ConfigPtr);
+
+/**
+ * @brief Ghi signal TX vào shadow buffer; trigger gửi theo Transfer property
+ * @param SignalId: ComConf_ComSignal_*
+ * @param SignalDataPtr: biến có kiểu ghi trong Com_Cfg.h (giá trị raw)
+ * @return E_OK, E_NOT_OK nếu signal không phải TX hoặc chưa Com_Init
+ */
+Std_ReturnType Com_SendSignal(Com_SignalIdType SignalId, const void* SignalDataPtr);
+
+/**
+ * @brief Tách signal RX từ shadow buffer (unpack lúc gọi, trong critical section ngắn)
+ * @param SignalId: ComConf_ComSignal_*
+ * @param SignalDataPtr: biến có kiểu ghi trong Com_Cfg.h (nhận giá trị raw)
+ * @return E_OK, E_NOT_OK nếu I-PDU chưa nhận lần nào (giá trị trả về là 0)
+ *         hoặc signal không phải RX
+ */
+Std_ReturnType Com_ReceiveSignal(Com_SignalIdType SignalId, void* SignalDataPtr);
+
+/**
+ * @brief TRUE một lần sau mỗi frame mới của I-PDU RX (xóa cờ khi đọc)
+ */
+boolean Com_IsRxPduUpdated(PduIdType RxPduId);
+
+/**
+ * @brief Thời điểm (timebase Gpt) nhận frame gần nhất của I-PDU RX, 0 nếu chưa nhận
+ */
+Gpt_TimestampType Com_GetRxPduTimestamp(PduIdType RxPduId);
+
+/**
+ * @brief Gửi I-PDU TX ngay (không chờ main function, bỏ qua MDT)
+ * @return E_OK nếu frame đã vào mailbox
+ */
+Std_ReturnType Com_TriggerIPDUSend(PduIdType TxPduId);
+
+/**
+ * @brief Gửi I-PDU TX theo chu kỳ / trigger; gọi mỗi COM_MAIN_FUNCTION_PERIOD_MS
+ */
+void Com_MainFunctionTx(void);
+
+/**
+ * @brief Frame I-PDU RX từ PduR (CAN RX ISR): chép vào shadow buffer
+ */
+void Com_RxIndication(PduIdType RxPduId, const uint8_t* data, uint8_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // COM_H_
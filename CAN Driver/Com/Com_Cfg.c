@@ -0,0 +1,137 @@
+/*
+ * Com_Cfg.c
+ * Com configuration of node ECU, generated by Host/comgen from Com/network.dbc
+ * Do not edit: change the .dbc file and rebuild
+ */
+
+#include "Com.h"
+
+/* LedRequest: Intel bit 0, 1 bit, unsigned */
+static void Com_Unpack_LedRequest(const uint8_t* pdu, void* value) {
+    uint32_t raw = (uint32_t)(pdu[0] & 0x01U);
+    *(uint8_t*)value = (uint8_t)raw;
+}
+
+/* Mode: Intel bit 1, 3 bits, unsigned */
+static void Com_Unpack_Mode(const uint8_t* pdu, void* value) {
+    uint32_t raw = (uint32_t)(pdu[0] & 0x0EU) >> 1;
+    *(uint8_t*)value = (uint8_t)raw;
+}
+
+/* PwmDuty: Intel bit 8, 16 bits, unsigned */
+static void Com_Unpack_PwmDuty(const uint8_t* pdu, void* value) {
+    uint32_t raw = (uint32_t)pdu[1]
+        | ((uint32_t)pdu[2] << 8);
+    *(uint16_t*)value = (uint16_t)raw;
+}
+
+/* Setpoint: Motorola bit 31, 12 bits, signed */
+static void Com_Unpack_Setpoint(const uint8_t* pdu, void* value) {
+    uint32_t raw = ((uint32_t)(pdu[4] & 0xF0U) >> 4)
+        | ((uint32_t)pdu[3] << 4);
+    *(int16_t*)value = (int16_t)(int32_t)((raw ^ 0x800UL) - 0x800UL);
+}
+
+/* Sequence: Intel bit 56, 8 bits, unsigned */
+static void Com_Unpack_Sequence(const uint8_t* pdu, void* value) {
+    uint32_t raw = (uint32_t)pdu[7];
+    *(uint8_t*)value = (uint8_t)raw;
+}
+
+/* BootCount: Intel bit 0, 16 bits, unsigned */
+static boolean Com_Pack_BootCount(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const uint16_t*)value;
+    uint8_t b0 = (uint8_t)raw;
+    uint8_t b1 = (uint8_t)(raw >> 8);
+    uint8_t diff = (uint8_t)((pdu[0] ^ b0) | (pdu[1] ^ b1));
+    pdu[0] = b0;
+    pdu[1] = b1;
+    return (boolean)(diff != 0U);
+}
+
+/* RxCount: Intel bit 16, 16 bits, unsigned */
+static boolean Com_Pack_RxCount(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const uint16_t*)value;
+    uint8_t b2 = (uint8_t)raw;
+    uint8_t b3 = (uint8_t)(raw >> 8);
+    uint8_t diff = (uint8_t)((pdu[2] ^ b2) | (pdu[3] ^ b3));
+    pdu[2] = b2;
+    pdu[3] = b3;
+    return (boolean)(diff != 0U);
+}
+
+/* UptimeMs: Intel bit 32, 32 bits, unsigned */
+static boolean Com_Pack_UptimeMs(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const uint32_t*)value;
+    uint8_t b4 = (uint8_t)raw;
+    uint8_t b5 = (uint8_t)(raw >> 8);
+    uint8_t b6 = (uint8_t)(raw >> 16);
+    uint8_t b7 = (uint8_t)(raw >> 24);
+    uint8_t diff = (uint8_t)((pdu[4] ^ b4) | (pdu[5] ^ b5) | (pdu[6] ^ b6) | (pdu[7] ^ b7));
+    pdu[4] = b4;
+    pdu[5] = b5;
+    pdu[6] = b6;
+    pdu[7] = b7;
+    return (boolean)(diff != 0U);
+}
+
+/* LastSequence: Intel bit 0, 8 bits, unsigned */
+static boolean Com_Pack_LastSequence(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const uint8_t*)value;
+    uint8_t b0 = (uint8_t)raw;
+    uint8_t diff = (uint8_t)(pdu[0] ^ b0);
+    pdu[0] = b0;
+    return (boolean)(diff != 0U);
+}
+
+/* SetpointEcho: Motorola bit 15, 12 bits, signed */
+static boolean Com_Pack_SetpointEcho(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const int16_t*)value;
+    uint8_t b2 = (uint8_t)((pdu[2] & 0x0FU) | ((raw << 4) & 0xF0U));
+    uint8_t b1 = (uint8_t)(raw >> 4);
+    uint8_t diff = (uint8_t)((pdu[2] ^ b2) | (pdu[1] ^ b1));
+    pdu[2] = b2;
+    pdu[1] = b1;
+    return (boolean)(diff != 0U);
+}
+
+/* LedState: Intel bit 24, 1 bit, unsigned */
+static boolean Com_Pack_LedState(uint8_t* pdu, const void* value) {
+    uint32_t raw = (uint32_t)*(const uint8_t*)value;
+    uint8_t b3 = (uint8_t)((pdu[3] & 0xFEU) | (raw & 0x01U));
+    uint8_t diff = (uint8_t)(pdu[3] ^ b3);
+    pdu[3] = b3;
+    return (boolean)(diff != 0U);
+}
+
+static const Com_RxPduConfigType Com_RxPdus[COM_NUM_RX_PDUS] = {
+    [ComConf_ComIPdu_TesterCmd] = { .Dlc = 8 },
+};
+
+static const Com_TxPduConfigType Com_TxPdus[COM_NUM_TX_PDUS] = {
+    [ComConf_ComIPdu_EcuStatus] = { .Mode = COM_TX_MODE_MIXED, .PeriodTicks = 100, .MdtTicks = 2, .Dlc = 8 },
+    [ComConf_ComIPdu_EcuEvent] = { .Mode = COM_TX_MODE_DIRECT, .PeriodTicks = 0, .MdtTicks = 5, .Dlc = 4 },
+};
+
+static const Com_SignalConfigType Com_Signals[COM_NUM_SIGNALS] = {
+    [ComConf_ComSignal_LedRequest] = { ComConf_ComIPdu_TesterCmd, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_LedRequest, NULL_PTR },
+    [ComConf_ComSignal_Mode] = { ComConf_ComIPdu_TesterCmd, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_Mode, NULL_PTR },
+    [ComConf_ComSignal_PwmDuty] = { ComConf_ComIPdu_TesterCmd, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_PwmDuty, NULL_PTR },
+    [ComConf_ComSignal_Setpoint] = { ComConf_ComIPdu_TesterCmd, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_Setpoint, NULL_PTR },
+    [ComConf_ComSignal_Sequence] = { ComConf_ComIPdu_TesterCmd, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_Sequence, NULL_PTR },
+    [ComConf_ComSignal_BootCount] = { ComConf_ComIPdu_EcuStatus, COM_SIGNAL_TX, COM_TRIGGERED_ON_CHANGE, NULL_PTR, Com_Pack_BootCount },
+    [ComConf_ComSignal_RxCount] = { ComConf_ComIPdu_EcuStatus, COM_SIGNAL_TX, COM_PENDING, NULL_PTR, Com_Pack_RxCount },
+    [ComConf_ComSignal_UptimeMs] = { ComConf_ComIPdu_EcuStatus, COM_SIGNAL_TX, COM_PENDING, NULL_PTR, Com_Pack_UptimeMs },
+    [ComConf_ComSignal_LastSequence] = { ComConf_ComIPdu_EcuEvent, COM_SIGNAL_TX, COM_TRIGGERED, NULL_PTR, Com_Pack_LastSequence },
+    [ComConf_ComSignal_SetpointEcho] = { ComConf_ComIPdu_EcuEvent, COM_SIGNAL_TX, COM_TRIGGERED_ON_CHANGE, NULL_PTR, Com_Pack_SetpointEcho },
+    [ComConf_ComSignal_LedState] = { ComConf_ComIPdu_EcuEvent, COM_SIGNAL_TX, COM_TRIGGERED_ON_CHANGE, NULL_PTR, Com_Pack_LedState },
+};
+
+const Com_ConfigType Com_Config = {
+    .RxPdus     = Com_RxPdus,
+    .numRxPdus  = COM_NUM_RX_PDUS,
+    .TxPdus     = Com_TxPdus,
+    .numTxPdus  = COM_NUM_TX_PDUS,
+    .Signals    = Com_Signals,
+    .numSignals = COM_NUM_SIGNALS
+};
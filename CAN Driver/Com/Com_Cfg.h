@@ -0,0 +1,37 @@
+/*
+ * Com_Cfg.h
+ * Com configuration of node ECU, generated by Host/comgen from Com/network.dbc
+ * Do not edit: change the .dbc file and rebuild
+ */
+
+#ifndef COM_CFG_H
+#define COM_CFG_H
+
+/* Period of Com_MainFunctionTx in ms (GenMsgCycleTime/GenMsgDelayTime are counted in calls) */
+#define COM_MAIN_FUNCTION_PERIOD_MS  10U
+
+#define COM_NUM_RX_PDUS              1U
+#define COM_NUM_TX_PDUS              2U
+#define COM_NUM_SIGNALS              11U
+
+/* RX I-PDUs */
+#define ComConf_ComIPdu_TesterCmd                0U    /* CAN ID 0x123, DLC 8, from TESTER */
+
+/* TX I-PDUs */
+#define ComConf_ComIPdu_EcuStatus                0U    /* CAN ID 0x321, DLC 8, MIXED 1000 ms */
+#define ComConf_ComIPdu_EcuEvent                 1U    /* CAN ID 0x322, DLC 4, DIRECT */
+
+/* Signals: value type for Com_SendSignal/Com_ReceiveSignal, physical = raw * factor + offset */
+#define ComConf_ComSignal_LedRequest             0U    /* RX TesterCmd, uint8_t, 1 bit, * 1 + 0 */
+#define ComConf_ComSignal_Mode                   1U    /* RX TesterCmd, uint8_t, 3 bit, * 1 + 0 */
+#define ComConf_ComSignal_PwmDuty                2U    /* RX TesterCmd, uint16_t, 16 bit, * 0.1 + 0 % */
+#define ComConf_ComSignal_Setpoint               3U    /* RX TesterCmd, int16_t, 12 bit, * 0.5 + 0 degC */
+#define ComConf_ComSignal_Sequence               4U    /* RX TesterCmd, uint8_t, 8 bit, * 1 + 0 */
+#define ComConf_ComSignal_BootCount              5U    /* TX EcuStatus, uint16_t, 16 bit, * 1 + 0 */
+#define ComConf_ComSignal_RxCount                6U    /* TX EcuStatus, uint16_t, 16 bit, * 1 + 0 */
+#define ComConf_ComSignal_UptimeMs               7U    /* TX EcuStatus, uint32_t, 32 bit, * 1 + 0 ms */
+#define ComConf_ComSignal_LastSequence           8U    /* TX EcuEvent, uint8_t, 8 bit, * 1 + 0 */
+#define ComConf_ComSignal_SetpointEcho           9U    /* TX EcuEvent, int16_t, 12 bit, * 0.5 + 0 degC */
+#define ComConf_ComSignal_LedState               10U   /* TX EcuEvent, uint8_t, 1 bit, * 1 + 0 */
+
+#endif /* COM_CFG_H */
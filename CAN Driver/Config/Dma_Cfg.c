@@ -0,0 +1,43 @@
+
+#include "Dma_Cfg.h"
+
+
+
+/* All DMA1 vectors forward to the DMA driver, which calls the notification
+ * of whichever driver currently owns the channel. Drivers no longer need
+ * to know which vector serves their request line. */
+
+void DMA1_Channel1_IRQHandler(void)
+{
+    Dma_IrqHandler(1);
+}
+
+void DMA1_Channel2_IRQHandler(void)
+{
+    Dma_IrqHandler(2);
+}
+
+void DMA1_Channel3_IRQHandler(void)
+{
+    Dma_IrqHandler(3);
+}
+
+void DMA1_Channel4_IRQHandler(void)
+{
+    Dma_IrqHandler(4);
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+    Dma_IrqHandler(5);
+}
+
+void DMA1_Channel6_IRQHandler(void)
+{
+    Dma_IrqHandler(6);
+}
+
+void DMA1_Channel7_IRQHandler(void)
+{
+    Dma_IrqHandler(7);
+}
@@ -0,0 +1,11 @@
+#include "Gpt_Cfg.h"
+
+
+
+/* TIM2 carries the GPT timebase (GptCfg.HwTimer = GPT_HW_TIM2): its update
+ * interrupt extends the 16-bit counter used for the CAN RX timestamps */
+
+void TIM2_IRQHandler(void)
+{
+    Gpt_IrqHandler();
+}
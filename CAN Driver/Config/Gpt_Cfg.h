@@ -0,0 +1,8 @@
+#ifndef GPT_CFG_H
+#define GPT_CFG_H
+
+#include "Gpt.h"
+
+void TIM2_IRQHandler(void);
+
+#endif // GPT_CFG_H
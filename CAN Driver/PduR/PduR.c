@@ -0,0 +1,55 @@
+#include "PduR.h"
+#include "Com.h"      // Com_RxIndication
+#include "CanTp.h"    // CanTp_RxIndication
+#include "canif.h"    // CanIf_Transmit
+
+static const PduR_ConfigType* PduR_Cfg = NULL_PTR;
+
+// ================================
+// Khởi tạo
+// ================================
+void PduR_Init(const PduR_ConfigType* ConfigPtr)
+{
+    if (ConfigPtr == NULL_PTR) {
+        return;
+    }
+    PduR_Cfg = ConfigPtr;
+}
+
+// ================================
+// TX: Com -> CanIf
+// ================================
+Std_ReturnType PduR_ComTransmit(PduIdType TxPduId, const uint8_t* data, uint8_t len)
+{
+    if (PduR_Cfg == NULL_PTR || TxPduId >= PduR_Cfg->numComTxRoutes) {
+        return E_NOT_OK;
+    }
+
+    int ret = CanIf_Transmit(PduR_Cfg->ComTxRoutes[TxPduId], data, len);
+    return (ret == 0) ? E_OK : E_NOT_OK;
+}
+
+// ================================
+// RX: CanIf -> Com / gateway
+// ================================
+void PduR_CanIfRxIndication(uint32_t RxPduId, uint8_t* data, uint8_t len)
+{
+    if (PduR_Cfg == NULL_PTR || RxPduId >= PduR_Cfg->numRxRoutes) {
+        return;
+    }
+    const PduR_RxRouteType* route = &PduR_Cfg->RxRoutes[RxPduId];
+    for (uint8_t i = 0; i < route->numDests && i < PDUR_MAX_DESTS; i++) {
+        const PduR_DestPduType* dest = &route->Dests[i];
+        switch (dest->Module) {
+        case PDUR_DEST_COM:
+            Com_RxIndication(dest->PduId, data, len);
+            break;
+        case PDUR_DEST_CANTP:
+            CanTp_RxIndication(dest->PduId, data, len);
+            break;
+        default:
+            (void)CanIf_Transmit(dest->PduId, data, len);   // mailbox đầy: frame bị bỏ
+            break;
+        }
+    }
+}
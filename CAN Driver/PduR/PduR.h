@@ -0,0 +1,69 @@
+#ifndef PDUR_H_
+#define PDUR_H_
+
+/*
+ * PduR: định tuyến I-PDU giữa CanIf và Com / CanTp.
+ *
+ * RX: mỗi RxPduId của CanIf có tối đa PDUR_MAX_DESTS đích: một I-PDU RX của
+ *     Com, một kênh CanTp (message nhiều frame) và/hoặc một TxPduId của CanIf
+ *     (gateway: frame được gửi lại nguyên vẹn với CAN ID khác, ngay trong
+ *     CAN RX ISR, không qua Com).
+ * TX: mỗi I-PDU TX của Com ứng với một TxPduId của CanIf.
+ */
+
+#include <stdint.h>
+#include "Std_Types.h"
+
+#define PDUR_MAX_DESTS   2U
+
+/** ID logic của I-PDU (Com, CanIf) */
+typedef uint16_t PduIdType;
+
+typedef enum {
+    PDUR_DEST_COM = 0,            // Com_RxIndication
+    PDUR_DEST_CANIF,              // CanIf_Transmit (gateway)
+    PDUR_DEST_CANTP               // CanTp_RxIndication
+} PduR_DestModuleType;
+
+typedef struct {
+    PduR_DestModuleType Module;
+    PduIdType PduId;              // I-PDU RX của Com, TxPduId của CanIf hoặc kênh CanTp
+} PduR_DestPduType;
+
+typedef struct {
+    uint8_t numDests;
+    PduR_DestPduType Dests[PDUR_MAX_DESTS];
+} PduR_RxRouteType;
+
+typedef struct {
+    const PduR_RxRouteType* RxRoutes;     // chỉ số: RxPduId của CanIf
+    uint16_t numRxRoutes;
+    const PduIdType* ComTxRoutes;         // chỉ số: I-PDU TX của Com -> TxPduId của CanIf
+    uint16_t numComTxRoutes;
+} PduR_ConfigType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Khởi tạo PduR (bảng định tuyến dùng trực tiếp, không chép)
+ */
+void PduR_Init(const PduR_ConfigType* ConfigPtr);
+
+/**
+ * @brief Com gửi I-PDU TX xuống CanIf
+ * @return E_OK nếu frame đã vào mailbox
+ */
+Std_ReturnType PduR_ComTransmit(PduIdType TxPduId, const uint8_t* data, uint8_t len);
+
+/**
+ * @brief Callback nhận của CanIf (CanIf_ConfigType.rxIndication), chạy trong CAN RX ISR
+ */
+void PduR_CanIfRxIndication(uint32_t RxPduId, uint8_t* data, uint8_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PDUR_H_
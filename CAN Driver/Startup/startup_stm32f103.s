@@ -12,6 +12,7 @@
     .extern _ebss
     .extern _estack
     .extern SystemInit
+    .extern Boot_Init
     .extern __libc_init_array
     .extern main
 
@@ -89,34 +90,73 @@ g_pfnVectors:
     .align 2
     .global Reset_Handler
 Reset_Handler:
-    /* Copy .data from flash to sram */
+    /* Start the DWT cycle counter: CYCCNT = cycles since reset (boot-phase stamps) */
+    ldr r0, =0xE000EDFC              /* CoreDebug DEMCR */
+    ldr r1, [r0]
+    orr r1, r1, #0x01000000          /* TRCENA */
+    str r1, [r0]
+    ldr r0, =0xE0001000              /* DWT CTRL, CYCCNT at +4 */
+    movs r1, #0
+    str r1, [r0, #4]
+    ldr r1, [r0]
+    orr r1, r1, #1                   /* CYCCNTENA */
+    str r1, [r0]
+
+    /* Clocks first (only here; main does not call SystemInit again): the
+       copy loops below then run at 72 MHz instead of the 8 MHz HSI.
+       SystemInit uses only the stack, not .data/.bss */
+    bl SystemInit
+    ldr r0, =0xE0001004
+    ldr r4, [r0]                     /* r4 = CYCCNT after clock setup, for Boot_Init */
+
+    /* Copy .data (including .ramfunc code) from flash to sram: 16 bytes per
+       LDM/STM, then the remaining words (the linker script aligns to 4) */
     ldr r0, =_sidata
     ldr r1, =_sdata
     ldr r2, =_edata
+    subs r2, r2, r1
 1:
-    cmp r1, r2
-    ittt lt
-    ldrlt r3, [r0], #4
-    strlt r3, [r1], #4
-    blt 1b
+    subs r2, r2, #16
+    itt ge
+    ldmge r0!, {r3, r5, r6, r7}
+    stmge r1!, {r3, r5, r6, r7}
+    bge 1b
+    adds r2, r2, #16
+2:
+    subs r2, r2, #4
+    itt ge
+    ldrge r3, [r0], #4
+    strge r3, [r1], #4
+    bge 2b
 
-    /* Zero .bss */
+    /* Zero .bss, same way (.noinit is left alone) */
     ldr r0, =_sbss
     ldr r1, =_ebss
+    subs r1, r1, r0
     movs r2, #0
-2:
-    cmp r0, r1
-    itt lt
-    strlt r2, [r0], #4
-    blt 2b
+    movs r3, #0
+    movs r5, #0
+    movs r6, #0
+3:
+    subs r1, r1, #16
+    it ge
+    stmge r0!, {r2, r3, r5, r6}
+    bge 3b
+    adds r1, r1, #16
+4:
+    subs r1, r1, #4
+    it ge
+    strge r2, [r0], #4
+    bge 4b
 
-    /* System init + C runtime + main */
-    bl SystemInit
+    /* Boot record (clocks + RAM init stamps) + C runtime + main */
+    mov r0, r4
+    bl Boot_Init
     bl __libc_init_array
     bl main
 
 /* fallback nếu main return */
-3:  b 3b
+5:  b 5b
 
 /* ----------- Weak Default Handlers ----------- */
     .macro WEAK_DEFAULT name
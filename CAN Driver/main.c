@@ -5,12 +5,27 @@
 #include "stm32f10x_usart.h"
 #include "misc.h"
 
+#include "Mcu.h"     // Mcu_Init, Mcu_InitClock, clock peripheral đếm tham chiếu
+#include "Gpt.h"     // timebase us 64-bit: timestamp frame CAN RX; tick 10 ms của Com; STmin CanTp
+#include "Gpt_Cfg.h" // TIM2_IRQHandler -> Gpt_IrqHandler
+#include "Port.h"    // Port_ConfigType, Port_Init
+#include "Dma.h"     // Dma_Init (kênh TX của Uart)
+#include "Uart.h"    // Uart_Init, Uart_Write, Uart_Fmt*
+#include "Trace.h"   // TRACE_ENABLE: trace nhị phân thay cho log text
 #include "can.h"     // Can_ConfigType, Can_Init, ...
 #include "canif.h"   // CanIf_ConfigType, CanIf_Init, ...
+#include "PduR.h"    // định tuyến CanIf <-> Com / CanTp, gateway
+#include "Com.h"     // signal (Com_Cfg sinh từ Com/network.dbc)
+#include "CanTp.h"   // ISO 15765-2: message nhiều frame trên 0x7E0/0x7E8
+#include "Boot.h"    // mốc thời gian từng pha boot (RAM no-init)
 
-/* ================= UART1 115200-8N1 (PA9 TX, PA10 RX) ================= */
-static void UART1_Init_115200_8N1(void){
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA | RCC_APB2Periph_USART1, ENABLE);
+/* ECU phải trả lời trên CAN trong 50 ms sau khi cấp nguồn */
+#define APP_BOOT_DEADLINE_US  50000UL
+
+/* ================= UART1 pins (PA9 TX, PA10 RX) =================
+   USART1 + DMA1 Channel4 do Uart_Init cấu hình (MCAL/Uart). */
+static void UART1_InitPins(void){
+    (void)Mcu_EnablePeripheral(MCU_PERIPH_GPIOA);
 
     GPIO_InitTypeDef gpio;
     // PA9 TX
@@ -22,51 +37,59 @@ static void UART1_Init_115200_8N1(void){
     gpio.GPIO_Pin   = GPIO_Pin_10;
     gpio.GPIO_Mode  = GPIO_Mode_IN_FLOATING;
     GPIO_Init(GPIOA, &gpio);
-
-    USART_InitTypeDef us;
-    USART_StructInit(&us);
-    us.USART_BaudRate = 115200;
-    us.USART_Mode     = USART_Mode_Tx | USART_Mode_Rx;
-    USART_Init(USART1, &us);
-    USART_Cmd(USART1, ENABLE);
 }
 
-static inline void UART1_WriteByte(uint8_t b){
-    while(!(USART1->SR & USART_SR_TXE));
-    USART1->DR = b;
-}
-static void UART1_WriteStr(const char* s){ while(*s) UART1_WriteByte((uint8_t)*s++); }
-static inline char nyb2hex(uint8_t n){ n &= 0xF; return (n<10)?('0'+n):('A'+n-10); }
-static void UART1_WriteHex2(uint8_t b){
-    UART1_WriteByte(nyb2hex(b>>4));
-    UART1_WriteByte(nyb2hex(b));
-}
-static void UART1_WriteHex3_StdID(uint16_t id11){
-    // In 3 hex digits cho 11-bit ID (0x000..0x7FF)
-    UART1_WriteHex2((id11>>8)&0xFF);
-    UART1_WriteHex2(id11&0xFF);
-}
+/* ================= Clock =================
+   72 MHz (PCLK1 36 MHz cho bảng bit timing CAN bên dưới); tắt clock ngoại vi
+   không ai dùng (bootloader / debugger để lại) */
+static const Mcu_ConfigType McuCfg = {
+    .ClockSetting     = MCU_CLOCK_72MHZ,
+    .GateUnusedClocks = TRUE
+};
 
-/* ================= App callbacks (được CanIf gọi) ================= */
-void App_TxConfirm(uint32_t TxPduId){
-    UART1_WriteStr("TX-Confirm: TxPduId=");
-    // In số nhỏ gọn (chỉ 1 chữ số nếu bạn dùng 0/1); có thể bỏ qua
-    UART1_WriteByte('0' + (TxPduId % 10));
-    UART1_WriteStr("\r\n");
+/* ================= Gpt: timebase (TIM2 rảnh) + tick của Com_MainFunctionTx + lịch CF của CanTp ================= */
+#define APP_GPT_COM_TICK  0U     // kênh continuous, chu kỳ COM_MAIN_FUNCTION_PERIOD_MS
+#define APP_GPT_CANTP     1U     // kênh one-shot do CanTp hẹn (STmin, mailbox bận)
+
+static volatile uint8_t App_ComTick;
+
+/* Chạy trong ngắt TIM2: chỉ đặt cờ, main loop gọi Com */
+static void App_ComTickNotification(void){
+    App_ComTick = 1U;
 }
 
-/* In UART ngay trong callback nhận */
-void App_RxCallback(uint32_t RxPduId, uint8_t* data, uint8_t len){
-    UART1_WriteStr("RX: RxPduId=");
-    UART1_WriteByte('0' + (RxPduId % 10));
-    UART1_WriteStr(", len=");
-    UART1_WriteByte('0' + (len % 10));
-    UART1_WriteStr(", data: ");
-    for(uint8_t i=0;i<len && i<8;i++){
-        UART1_WriteHex2(data[i]);
-        UART1_WriteByte(' ');
-    }
-    UART1_WriteStr("\r\n");
+static const Gpt_ChannelConfigType GptChannels[] = {
+    [APP_GPT_COM_TICK] = { .Mode = GPT_CH_MODE_CONTINUOUS, .Notification = App_ComTickNotification },
+    [APP_GPT_CANTP]    = { .Mode = GPT_CH_MODE_ONESHOT,    .Notification = CanTp_GptNotification }
+};
+
+static const Gpt_ConfigType GptCfg = {
+    .HwTimer     = GPT_HW_TIM2,
+    .IrqPriority = 4,            // cao hơn CAN RX0 (5): overflow được đếm kịp
+    .Channels    = GptChannels,
+    .numChannels = sizeof(GptChannels)/sizeof(*GptChannels)
+};
+
+static const Uart_ConfigType UartCfg = {
+    .BaudRate = 115200
+};
+
+/* ================= App callbacks (được CanIf gọi) =================
+   Ghép cả dòng trên stack rồi Uart_Write một lần: không chờ TXE trong ISR,
+   chi phí chỉ là format + copy vào ring (DMA gửi ở nền).
+   Frame nhận đi qua PduR tới Com (signal đọc ở App_MainFunction).
+   Xác nhận gửi (CAN TX ISR) chuyển cho CanTp trước: STmin đếm từ lúc CF rời bus. */
+void App_TxConfirm(uint32_t TxPduId){
+    CanTp_TxConfirmation((PduIdType)TxPduId);
+#if TRACE_ENABLE
+    (void)TxPduId;   // Can_Write đã ghi TRACE_EV_CAN_TX
+#else
+    char line[32];
+    char* p = Uart_FmtStr(line, "TX-Confirm: TxPduId=");
+    p = Uart_FmtDec(p, TxPduId);
+    p = Uart_FmtStr(p, "\r\n");
+    Uart_Write((const uint8_t*)line, (uint16_t)(p - line));
+#endif
 }
 
 /* ================= CanIf config (routing inline) =================
@@ -74,21 +97,163 @@ void App_RxCallback(uint32_t RxPduId, uint8_t* data, uint8_t len){
 static CanIf_ConfigType canIfCfg = {
     .numControllers        = 1,
     .defaultControllerMode = { CANIF_CONTROLLER_STARTED },
-    .numTxPdus             = 1,
-    .defaultTxPduMode      = { CANIF_ONLINE },
-    .numRxPdus             = 1,
-    .defaultRxPduMode      = { CANIF_ONLINE },
+    .numTxPdus             = 4,
+    .defaultTxPduMode      = { CANIF_ONLINE, CANIF_ONLINE, CANIF_ONLINE, CANIF_ONLINE },
+    .numRxPdus             = 3,
+    .defaultRxPduMode      = { CANIF_ONLINE, CANIF_ONLINE, CANIF_ONLINE },
 
-    .numRoutingEntry       = 2,
+    .numRoutingEntry       = 7,
     .routingTable          = {
-        { 0, 0x321, 1 },  // TxPduId=0 -> CAN ID 0x321 (TX)
-        { 0, 0x123, 0 }   // RxPduId=0 -> CAN ID 0x123 (RX)  <-- quan trọng
+        { 0, 0x321, 1 },  // TxPduId=0 -> CAN ID 0x321 (TX, Com EcuStatus)
+        { 1, 0x322, 1 },  // TxPduId=1 -> CAN ID 0x322 (TX, Com EcuEvent)
+        { 2, 0x201, 1 },  // TxPduId=2 -> CAN ID 0x201 (TX, gateway)
+        { 3, 0x7E8, 1 },  // TxPduId=3 -> CAN ID 0x7E8 (TX, CanTp: phản hồi, FC)
+        { 0, 0x123, 0 },  // RxPduId=0 -> CAN ID 0x123 (RX, Com TesterCmd)
+        { 1, 0x200, 0 },  // RxPduId=1 -> CAN ID 0x200 (RX, gateway)
+        { 2, 0x7E0, 0 }   // RxPduId=2 -> CAN ID 0x7E0 (RX, CanTp: yêu cầu của tester)
     },
 
     .txConfirmation        = App_TxConfirm,
-    .rxIndication          = App_RxCallback
+    .rxIndication          = PduR_CanIfRxIndication   // CanIf -> PduR -> Com / CanTp / gateway
 }; // :contentReference[oaicite:4]{index=4} :contentReference[oaicite:5]{index=5}
 
+/* ================= PduR: bảng định tuyến =================
+   Chỉ số RX = RxPduId của CanIf, chỉ số TX = I-PDU TX của Com (Com_Cfg.h) */
+static const PduR_RxRouteType PduRRxRoutes[] = {
+    { 1, { { PDUR_DEST_COM,   ComConf_ComIPdu_TesterCmd } } },  // 0x123 -> Com
+    { 1, { { PDUR_DEST_CANIF, 2 } } },                          // 0x200 -> 0x201 (gateway, trong ISR)
+    { 1, { { PDUR_DEST_CANTP, 0 } } }                           // 0x7E0 -> CanTp kênh APP_CANTP_DIAG
+};
+
+static const PduIdType PduRComTxRoutes[COM_NUM_TX_PDUS] = {
+    [ComConf_ComIPdu_EcuStatus] = 0,    // 0x321
+    [ComConf_ComIPdu_EcuEvent]  = 1     // 0x322
+};
+
+static const PduR_ConfigType PduRCfg = {
+    .RxRoutes       = PduRRxRoutes,
+    .numRxRoutes    = sizeof(PduRRxRoutes)/sizeof(*PduRRxRoutes),
+    .ComTxRoutes    = PduRComTxRoutes,
+    .numComTxRoutes = COM_NUM_TX_PDUS
+};
+
+/* ================= CanTp: kênh chẩn đoán 0x7E0 (tester) / 0x7E8 (ECU) =================
+   Message nhận (tới 64 KB) đi thẳng vào 2 segment 512 byte luân phiên: main
+   loop cộng checksum segment đã đầy trong lúc CanTp ghi segment kia. Trả lời
+   bằng SF 7 byte [0x00 OK / 0xFF lỗi, độ dài 32 bit, checksum 16 bit].
+   Yêu cầu 3 byte [0x35, n_hi, n_lo]: gửi n byte đầu flash (upload, không chép). */
+#define APP_CANTP_DIAG     0U
+#define APP_TP_SEG_SIZE    512U
+#define APP_TP_UPLOAD      0x35U
+
+static uint8_t App_TpBuf[2][APP_TP_SEG_SIZE];
+static volatile uint16_t App_TpFill[2];     // != 0: segment đầy, chờ main loop
+static uint8_t App_TpSeg;                   // segment CanTp đang ghi
+static uint32_t App_TpLength;
+static uint32_t App_TpHanded;               // byte trong các segment đã trả
+static volatile uint8_t App_TpDone;         // 1: nhận xong, 2: bị hủy; 0 lại khi đã trả lời
+static Gpt_TimestampType App_TpStart;
+
+/* Các callback chạy với ngắt mở (CAN RX ISR hoặc main loop): chỉ đổi con trỏ và cờ */
+static Std_ReturnType App_TpRxStart(PduIdType Channel, uint32_t Length, CanTp_SegmentType* Segment){
+    (void)Channel;
+    if (App_TpDone != 0U || App_TpFill[0] != 0U || App_TpFill[1] != 0U) {
+        return E_NOT_OK;            // message trước chưa xử lý xong
+    }
+    App_TpStart  = Gpt_GetTimestamp();
+    App_TpLength = Length;
+    App_TpHanded = 0U;
+    App_TpSeg    = 0U;
+    Segment->Data = App_TpBuf[0];
+    Segment->Size = APP_TP_SEG_SIZE;
+    return E_OK;
+}
+
+static Std_ReturnType App_TpRxSegment(PduIdType Channel, CanTp_SegmentType* Segment){
+    (void)Channel;
+    uint8_t cur = App_TpSeg;
+    if (App_TpFill[cur] == 0U) {    // gọi lại sau FC WAIT: segment này đã nhận rồi
+        App_TpFill[cur] = Segment->Size;
+        App_TpHanded += Segment->Size;
+    }
+    uint8_t next = (uint8_t)(cur ^ 1U);
+    if (App_TpFill[next] != 0U) {
+        return E_NOT_OK;            // main loop chưa xong segment kia: CanTp gửi FC WAIT
+    }
+    App_TpSeg = next;
+    Segment->Data = App_TpBuf[next];
+    Segment->Size = APP_TP_SEG_SIZE;
+    return E_OK;
+}
+
+static void App_TpRxIndication(PduIdType Channel, Std_ReturnType Result){
+    (void)Channel;
+    if (Result == E_OK) {
+        App_TpFill[App_TpSeg] = (uint16_t)(App_TpLength - App_TpHanded);
+        App_TpDone = 1U;
+    } else {
+        App_TpDone = 2U;
+    }
+}
+
+static const CanTp_ChannelConfigType CanTpChannels[] = {
+    [APP_CANTP_DIAG] = {
+        .TxPduId     = 3,           // 0x7E8
+        .BlockSize   = 0,           // không giới hạn (CanTp tự giảm theo chỗ trống của segment)
+        .STmin       = 0,           // ISR nhận kịp frame liền nhau ở 250 kbit/s
+        .TimeoutMs   = 1000,        // N_Bs / N_Cr / N_As
+        .MaxWaits    = 10,
+        .Padding     = TRUE,
+        .PaddingByte = 0xCC
+    }
+};
+
+static const CanTp_ConfigType CanTpCfg = {
+    .Channels             = CanTpChannels,
+    .numChannels          = sizeof(CanTpChannels)/sizeof(*CanTpChannels),
+    .GptChannel           = APP_GPT_CANTP,
+    .MainFunctionPeriodMs = COM_MAIN_FUNCTION_PERIOD_MS,
+    .RxStart              = App_TpRxStart,
+    .RxSegment            = App_TpRxSegment,
+    .RxIndication         = App_TpRxIndication,
+    .TxConfirmation       = NULL_PTR
+};
+
+/* ================= Port: chân CAN1 =================
+   Mặc định PA11 (RX) / PA12 (TX). Dùng PB8/PB9: đổi PortNum = PORT_ID_B,
+   PinNum = 8/9 và .Remap = GPIO_Remap1_CAN1 cho cả hai chân. */
+static const Port_PinConfigType PortCfg_Pins[] = {
+    {
+      .PortNum           = PORT_ID_A,   // PA11 = CAN1_RX
+      .PinNum            = 11,
+      .Mode              = PORT_PIN_MODE_CAN,
+      .Direction         = PORT_PIN_IN,
+      .speed             = 2,
+      .DirectionChangeable = 0,
+      .Level             = PORT_PIN_LEVEL_LOW,
+      .Pull              = PORT_PIN_PULL_UP,
+      .ModeChangeable    = 0,
+      .Remap             = 0
+    },
+    {
+      .PortNum           = PORT_ID_A,   // PA12 = CAN1_TX
+      .PinNum            = 12,
+      .Mode              = PORT_PIN_MODE_CAN,
+      .Direction         = PORT_PIN_OUT,
+      .speed             = 50,
+      .DirectionChangeable = 0,
+      .Level             = PORT_PIN_LEVEL_HIGH,  // recessive nếu chuyển sang DIO
+      .Pull              = PORT_PIN_PULL_NONE,
+      .ModeChangeable    = 1,                    // DIO <-> CAN khi khôi phục bus-off
+      .Remap             = 0
+    }
+};
+
+static const Port_ConfigType PortCfg = {
+    .PinConfigs = PortCfg_Pins,
+    .PinCount   = sizeof(PortCfg_Pins)/sizeof(*PortCfg_Pins)
+};
+
 /* ================= CAN 250 kbps @ PCLK1=36MHz =================
    16TQ: Prescaler=9, SJW=1, BS1=13, BS2=2.
    Filter nhận hết (mask=0) để test nhanh. */
@@ -104,22 +269,171 @@ static Can_ConfigType canHwCfg = {
     .FilterMaskIdLow  = 0x0000,
 }; // :contentReference[oaicite:6]{index=6}
 
+#if !TRACE_ENABLE
+/* Một dòng log thời gian boot (µs từ reset tới cuối mỗi pha) */
+static void App_LogBootTimes(void){
+    static const char* const names[BOOT_NUM_PHASES] = {
+        "reset", " clocks=", " ram=", " port=", " can=", " tx="
+    };
+    char line[96];
+    char* p = Uart_FmtStr(line, "Boot #");
+    p = Uart_FmtDec(p, Boot_Record.Count);
+    p = Uart_FmtStr(p, " us:");
+    for(uint8_t i = BOOT_PHASE_CLOCKS; i < BOOT_NUM_PHASES; i++){
+        p = Uart_FmtStr(p, names[i]);
+        p = Uart_FmtDec(p, Boot_GetTimeUs((Boot_PhaseType)i));
+    }
+    p = Uart_FmtStr(p, (Boot_GetTimeUs(BOOT_PHASE_FIRST_CAN_TX) <= APP_BOOT_DEADLINE_US) ? " OK\r\n" : " LATE\r\n");
+    Uart_Write((const uint8_t*)line, (uint16_t)(p - line));
+}
+#endif
+
+/* Checksum các segment đã đầy theo thứ tự; trả lời khi message xong */
+static void App_TpMainFunction(void){
+    static uint8_t next;            // segment xử lý kế tiếp
+    static uint16_t sum;
+    uint8_t done = App_TpDone;      // đọc trước: segment cuối đã được đánh dấu khi done != 0
+
+    while (App_TpFill[next] != 0U) {
+        const uint8_t* d = App_TpBuf[next];
+        uint16_t n = App_TpFill[next];
+        for (uint16_t i = 0; i < n; i++) sum = (uint16_t)(sum + d[i]);
+        App_TpFill[next] = 0U;
+        next ^= 1U;
+    }
+    if (done == 0U) {
+        return;
+    }
+
+    // Segment 0 còn nguyên tới khi App_TpDone về 0 (App_TpRxStart từ chối message mới)
+    const uint8_t* request = App_TpBuf[0];
+    if (done == 1U && App_TpLength == 3U && request[0] == APP_TP_UPLOAD) {
+        uint16_t n = (uint16_t)((request[1] << 8) | request[2]);
+        (void)CanTp_Transmit(APP_CANTP_DIAG, (const uint8_t*)FLASH_BASE, n ? n : 1U);
+    } else {
+        static uint8_t resp[7];     // phải còn nguyên tới khi gửi xong
+        resp[0] = (done == 1U) ? 0x00U : 0xFFU;
+        resp[1] = (uint8_t)(App_TpLength >> 24);
+        resp[2] = (uint8_t)(App_TpLength >> 16);
+        resp[3] = (uint8_t)(App_TpLength >> 8);
+        resp[4] = (uint8_t)App_TpLength;
+        resp[5] = (uint8_t)(sum >> 8);
+        resp[6] = (uint8_t)sum;
+        (void)CanTp_Transmit(APP_CANTP_DIAG, resp, sizeof(resp));
+    }
+#if !TRACE_ENABLE
+    char line[80];
+    char* p = Uart_FmtStr(line, (done == 1U) ? "TP RX len=" : "TP RX aborted len=");
+    p = Uart_FmtDec(p, App_TpLength);
+    p = Uart_FmtStr(p, " sum=0x");
+    p = Uart_FmtHex16(p, sum);
+    p = Uart_FmtStr(p, " time=");
+    p = Uart_FmtDec(p, (uint32_t)(Gpt_GetTimestamp() - App_TpStart));   // tới lúc main loop xử lý xong
+    p = Uart_FmtStr(p, "us\r\n");
+    Uart_Write((const uint8_t*)line, (uint16_t)(p - line));
+#endif
+    next = 0U;
+    sum = 0U;
+    App_TpDone = 0U;                // cuối cùng: mở lại App_TpRxStart
+}
+
+/* ================= Ứng dụng: mỗi COM_MAIN_FUNCTION_PERIOD_MS =================
+   Signal chỉ được unpack khi đọc (Com_ReceiveSignal), frame mới báo bằng
+   Com_IsRxPduUpdated. Lệnh nhận được phản hồi bằng EcuEvent (DIRECT). */
+static void App_MainFunction(void){
+    static uint16_t rxCount;
+    static uint32_t uptimeMs;
+
+    uptimeMs += COM_MAIN_FUNCTION_PERIOD_MS;
+    if (Com_IsRxPduUpdated(ComConf_ComIPdu_TesterCmd)) {
+        uint8_t seq, led;
+        uint16_t duty;
+        int16_t setpoint;
+        (void)Com_ReceiveSignal(ComConf_ComSignal_Sequence, &seq);
+        (void)Com_ReceiveSignal(ComConf_ComSignal_LedRequest, &led);
+        (void)Com_ReceiveSignal(ComConf_ComSignal_PwmDuty, &duty);
+        (void)Com_ReceiveSignal(ComConf_ComSignal_Setpoint, &setpoint);
+
+        rxCount++;
+        (void)Com_SendSignal(ComConf_ComSignal_RxCount, &rxCount);        // PENDING: đi theo chu kỳ 1 s
+        (void)Com_SendSignal(ComConf_ComSignal_SetpointEcho, &setpoint);
+        (void)Com_SendSignal(ComConf_ComSignal_LedState, &led);
+        (void)Com_SendSignal(ComConf_ComSignal_LastSequence, &seq);       // TRIGGERED: mỗi lệnh một echo
+#if !TRACE_ENABLE
+        char line[80];
+        // Thời điểm frame vào (us, 32 bit thấp của timebase): so được với mẫu ADC, cạnh PWM
+        char* p = Uart_FmtStr(line, "RX t=");
+        p = Uart_FmtDec(p, (uint32_t)Com_GetRxPduTimestamp(ComConf_ComIPdu_TesterCmd));
+        p = Uart_FmtStr(p, "us: seq=");
+        p = Uart_FmtDec(p, seq);
+        p = Uart_FmtStr(p, " led=");
+        p = Uart_FmtDec(p, led);
+        p = Uart_FmtStr(p, " duty=");
+        p = Uart_FmtDec(p, duty);                      // 0.1 %
+        p = Uart_FmtStr(p, " setpoint=");
+        if (setpoint < 0) {
+            *p++ = '-';
+        }
+        p = Uart_FmtDec(p, (uint32_t)(setpoint < 0 ? -setpoint : setpoint));   // 0.5 degC
+        p = Uart_FmtStr(p, "\r\n");
+        Uart_Write((const uint8_t*)line, (uint16_t)(p - line));
+#endif
+    }
+    (void)Com_SendSignal(ComConf_ComSignal_UptimeMs, &uptimeMs);
+    Com_MainFunctionTx();
+    CanTp_MainFunction();
+    App_TpMainFunction();
+}
+
 int main(void){
-    SystemInit();                // gọi từ startup rồi, nhưng idempotent
-    UART1_Init_115200_8N1();
+    // SystemInit đã chạy trong Reset_Handler (một lần, trước khi copy .data);
+    // Mcu_InitClock chỉ chỉnh lại prescaler ADC (SystemInit để ADCCLK = 36 MHz)
+    Mcu_Init(&McuCfg);
+    (void)Mcu_InitClock(McuCfg.ClockSetting);
+    Gpt_Init(&GptCfg);           // timebase chạy trước khi có frame CAN đầu tiên
+    UART1_InitPins();
 
+    Port_Init(&PortCfg);         // chân CAN (và remap AFIO nếu có) trước Can_Init
+    Boot_Stamp(BOOT_PHASE_PORT_INIT);
+    Dma_Init();                  // trước Uart_Init (DMA1 Ch4)
+    Uart_Init(&UartCfg);         // log không chặn: ring + DMA1 Ch4 (USART1_TX)
+#if TRACE_ENABLE
+    Trace_Init();
+#endif
     Can_Init(&canHwCfg);         // driver bật NVIC + ISR USB_LP_CAN1_RX0_IRQHandler :contentReference[oaicite:7]{index=7}
+    Com_Init(&Com_Config);       // trước CanIf_Init: frame đầu tiên có thể tới ngay khi CAN chạy
+    CanTp_Init(&CanTpCfg);
+    PduR_Init(&PduRCfg);
     CanIf_Init(&canIfCfg);       // đăng ký CanIf_RxIndication với driver :contentReference[oaicite:8]{index=8}
 
     // (tuỳ chọn) đặt ưu tiên NVIC cho CAN RX0 nếu muốn
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_2);
     NVIC_SetPriority(USB_LP_CAN1_RX0_IRQn, 5);
+    NVIC_SetPriority(USB_HP_CAN1_TX_IRQn, 5);     // xác nhận gửi: cùng mức, không chen ngang RX
     NVIC_EnableIRQ(USB_LP_CAN1_RX0_IRQn);
+    NVIC_EnableIRQ(USB_HP_CAN1_TX_IRQn);
+    Boot_Stamp(BOOT_PHASE_CAN_INIT);
 
-    // Gửi thử 1 frame (không bắt buộc)
-    // uint8_t d[2]={0xAB,0xCD}; CanIf_Transmit(0, d, 2);
+    // Frame đầu tiên: EcuStatus báo ECU đã lên (số lần boot), gửi ngay không chờ
+    // Com_MainFunctionTx; mốc "first CAN TX" khi vào mailbox
+    uint16_t bootCount = (uint16_t)Boot_Record.Count;
+    (void)Com_SendSignal(ComConf_ComSignal_BootCount, &bootCount);
+    if (Com_TriggerIPDUSend(ComConf_ComIPdu_EcuStatus) == E_OK) {
+        Boot_Stamp(BOOT_PHASE_FIRST_CAN_TX);
+    }
+#if !TRACE_ENABLE
+    App_LogBootTimes();
+#endif
+    Gpt_StartTimer(APP_GPT_COM_TICK, COM_MAIN_FUNCTION_PERIOD_MS * 1000UL);
 
     for(;;){
-        __WFI(); // chờ ngắt; khi có CAN, ISR -> CanIf -> App_RxCallback (UART in-place)
+        __WFI(); // chờ ngắt; khi có CAN, ISR -> CanIf -> PduR -> Com (chép vào shadow buffer)
+        if (App_ComTick) {
+            App_ComTick = 0U;
+            App_MainFunction();
+        }
+#if TRACE_ENABLE
+        Trace_MainFunction();    // sau mỗi ngắt: chuyển record trace sang ring UART
+#endif
     }
 }
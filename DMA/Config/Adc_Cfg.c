@@ -24,21 +24,3 @@ void ADC1_2_IRQHandler(void)
         }
     }
 }
-
-void DMA1_Channel1_IRQHandler(void)
-{
-    for (int i = 0; i < ADC_NUM_GROUPS_DMA; i++) {
-        const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[i];
-        if (cfg->DMA_Channel != DMA1_Channel1) continue;
-        if (DMA_GetITStatus(cfg->DMA_FLAG_TC)) {
-            DMA_ClearITPendingBit(cfg->DMA_FLAG_TC);
-            DMA_Cmd(cfg->DMA_Channel, DISABLE);
-            ADC_DMACmd(cfg->ADCx, DISABLE);
-            if (cfg->Adc_DmaNotificationCbType) cfg->Adc_DmaNotificationCbType();
-        }
-    }
-}
-
-
-
-
@@ -0,0 +1,9 @@
+#ifndef ADC_CFG_H
+#define ADC_CFG_H
+
+#include "Adc.h"
+
+void ADC1_2_IRQHandler(void);
+
+#endif
+
@@ -1,319 +0,0 @@
-/*
- * Adc.c
- * AUTOSAR ADC Driver implementation for STM32F103C8
- */
-
-#include "Adc.h"
-#include "Adc_Cfg.h"
-#include "Port.h"
-#include "stm32f10x.h"
-#include <stddef.h>
-#include "stm32f10x_adc.h"
-#include "stm32f10x_rcc.h"
-
-extern Adc_ValueGroupType* Adc_DmaBuffer[ADC_NUM_GROUPS_DMA];
-
-extern Adc_GroupDefType Adc_Groups[];
-
-ADC_InitTypeDef ADC_InitStruct;
-
-void Adc_Init(const Adc_ConfigType* ConfigPtr)
-{
-    if (ConfigPtr == NULL_PTR) return;
-    // Initialize ADC peripheral based on ConfigPtr
-    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);  // DMA1 for ADC1/ADC2
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1 | RCC_APB2Periph_ADC2, ENABLE); // Enable ADC clocks
-    // Select ADC instance
-
-    ADC_TypeDef* adcInstance = NULL_PTR;
-    if (ConfigPtr->Instance == ADC_1) {
-        adcInstance = ADC1;
-    } else if (ConfigPtr->Instance == ADC_2) {
-        adcInstance = ADC2;
-    } else {
-        return; // Invalid ADC instance
-    }
-
-    // Initialize ADC peripheral
-    ADC_InitStruct.ADC_Mode = ADC_Mode_Independent; // Independent mode for ADC1/ADC2
-    ADC_InitStruct.ADC_ContinuousConvMode = (ConfigPtr->ConvMode == ADC_CONV_MODE_CONTINUOUS) ? ENABLE : DISABLE; // Single channel conversion
-    ADC_InitStruct.ADC_ScanConvMode = DISABLE; // Single channel
-    ADC_InitStruct.ADC_ExternalTrigConv = (ConfigPtr->TriggerSource == ADC_TRIGG_SRC_SW) ? ADC_ExternalTrigConv_None : ADC_ExternalTrigConv_T1_CC1; // No external trigger
-    ADC_InitStruct.ADC_DataAlign = ADC_DataAlign_Right;
-
-    ADC_Init(adcInstance, &ADC_InitStruct);
-
-    // Setting up channel configurations
-    for (uint8 i = 0;  i < ConfigPtr->numChannels;  i++) {
-        Adc_ChannelType chanId = ConfigPtr->Channel[i].ChannelId;
-        uint8           rank   = ConfigPtr->Channel[i].Rank;
-        Adc_SamplingTimeType samp = ConfigPtr->Channel[i].SamplingTime;
-
-        if (ConfigPtr->Instance == ADC_1) {
-            // ADC1 channels are 0–15
-            ADC_RegularChannelConfig(adcInstance,
-                                     chanId,
-                                     rank,
-                                     samp);
-        } else {
-            // ADC2 channels are 16–31
-            ADC_RegularChannelConfig(adcInstance,
-                                     chanId - 16,
-                                     rank,
-                                     samp);
-        }
-    }
-
-    //Turn on ADC
-    ADC_Cmd(adcInstance, ENABLE);
-
-}
-
-void Adc_DeInit(void)
-{
-    // Deinitialize ADC peripheral
-    ADC_StructInit(&ADC_InitStruct); 
-
-    ADC_DeInit(ADC1);
-    ADC_DeInit(ADC2);
-    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, DISABLE);  // Disable DMA clock
-}
-
-Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
-{
-    // Check for null pointer
-    if (DataBufferPtr == NULL_PTR) {
-        return E_NOT_OK;
-    }
-
-    // Basic range check - assumes max group count is known (you can define MAX_ADC_GROUPS)
-    if (Group >= MAX_ADC_GROUPS) {
-        return E_NOT_OK;
-    }
-
-    // Assign the buffer pointer to the group
-    Adc_Groups[Group].Result = DataBufferPtr;
-
-    // Optionally reset group status
-    Adc_Groups[Group].Status = ADC_IDLE;
-
-    return E_OK;
-}
-
-void Adc_StartGroupConversion(Adc_GroupType Group){
-    const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[Group];
-    ADC_SoftwareStartConvCmd(cfg->ADCx, ENABLE);
-}
-
-void Adc_StopGroupConversion(Adc_GroupType Group){
-    const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[Group];
-    ADC_SoftwareStartConvCmd(cfg->ADCx, DISABLE);
-}
-
-void Adc_ReadGroup(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
-{
-    // Check for valid group and buffer pointer
-    if (Group >= MAX_ADC_GROUPS || DataBufferPtr == NULL_PTR) {
-        return;
-    }
-
-    Adc_GroupDefType* group = &Adc_Groups[Group];
-
-    // Get first channel to identify ADC instance
-    ADC_TypeDef* adcInstance = NULL_PTR;
-
-    if (group->AdcInstance == ADC_1) {
-        adcInstance = ADC1;
-    } else if (group->AdcInstance == ADC_2) {
-        adcInstance = ADC2;
-    } else {
-        return; // Invalid channel
-    }
-
-    // Read ADC result register
-    uint16_t adcValue = ADC_GetConversionValue(adcInstance);
-
-    // Save value into user buffer
-    *DataBufferPtr = (Adc_ValueGroupType)(adcValue & 0xFF);  // Trim to 8-bit if needed
-
-    // Update internal buffer pointer if available
-    if (group->Result != NULL_PTR) {
-        group->Result[0] = *DataBufferPtr;
-    }
-
-    // Mark conversion as completed
-    group->Status = ADC_COMPLETED;
-}
-
-void Adc_EnableHardwareTrigger(Adc_GroupType Group)
-{
-    // Validate group index
-    if (Group >= MAX_ADC_GROUPS) {
-        return;
-    }
-
-    Adc_GroupDefType* group = &Adc_Groups[Group];
-    ADC_TypeDef* adc = NULL;
-
-    // Determine ADC instance from channel ID
-    if (group->AdcInstance == ADC_1) {
-        adc = ADC1;
-    } else if (group->AdcInstance == ADC_2) {
-        adc = ADC2;
-    } else {
-        return; // Invalid channel ID
-    }
-
-    // Step 1: Clear existing external trigger selection bits (EXTSEL)
-    adc->CR2 &= ~(0xE0000);  // Clear bits 17:19
-
-    // Step 2: Set external trigger to ADC_ExternalTrigConv_T1_CC1 (value = 0x00000000)
-    // No need to OR anything, already cleared to 0, but you can do it explicitly:
-    adc->CR2 |= ADC_ExternalTrigConv_T1_CC1;
-
-    // Step 3: Enable external trigger by setting EXTTRIG (bit 20)
-    adc->CR2 |= (1 << 20);  // EXTTRIG bit
-
-    // Optional: Set group status if you track it
-    group->Status = ADC_IDLE;
-}
-
-void Adc_DisableHardwareTrigger(Adc_GroupType Group)
-{
-    // Validate the group ID
-    if (Group >= MAX_ADC_GROUPS) {
-        return;
-    }
-
-    Adc_GroupDefType* group = &Adc_Groups[Group];
-    ADC_TypeDef* adc = NULL;
-
-    // Determine which ADC peripheral to use
-    if (group->AdcInstance == ADC_1) {
-        adc = ADC1;
-    } else if (group->AdcInstance == ADC_2) {
-        adc = ADC2;
-    } else {
-        return;  // Invalid channel
-    }
-
-    // Step 1: Clear the EXTSEL bits (bits 17:19)
-    adc->CR2 &= ~(0xE0000);  // Clear EXTSEL
-
-    // Step 2: Set EXTSEL to ADC_ExternalTrigConv_None (0x000E0000)
-    adc->CR2 |= ADC_ExternalTrigConv_None;
-
-    // Step 3: Clear EXTTRIG bit (bit 20) to disable external trigger
-    adc->CR2 &= ~(1 << 20);
-}
-
-Adc_StatusType Adc_GetGroupStatus(Adc_GroupType Group)
-{
-    return Adc_Groups[Group].Status;
-}
-
-void Adc_GetVersionInfo (Std_VersionInfoType* VersionInfo)
-{
-    VersionInfo->vendorID = 0x1234;
-    VersionInfo->moduleID = 0x5678;
-    VersionInfo->sw_major_version = 1;
-    VersionInfo->sw_minor_version = 0;
-    VersionInfo->sw_patch_version = 0;
-}
-
-void Adc_EnableGroupNotification(Adc_GroupType Group){
-
-    Adc_ConfigType* cfg = &Adc_Configs[Adc_Groups[Group].AdcInstance];
-    cfg->NotificationEnable = ADC_NOTIFICATION_ON;
-
-    // Enable the ADC interrupt for the group
-    if (cfg->Instance == ADC_1) {
-        ADC_ITConfig(ADC1, ADC_IT_EOC, ENABLE);
-        NVIC_EnableIRQ(ADC1_2_IRQn);
-    } else if (cfg->Instance == ADC_2) {
-        ADC_ITConfig(ADC2, ADC_IT_EOC, ENABLE);
-        NVIC_EnableIRQ(ADC1_2_IRQn);
-    }
-}
-
-void Adc_DisableGroupNotification(Adc_GroupType Group){
-    Adc_ConfigType* cfg = &Adc_Configs[Adc_Groups[Group].AdcInstance];
-    cfg->NotificationEnable = ADC_NOTIFICATION_OFF;
-
-    // Disable the ADC interrupt for the group
-    if (cfg->Instance == ADC_1) {
-        NVIC_DisableIRQ(ADC1_2_IRQn);
-    } else if (cfg->Instance == ADC_2) {
-        NVIC_DisableIRQ(ADC1_2_IRQn);
-    }
-}
-
-Std_ReturnType Adc_SetupResultBuffer_Dma(Adc_GroupType group, Adc_ValueGroupType* buf)
-{
-    for (int i = 0; i < ADC_NUM_GROUPS_DMA; i++) {
-        if (AdcGroupDmaConfig[i].groupId == group) {
-            Adc_DmaBuffer[i] = buf;
-            return E_OK;
-        }
-    }
-    return E_NOT_OK;
-}
-
-
-Std_ReturnType Adc_EnableDma(Adc_GroupType group)
-{
-    for (int i = 0; i < ADC_NUM_GROUPS_DMA; i++) {
-        const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[i];
-        if (cfg->groupId != group) continue;
-
-        // 1. Tắt & reset DMA channel
-        DMA_Cmd(cfg->DMA_Channel, DISABLE);
-        DMA_DeInit(cfg->DMA_Channel);
-
-        // 2. Cấu hình DMA
-        DMA_InitTypeDef dinit;
-        DMA_StructInit(&dinit);
-        dinit.DMA_PeripheralBaseAddr = (uint32_t)&(cfg->ADCx->DR);
-        dinit.DMA_MemoryBaseAddr     = (uint32_t)Adc_DmaBuffer[i];
-        dinit.DMA_DIR                = DMA_DIR_PeripheralSRC;
-        dinit.DMA_BufferSize         = cfg->channelCount;
-        dinit.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
-        dinit.DMA_MemoryInc          = DMA_MemoryInc_Enable;
-        dinit.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
-        dinit.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
-        dinit.DMA_Mode               = DMA_Mode_Normal;
-        dinit.DMA_Priority           = DMA_Priority_High;
-        DMA_Init(cfg->DMA_Channel, &dinit);
-
-        // 3. Bật ngắt TC
-        DMA_ITConfig(cfg->DMA_Channel, DMA_IT_TC, ENABLE);
-        NVIC_EnableIRQ(DMA1_Channel1_IRQn);
-
-        // 4. Bật DMA & ADC<->DMA link
-        DMA_Cmd(cfg->DMA_Channel, ENABLE);
-        ADC_DMACmd(cfg->ADCx, ENABLE);
-
-        return E_OK;
-    }
-    return E_NOT_OK;
-}
-
-Std_ReturnType Adc_DisableDma(Adc_GroupType group)
-{
-    for (int i = 0; i < ADC_NUM_GROUPS_DMA; i++) {
-        const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[i];
-        if (cfg->groupId == group) {
-            ADC_DMACmd(cfg->ADCx, DISABLE);
-            DMA_Cmd(cfg->DMA_Channel, DISABLE);
-            DMA_ITConfig(cfg->DMA_Channel, DMA_IT_TC, DISABLE);
-            return E_OK;
-        }
-    }
-    return E_NOT_OK;
-}
-
-
-
-
-
-    
@@ -9,11 +9,11 @@
 #include "Adc_Cfg.h"
 #include "Pwm.h"
 #include "Pwm_Cfg.h"
+#include "Dma.h"
 #include "Std_Types.h"
 
 Adc_ValueGroupType myGroup0Buffer[2];  // For 2 channels
 
-Adc_ValueGroupType* Adc_DmaBuffer[ADC_NUM_GROUPS_DMA];
 Adc_ValueGroupType myDmaBuf[2];
 
 void MyAdcGroup0_Notification(void)
@@ -87,21 +87,18 @@ Adc_GroupDefType Adc_Groups[] = {
 const Adc_GroupDmaConfigType AdcGroupDmaConfig[] = {
     { 
 		.ADCx = ADC1, 
-		.DMA_Channel = DMA1_Channel1, 
-		.DMA_FLAG_TC = DMA1_FLAG_TC1, 
 		.groupId = 0, 
 		.channelCount = 2, 
 		.Adc_DmaNotificationCbType = MyAdcGroup0_DmaCb 
 	},
     { 
 		.ADCx = ADC1, 
-		.DMA_Channel = DMA1_Channel1, 
-		.DMA_FLAG_TC = DMA1_FLAG_TC1, 
 		.groupId = 1, 
 		.channelCount = 1, 
 		.Adc_DmaNotificationCbType = NULL_PTR 
 	}
 };
+const uint8_t AdcNumGroupsDma = sizeof(AdcGroupDmaConfig)/sizeof(*AdcGroupDmaConfig);
 
 const Port_ConfigType PortCfg = {
 	.PinConfigs = PortCfg_Pins,
@@ -112,6 +109,7 @@ int main(){
 
 	// Initialize the pin configuration
 	Port_Init(&PortCfg);
+	Dma_Init();                 // ADC requests DMA1 Channel 1 from the DMA driver
 	
 	Adc_Init(&Adc_Configs[0]);
 	Adc_SetupResultBuffer_Dma(0, myDmaBuf);
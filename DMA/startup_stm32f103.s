@@ -32,7 +32,7 @@ g_pfnVectors:
     .word   PendSV_Handler          /* 0x38: PendSV Handler */
     .word   SysTick_Handler         /* 0x3C: SysTick Handler */
 
-    /* External Interrupts (IRQ0 to IRQ28 shown here) */
+    /* External Interrupts (IRQ0 to IRQ42) */
     .word   Default_Handler         /* 0x40: WWDG */
     .word   Default_Handler         /* 0x44: PVD */
     .word   Default_Handler         /* 0x48: TAMPER */
@@ -44,21 +44,38 @@ g_pfnVectors:
     .word   Default_Handler         /* 0x60: EXTI2 */
     .word   Default_Handler         /* 0x64: EXTI3 */
     .word   Default_Handler         /* 0x68: EXTI4 */
-    .word   DMA1_Channel1_IRQHandler         /* 0x6C: DMA1_Channel1 */
-    .word   Default_Handler         /* 0x70: DMA1_Channel2 */
-    .word   Default_Handler         /* 0x74: DMA1_Channel3 */
-    .word   Default_Handler         /* 0x78: DMA1_Channel4 */
-    .word   Default_Handler         /* 0x7C: DMA1_Channel5 */
-    .word   Default_Handler         /* 0x80: DMA1_Channel6 */
-    .word   Default_Handler         /* 0x84: DMA1_Channel7 */
+    .word   DMA1_Channel1_IRQHandler /* 0x6C: DMA1_Channel1 */
+    .word   DMA1_Channel2_IRQHandler /* 0x70: DMA1_Channel2 */
+    .word   DMA1_Channel3_IRQHandler /* 0x74: DMA1_Channel3 */
+    .word   DMA1_Channel4_IRQHandler /* 0x78: DMA1_Channel4 */
+    .word   DMA1_Channel5_IRQHandler /* 0x7C: DMA1_Channel5 */
+    .word   DMA1_Channel6_IRQHandler /* 0x80: DMA1_Channel6 */
+    .word   DMA1_Channel7_IRQHandler /* 0x84: DMA1_Channel7 */
     .word   ADC1_2_IRQHandler       /* 0x88: ADC1 and ADC2 */
     .word   Default_Handler         /* 0x8C: USB_HP_CAN_TX */
     .word   Default_Handler         /* 0x90: USB_LP_CAN_RX0 */
     .word   Default_Handler         /* 0x94: CAN_RX1 */
     .word   Default_Handler         /* 0x98: CAN_SCE */
     .word   Default_Handler         /* 0x9C: EXTI9_5 */
-    .word   TIM2_IRQHandler         /* 0xA0: TIM2 */
-    /* ... tiếp tục với các vector khác nếu cần thiết */
+    .word   Default_Handler         /* 0xA0: TIM1_BRK */
+    .word   TIM1_UP_IRQHandler      /* 0xA4: TIM1_UP */
+    .word   Default_Handler         /* 0xA8: TIM1_TRG_COM */
+    .word   TIM1_CC_IRQHandler      /* 0xAC: TIM1_CC */
+    .word   TIM2_IRQHandler         /* 0xB0: TIM2 */
+    .word   TIM3_IRQHandler         /* 0xB4: TIM3 */
+    .word   TIM4_IRQHandler         /* 0xB8: TIM4 */
+    .word   Default_Handler         /* 0xBC: I2C1_EV */
+    .word   Default_Handler         /* 0xC0: I2C1_ER */
+    .word   Default_Handler         /* 0xC4: I2C2_EV */
+    .word   Default_Handler         /* 0xC8: I2C2_ER */
+    .word   Default_Handler         /* 0xCC: SPI1 */
+    .word   Default_Handler         /* 0xD0: SPI2 */
+    .word   Default_Handler         /* 0xD4: USART1 */
+    .word   Default_Handler         /* 0xD8: USART2 */
+    .word   Default_Handler         /* 0xDC: USART3 */
+    .word   Default_Handler         /* 0xE0: EXTI15_10 */
+    .word   Default_Handler         /* 0xE4: RTCAlarm */
+    .word   Default_Handler         /* 0xE8: USBWakeUp */
 
 /* ========= Default Handler ========= */
 .section .text.Default_Handler, "ax", %progbits
@@ -99,18 +116,48 @@ Default_Handler:
 .weak   ADC1_2_IRQHandler
 .set    ADC1_2_IRQHandler, Default_Handler
 
+.weak   DMA1_Channel1_IRQHandler
+.set    DMA1_Channel1_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel2_IRQHandler
+.set    DMA1_Channel2_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel3_IRQHandler
+.set    DMA1_Channel3_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel4_IRQHandler
+.set    DMA1_Channel4_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel5_IRQHandler
+.set    DMA1_Channel5_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel6_IRQHandler
+.set    DMA1_Channel6_IRQHandler, Default_Handler
+
+.weak   DMA1_Channel7_IRQHandler
+.set    DMA1_Channel7_IRQHandler, Default_Handler
+
+.weak   TIM1_UP_IRQHandler
+.set    TIM1_UP_IRQHandler, Default_Handler
+
+.weak   TIM1_CC_IRQHandler
+.set    TIM1_CC_IRQHandler, Default_Handler
+
 .weak   TIM2_IRQHandler
 .set    TIM2_IRQHandler, Default_Handler
 
-.weak   DMA1_Channel1_IRQHandler
-.long   DMA1_Channel1_IRQHandler
+.weak   TIM3_IRQHandler
+.set    TIM3_IRQHandler, Default_Handler
+
+.weak   TIM4_IRQHandler
+.set    TIM4_IRQHandler, Default_Handler
 
 /* ========= Reset Handler ========= */
 .section .text.Reset_Handler, "ax", %progbits
 .weak   Reset_Handler
 .type   Reset_Handler, %function
 Reset_Handler:
-    /* Copy .data section from Flash to RAM */
+    /* Copy .data section (including .ramfunc code) from Flash to RAM */
     LDR   R0, =_sidata
     LDR   R1, =_sdata
     LDR   R2, =_edata
@@ -0,0 +1,147 @@
+/*
+ * bus.c
+ * Virtual CAN bus of cansim: bitwise arbitration between the pending frames
+ * of all nodes, frame time from the real bit count (stuff bits of the
+ * actual identifier, DLC, data and CRC), 3-bit intermission between frames
+ *
+ * Only 11-bit data frames are modelled; error frames and retransmission
+ * after errors are not (the bus is error free).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sim.h"
+
+static SimNode* nodes;
+static SimNode** lastNode = &nodes;
+static uint32_t busBitrate;
+static SimTime bitTime;
+static int busy;                /* frame or intermission in progress, or arbitration scheduled */
+static SimTime busyTime;
+static uint64_t frames;
+
+static SimNode* winner;
+static int winnerSlot;
+static SimFrame current;
+
+static void arbitrate(void* ctx, uint32_t arg);
+
+void Bus_Init(uint32_t bitrate) {
+    busBitrate = bitrate;
+    bitTime = SIM_S / bitrate;
+    if (bitTime * bitrate != SIM_S) {
+        fprintf(stderr, "cansim: bit rate %lu does not give a whole ns bit time\n", (unsigned long)bitrate);
+        exit(2);
+    }
+}
+
+uint32_t Bus_Bitrate(void) {
+    return busBitrate;
+}
+
+SimTime Bus_BitTime(void) {
+    return bitTime;
+}
+
+void Bus_Attach(SimNode* node) {
+    node->Next = NULL;
+    *lastNode = node;
+    lastNode = &node->Next;
+}
+
+void Bus_Request(void) {
+    if (busy) return;           /* the frame joins the next arbitration */
+    busy = 1;
+    Sim_At(Sim_Now(), arbitrate, NULL, 0);     /* after other requests of the same instant */
+}
+
+/* CRC-15/CAN (x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1) */
+static uint16_t crc15(const uint8_t* bits, unsigned n) {
+    uint16_t crc = 0;
+    for (unsigned i = 0; i < n; i++) {
+        unsigned next = bits[i] ^ ((crc >> 14) & 1U);
+        crc = (uint16_t)((crc << 1) & 0x7FFFU);
+        if (next) crc ^= 0x4599U;
+    }
+    return crc;
+}
+
+unsigned Bus_FrameBits(const SimFrame* f) {
+    uint8_t bits[19 + 64 + 15];
+    unsigned n = 0;
+    bits[n++] = 0;                                      /* SOF */
+    for (int i = 10; i >= 0; i--) bits[n++] = (f->Id >> i) & 1U;
+    bits[n++] = 0;                                      /* RTR: data frame */
+    bits[n++] = 0;                                      /* IDE: standard */
+    bits[n++] = 0;                                      /* r0 */
+    for (int i = 3; i >= 0; i--) bits[n++] = (f->Dlc >> i) & 1U;
+    unsigned len = (f->Dlc > 8U) ? 8U : f->Dlc;
+    for (unsigned b = 0; b < len; b++) {
+        for (int i = 7; i >= 0; i--) bits[n++] = (f->Data[b] >> i) & 1U;
+    }
+    uint16_t crc = crc15(bits, n);
+    for (int i = 14; i >= 0; i--) bits[n++] = (crc >> i) & 1U;
+
+    /* A stuff bit follows five equal bits and starts the next run itself */
+    unsigned stuff = 0, run = 1;
+    uint8_t last = bits[0];
+    for (unsigned i = 1; i < n; i++) {
+        if (bits[i] == last) {
+            if (++run == 5) {
+                stuff++;
+                last = !last;
+                run = 1;
+            }
+        } else {
+            last = bits[i];
+            run = 1;
+        }
+    }
+    return n + stuff + 1 + 2 + 7;                       /* CRC delimiter, ACK, EOF */
+}
+
+static void endOfFrame(void* ctx, uint32_t arg) {
+    (void)ctx; (void)arg;
+    SimNode* tx = winner;
+    winner = NULL;
+    tx->TxFrames++;
+    tx->TxDone(tx, winnerSlot);
+    for (SimNode* n = nodes; n; n = n->Next) {
+        if (n != tx && n->Rx) n->Rx(n, &current);
+    }
+    Sim_At(Sim_Now() + 3 * bitTime, arbitrate, NULL, 0);   /* intermission */
+}
+
+/* Lowest identifier wins; equal identifiers (two senders of one ID, a
+   configuration error on a real bus) go to the node attached first */
+static void arbitrate(void* ctx, uint32_t arg) {
+    (void)ctx; (void)arg;
+    winner = NULL;
+    for (SimNode* n = nodes; n; n = n->Next) {
+        SimFrame f;
+        int slot = n->Offer(n, &f);
+        if (slot >= 0 && (winner == NULL || f.Id < current.Id)) {
+            winner = n;
+            winnerSlot = slot;
+            current = f;
+        }
+    }
+    if (winner == NULL) {
+        busy = 0;               /* idle until the next Bus_Request */
+        return;
+    }
+    unsigned bits = Bus_FrameBits(&current);
+    winner->TxBits += bits;
+    frames++;
+    busyTime += (bits + 3) * bitTime;
+    Sim_At(Sim_Now() + bits * bitTime, endOfFrame, NULL, 0);
+}
+
+SimTime Bus_BusyTime(void) {
+    return busyTime;
+}
+
+uint64_t Bus_Frames(void) {
+    return frames;
+}
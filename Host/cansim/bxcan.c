@@ -0,0 +1,399 @@
+/*
+ * bxcan.c
+ * bxCAN model of cansim behind the SPL CAN_* functions, so MCAL/Can/can.c
+ * runs unchanged against the virtual bus
+ *
+ * Modelled as in RM0008 section 24:
+ *   - 3 transmit mailboxes: CAN_Transmit takes the lowest empty one; the
+ *     mailbox entering arbitration is the oldest request with TXFP, the
+ *     lowest identifier (then lowest mailbox number) without it
+ *   - RQCPx and TXOKx are set when the mailbox's frame has been sent and
+ *     cleared together by writing RQCPx or by the next request; TME requests
+ *     the CAN TX interrupt while any RQCPx is set
+ *   - 2 receive FIFOs of 3 messages; a message arriving at a full FIFO is an
+ *     overrun: it replaces the newest one (RFLM = 0) or is discarded
+ *     (RFLM = 1), either way one message is lost
+ *   - 14 filter banks in 16/32-bit scale, mask or list mode, matched by the
+ *     priority rules of 24.7.4 (32-bit before 16-bit, list before mask,
+ *     then lower bank); no active bank matching: the message is dropped
+ *   - FMP0 requests the CAN RX0 interrupt while FIFO 0 is not empty
+ * Bit timing from CAN_Init must match the bus (error frames are not modelled).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+#include "stm32f10x.h"        /* host stand-in first: the SPL header would find the real one */
+#include "stm32f10x_can.h"
+
+#define BXCAN_FIFO_DEPTH    3U
+#define BXCAN_NUM_BANKS     14U
+
+typedef struct {
+    SimFrame Frame;
+    uint64_t Seq;               /* request order, for TXFP */
+    SimTime Requested;
+    int Pending;
+} Mailbox;
+
+typedef struct {
+    SimFrame Frame;
+    SimTime Eof;
+    uint8_t Fmi;
+} FifoEntry;
+
+typedef struct {
+    FifoEntry Msg[BXCAN_FIFO_DEPTH];
+    uint8_t Head;
+    uint8_t Count;
+    uint8_t Overrun;            /* FOVR */
+} Fifo;
+
+typedef struct {
+    uint32_t Fr1, Fr2;          /* CAN_FxR1/R2 as the SPL writes them */
+    uint8_t Mode;
+    uint8_t Scale;
+    uint8_t FifoNr;
+    uint8_t Active;
+} Bank;
+
+CAN_TypeDef Sim_Can1;
+BxcanStats Bxcan_Stats;
+
+static struct {
+    CAN_InitTypeDef Init;
+    uint32_t Ier;
+    Mailbox Tx[3];
+    uint64_t TxSeq;
+    uint8_t TxOk;               /* TXOKx of the last request per mailbox */
+    uint8_t Rqcp;               /* RQCPx */
+    Fifo Rx[2];
+    Bank Banks[BXCAN_NUM_BANKS];
+    SimTime LastRxEof;
+} can;
+
+static int bxcanOffer(SimNode* node, SimFrame* frame);
+static void bxcanTxDone(SimNode* node, int slot);
+static void bxcanRx(SimNode* node, const SimFrame* frame);
+
+SimNode Bxcan_Node = { "dut", bxcanOffer, bxcanTxDone, bxcanRx, NULL, 0, 0 };
+
+/* ================= Bus side ================= */
+static int bxcanOffer(SimNode* node, SimFrame* frame) {
+    (void)node;
+    int best = -1;
+    for (int i = 0; i < 3; i++) {
+        const Mailbox* m = &can.Tx[i];
+        if (!m->Pending) continue;
+        if (best < 0) { best = i; continue; }
+        const Mailbox* b = &can.Tx[best];
+        if (can.Init.CAN_TXFP == ENABLE ? (m->Seq < b->Seq) : (m->Frame.Id < b->Frame.Id)) {
+            best = i;
+        }
+    }
+    if (best >= 0) *frame = can.Tx[best].Frame;
+    return best;
+}
+
+static void bxcanTxDone(SimNode* node, int slot) {
+    (void)node;
+    Mailbox* m = &can.Tx[slot];
+    m->Pending = 0;
+    can.TxOk |= (uint8_t)(1U << slot);
+    can.Rqcp |= (uint8_t)(1U << slot);
+    Bxcan_Stats.TxFrames++;
+    Samples_Add(&Bxcan_Stats.TxQueueNs, (uint32_t)(Sim_Now() - m->Requested));
+    Cpu_Kick();
+}
+
+/* 32-bit filter image of a standard data frame: STID[31:21], IDE bit 2, RTR bit 1 */
+static uint32_t frameImage32(uint32_t id) {
+    return id << 21;
+}
+
+/* 16-bit image: STID[15:5], RTR bit 4, IDE bit 3 */
+static uint16_t frameImage16(uint32_t id) {
+    return (uint16_t)(id << 5);
+}
+
+/* Match against the 1, 2 or 4 filters of a bank; *sub = filter within the bank */
+static int bankMatch(const Bank* b, uint32_t id, unsigned* sub) {
+    if (b->Scale == CAN_FilterScale_32bit) {
+        uint32_t img = frameImage32(id);
+        if (b->Mode == CAN_FilterMode_IdMask) {
+            *sub = 0;
+            return ((img ^ b->Fr1) & b->Fr2) == 0U;
+        }
+        if (img == b->Fr1) { *sub = 0; return 1; }
+        if (img == b->Fr2) { *sub = 1; return 1; }
+        return 0;
+    }
+    uint16_t img = frameImage16(id);
+    if (b->Mode == CAN_FilterMode_IdMask) {
+        /* Two filters: id in the low half-word, mask in the high half-word */
+        if (((img ^ (uint16_t)b->Fr1) & (uint16_t)(b->Fr1 >> 16)) == 0U) { *sub = 0; return 1; }
+        if (((img ^ (uint16_t)b->Fr2) & (uint16_t)(b->Fr2 >> 16)) == 0U) { *sub = 1; return 1; }
+        return 0;
+    }
+    const uint16_t ids[4] = { (uint16_t)b->Fr1, (uint16_t)(b->Fr1 >> 16),
+                              (uint16_t)b->Fr2, (uint16_t)(b->Fr2 >> 16) };
+    for (unsigned i = 0; i < 4; i++) {
+        if (img == ids[i]) { *sub = i; return 1; }
+    }
+    return 0;
+}
+
+static unsigned bankFilters(const Bank* b) {
+    if (b->Scale == CAN_FilterScale_32bit) return (b->Mode == CAN_FilterMode_IdMask) ? 1U : 2U;
+    return (b->Mode == CAN_FilterMode_IdMask) ? 2U : 4U;
+}
+
+/* FIFO and filter match index (FMI): filters are numbered over all banks
+   assigned to the same FIFO, in bank order */
+static int acceptanceFilter(uint32_t id, uint8_t* fifo, uint8_t* fmi) {
+    static const struct { uint8_t Scale, Mode; } order[4] = {
+        { CAN_FilterScale_32bit, CAN_FilterMode_IdList },
+        { CAN_FilterScale_32bit, CAN_FilterMode_IdMask },
+        { CAN_FilterScale_16bit, CAN_FilterMode_IdList },
+        { CAN_FilterScale_16bit, CAN_FilterMode_IdMask }
+    };
+    for (unsigned o = 0; o < 4; o++) {
+        for (unsigned i = 0; i < BXCAN_NUM_BANKS; i++) {
+            const Bank* b = &can.Banks[i];
+            unsigned sub;
+            if (!b->Active || b->Scale != order[o].Scale || b->Mode != order[o].Mode ||
+                !bankMatch(b, id, &sub)) {
+                continue;
+            }
+            unsigned base = 0;
+            for (unsigned j = 0; j < i; j++) {
+                if (can.Banks[j].FifoNr == b->FifoNr) base += bankFilters(&can.Banks[j]);
+            }
+            *fifo = b->FifoNr;
+            *fmi = (uint8_t)(base + sub);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void bxcanRx(SimNode* node, const SimFrame* frame) {
+    (void)node;
+    uint8_t nr, fmi;
+    Bxcan_Stats.RxFrames++;
+    if (!acceptanceFilter(frame->Id, &nr, &fmi)) {
+        Bxcan_Stats.RxFiltered++;
+        return;
+    }
+    Fifo* f = &can.Rx[nr];
+    FifoEntry e = { *frame, Sim_Now(), fmi };
+    if (f->Count == BXCAN_FIFO_DEPTH) {
+        f->Overrun = 1;
+        Bxcan_Stats.RxOverruns[nr]++;
+        if (can.Init.CAN_RFLM != ENABLE) {
+            f->Msg[(f->Head + BXCAN_FIFO_DEPTH - 1U) % BXCAN_FIFO_DEPTH] = e;
+        }
+        return;
+    }
+    f->Msg[(f->Head + f->Count) % BXCAN_FIFO_DEPTH] = e;
+    f->Count++;
+    Bxcan_Stats.RxAccepted[nr]++;
+    Cpu_Kick();
+}
+
+static int bxcanRx0Pending(void) {
+    return (can.Ier & CAN_IT_FMP0) && can.Rx[0].Count > 0U;
+}
+
+static int bxcanTxPending(void) {
+    return (can.Ier & CAN_IT_TME) && can.Rqcp != 0U;
+}
+
+SimTime Bxcan_LastRxEof(void) {
+    return can.LastRxEof;
+}
+
+unsigned Bxcan_FifoLevel(uint8_t fifo) {
+    return can.Rx[fifo & 1U].Count;
+}
+
+/* ================= SPL API ================= */
+void CAN_DeInit(CAN_TypeDef* CANx) {
+    (void)CANx;
+    memset(&can, 0, sizeof(can));
+    Cpu_Irqs[SIM_IRQ_CAN_RX0].Pending = bxcanRx0Pending;
+    Cpu_Irqs[SIM_IRQ_CAN_TX].Pending = bxcanTxPending;
+}
+
+void CAN_StructInit(CAN_InitTypeDef* CAN_InitStruct) {
+    CAN_InitStruct->CAN_TTCM = DISABLE;
+    CAN_InitStruct->CAN_ABOM = DISABLE;
+    CAN_InitStruct->CAN_AWUM = DISABLE;
+    CAN_InitStruct->CAN_NART = DISABLE;
+    CAN_InitStruct->CAN_RFLM = DISABLE;
+    CAN_InitStruct->CAN_TXFP = DISABLE;
+    CAN_InitStruct->CAN_Mode = CAN_Mode_Normal;
+    CAN_InitStruct->CAN_SJW = CAN_SJW_1tq;
+    CAN_InitStruct->CAN_BS1 = CAN_BS1_4tq;
+    CAN_InitStruct->CAN_BS2 = CAN_BS2_3tq;
+    CAN_InitStruct->CAN_Prescaler = 1;
+}
+
+uint8_t CAN_Init(CAN_TypeDef* CANx, CAN_InitTypeDef* CAN_InitStruct) {
+    (void)CANx;
+    unsigned tq = 1U + (CAN_InitStruct->CAN_BS1 + 1U) + (CAN_InitStruct->CAN_BS2 + 1U);
+    uint64_t bitNs = (uint64_t)CAN_InitStruct->CAN_Prescaler * tq * SIM_S / SIM_PCLK1_HZ;
+    if (bitNs != Bus_BitTime()) {
+        fprintf(stderr, "cansim: Can_Init bit time %llu ns (prescaler %u, %u tq) does not match the bus (%llu ns)\n",
+                (unsigned long long)bitNs, CAN_InitStruct->CAN_Prescaler, tq,
+                (unsigned long long)Bus_BitTime());
+        exit(2);
+    }
+    if (CAN_InitStruct->CAN_Mode != CAN_Mode_Normal) {
+        fprintf(stderr, "cansim: only CAN_Mode_Normal is modelled\n");
+        exit(2);
+    }
+    can.Init = *CAN_InitStruct;
+    return CAN_InitStatus_Success;
+}
+
+void CAN_FilterInit(CAN_FilterInitTypeDef* CAN_FilterInitStruct) {
+    const CAN_FilterInitTypeDef* fi = CAN_FilterInitStruct;
+    if (fi->CAN_FilterNumber >= BXCAN_NUM_BANKS) return;
+    Bank* b = &can.Banks[fi->CAN_FilterNumber];
+    b->Mode = fi->CAN_FilterMode;
+    b->Scale = fi->CAN_FilterScale;
+    b->FifoNr = (uint8_t)(fi->CAN_FilterFIFOAssignment & 1U);
+    if (b->Scale == CAN_FilterScale_32bit) {
+        b->Fr1 = ((uint32_t)fi->CAN_FilterIdHigh << 16) | fi->CAN_FilterIdLow;
+        b->Fr2 = ((uint32_t)fi->CAN_FilterMaskIdHigh << 16) | fi->CAN_FilterMaskIdLow;
+    } else {
+        b->Fr1 = ((uint32_t)fi->CAN_FilterMaskIdLow << 16) | fi->CAN_FilterIdLow;
+        b->Fr2 = ((uint32_t)fi->CAN_FilterMaskIdHigh << 16) | fi->CAN_FilterIdHigh;
+    }
+    b->Active = (fi->CAN_FilterActivation == ENABLE);
+}
+
+void CAN_ITConfig(CAN_TypeDef* CANx, uint32_t CAN_IT, FunctionalState NewState) {
+    (void)CANx;
+    if (NewState != DISABLE) can.Ier |= CAN_IT;
+    else can.Ier &= ~CAN_IT;
+    Cpu_Kick();
+}
+
+uint8_t CAN_Transmit(CAN_TypeDef* CANx, CanTxMsg* TxMessage) {
+    (void)CANx;
+    if (TxMessage->IDE != CAN_Id_Standard || TxMessage->RTR != CAN_RTR_Data) {
+        fprintf(stderr, "cansim: only standard data frames are modelled\n");
+        exit(2);
+    }
+    Bxcan_Stats.TxRequests++;
+    for (uint8_t i = 0; i < 3U; i++) {
+        Mailbox* m = &can.Tx[i];
+        if (m->Pending) continue;
+        m->Frame.Id = TxMessage->StdId & 0x7FFU;
+        m->Frame.Dlc = (uint8_t)(TxMessage->DLC & 0x0FU);
+        memcpy(m->Frame.Data, TxMessage->Data, 8);
+        m->Seq = can.TxSeq++;
+        m->Requested = Sim_Now();
+        m->Pending = 1;
+        can.TxOk &= (uint8_t)~(1U << i);
+        can.Rqcp &= (uint8_t)~(1U << i);
+        Bus_Request();
+        return i;
+    }
+    Bxcan_Stats.TxNoMailbox++;
+    return CAN_TxStatus_NoMailBox;
+}
+
+uint8_t CAN_TransmitStatus(CAN_TypeDef* CANx, uint8_t TransmitMailbox) {
+    (void)CANx;
+    if (TransmitMailbox > 2U) return CAN_TxStatus_Failed;
+    if (can.Tx[TransmitMailbox].Pending) return CAN_TxStatus_Pending;
+    return (can.TxOk & (1U << TransmitMailbox)) ? CAN_TxStatus_Ok : CAN_TxStatus_Failed;
+}
+
+void CAN_Receive(CAN_TypeDef* CANx, uint8_t FIFONumber, CanRxMsg* RxMessage) {
+    (void)CANx;
+    Fifo* f = &can.Rx[FIFONumber & 1U];
+    const FifoEntry* e = &f->Msg[f->Head];      /* output mailbox; stale when empty, as on hardware */
+    RxMessage->StdId = e->Frame.Id;
+    RxMessage->ExtId = 0;
+    RxMessage->IDE = CAN_Id_Standard;
+    RxMessage->RTR = CAN_RTR_Data;
+    RxMessage->DLC = e->Frame.Dlc;
+    memcpy(RxMessage->Data, e->Frame.Data, 8);
+    RxMessage->FMI = e->Fmi;
+    can.LastRxEof = e->Eof;
+    CAN_FIFORelease(CANx, FIFONumber);
+    Bxcan_Stats.RxRead++;
+}
+
+void CAN_FIFORelease(CAN_TypeDef* CANx, uint8_t FIFONumber) {
+    (void)CANx;
+    Fifo* f = &can.Rx[FIFONumber & 1U];
+    if (f->Count == 0U) return;
+    f->Head = (uint8_t)((f->Head + 1U) % BXCAN_FIFO_DEPTH);
+    f->Count--;
+}
+
+uint8_t CAN_MessagePending(CAN_TypeDef* CANx, uint8_t FIFONumber) {
+    (void)CANx;
+    return can.Rx[FIFONumber & 1U].Count;
+}
+
+FlagStatus CAN_GetFlagStatus(CAN_TypeDef* CANx, uint32_t CAN_FLAG) {
+    (void)CANx;
+    switch (CAN_FLAG) {
+    case CAN_FLAG_FMP0: return can.Rx[0].Count ? SET : RESET;
+    case CAN_FLAG_FMP1: return can.Rx[1].Count ? SET : RESET;
+    case CAN_FLAG_FF0:  return (can.Rx[0].Count == BXCAN_FIFO_DEPTH) ? SET : RESET;
+    case CAN_FLAG_FF1:  return (can.Rx[1].Count == BXCAN_FIFO_DEPTH) ? SET : RESET;
+    case CAN_FLAG_FOV0: return can.Rx[0].Overrun ? SET : RESET;
+    case CAN_FLAG_FOV1: return can.Rx[1].Overrun ? SET : RESET;
+    case CAN_FLAG_RQCP0: return (can.Rqcp & 1U) ? SET : RESET;
+    case CAN_FLAG_RQCP1: return (can.Rqcp & 2U) ? SET : RESET;
+    case CAN_FLAG_RQCP2: return (can.Rqcp & 4U) ? SET : RESET;
+    default: return RESET;      /* error flags: the bus is error free */
+    }
+}
+
+/* Writing RQCPx clears TXOKx with it */
+static void clearRqcp(uint8_t mask) {
+    can.Rqcp &= (uint8_t)~mask;
+    can.TxOk &= (uint8_t)~mask;
+}
+
+void CAN_ClearFlag(CAN_TypeDef* CANx, uint32_t CAN_FLAG) {
+    (void)CANx;
+    if (CAN_FLAG == CAN_FLAG_FOV0) can.Rx[0].Overrun = 0;
+    if (CAN_FLAG == CAN_FLAG_FOV1) can.Rx[1].Overrun = 0;
+    if (CAN_FLAG == CAN_FLAG_RQCP0) clearRqcp(1U);
+    if (CAN_FLAG == CAN_FLAG_RQCP1) clearRqcp(2U);
+    if (CAN_FLAG == CAN_FLAG_RQCP2) clearRqcp(4U);
+}
+
+ITStatus CAN_GetITStatus(CAN_TypeDef* CANx, uint32_t CAN_IT) {
+    (void)CANx;
+    if ((can.Ier & CAN_IT) == 0U) return RESET;
+    switch (CAN_IT) {
+    case CAN_IT_FMP0: return can.Rx[0].Count ? SET : RESET;
+    case CAN_IT_FMP1: return can.Rx[1].Count ? SET : RESET;
+    case CAN_IT_FF0:  return (can.Rx[0].Count == BXCAN_FIFO_DEPTH) ? SET : RESET;
+    case CAN_IT_FF1:  return (can.Rx[1].Count == BXCAN_FIFO_DEPTH) ? SET : RESET;
+    case CAN_IT_FOV0: return can.Rx[0].Overrun ? SET : RESET;
+    case CAN_IT_FOV1: return can.Rx[1].Overrun ? SET : RESET;
+    case CAN_IT_TME:  return can.Rqcp ? SET : RESET;
+    default: return RESET;
+    }
+}
+
+/* FMPx follows the FIFO level and cannot be cleared by software */
+void CAN_ClearITPendingBit(CAN_TypeDef* CANx, uint32_t CAN_IT) {
+    (void)CANx;
+    if (CAN_IT == CAN_IT_FOV0) can.Rx[0].Overrun = 0;
+    if (CAN_IT == CAN_IT_FOV1) can.Rx[1].Overrun = 0;
+    if (CAN_IT == CAN_IT_TME) clearRqcp(7U);
+}
@@ -0,0 +1,1203 @@
+/*
+ * cansim.c
+ * Host virtual CAN bus for load and latency benchmarks of the CAN stack
+ * (Linux, C99)
+ *
+ * Build:  make cansim (top level)
+ * Use:    ./cansim [-d] [-l latency.csv] scenario.txt
+ *
+ * MCAL/Can/can.c, Canif/canif.c and CanTp/CanTp.c of the CAN demo are built
+ * unchanged against a bxCAN model (bxcan.c) on an in-process bus (bus.c)
+ * shared with scripted traffic generators. Everything runs on virtual time
+ * in ns, so a scenario gives the same figures on every run and machine.
+ *
+ * The code decides what happens (routing, filters, flow control, which
+ * frames are sent when); how long it takes is modelled. Every interrupt
+ * costs the fixed `isr` time of the scenario, however much code the
+ * handler ran, so the virtual figures below follow a change to the
+ * configuration or the protocol logic but not to the cost of an ISR. To
+ * compare two ISR versions, measure each on target (TRACE_EV_ISR cycles,
+ * trace_decode) and set `isr` to the result.
+ *
+ *   -d   deterministic output only (omit the host CPU time section)
+ *   -l   one line per RX indication: time_ns,can_id,latency_ns
+ *
+ * Reported:
+ *   RX-indication latency  end of frame on the bus -> return of the RX ISR
+ *                          that indicated it (FIFO wait, interrupt masking,
+ *                          the `isr` cost of earlier ISRs and of this one)
+ *   CF separation          tptx: end of a DUT consecutive frame -> start of
+ *                          the next one in the same block, against the STmin
+ *                          the tester asked for
+ *   drops                  FIFO overruns, frames not routed by CanIf,
+ *                          CanIf_Transmit failures (no mailbox), generator
+ *                          queue overflows
+ *   CPU time               modelled: calls x the scenario's `isr` cost;
+ *                          host: ns spent in each real handler call (the
+ *                          only figure taken from the executed code; varies
+ *                          with the machine, use for relative comparison)
+ *
+ * Scenario file, one directive per line, '#' starts a comment. Identifiers
+ * are standard 11-bit (decimal or 0x..), times take a unit (ns, us, ms, s):
+ *   bitrate  <bit/s>                    bus and DUT Can_Init timing (default 250000)
+ *   duration <time>                     simulated time (default 1 s)
+ *   seed     <n>                        generator randomness (default 1)
+ *   isr      can_rx|can_tx|gpt <time>   CPU time per interrupt (default 6 us / 2 us / 3 us)
+ *   lock     <period> <length>          main loop masks interrupts for length of every period
+ *   filter   <id> <mask>                Can_ConfigType filter (default: accept all)
+ *   rx       <id>                       CanIf RX route, indication only
+ *   gateway  <rx-id> <tx-id>            RX route sent again by CanIf_Transmit from the callback
+ *   tx       <id> <period> [dlc=n]      DUT frame sent from the main loop
+ *   tp       <req-id> <resp-id> <size> <period> [bs=n] [stmin=n]
+ *                                       ISO-TP tester sending size bytes to the DUT's CanTp
+ *   tptx     <dut-id> <fc-id> <size> <period> [bs=n] [stmin=n] [wait=n]
+ *                                       DUT CanTp_Transmit of size bytes to an ISO-TP tester
+ *                                       that answers with these FC parameters (wait: FC WAITs
+ *                                       before the first CTS of each transfer)
+ *   periodic <id> <period> [dlc=n] [offset=t]
+ *   burst    <id> <count> <period> [dlc=n] [offset=t]
+ *   random   <id>-<id> <frames/s> [dlc=n-m]     Poisson arrivals, uniform id and dlc
+ *   limit    overruns|latency|txfail|tptime|tpfail|stmin <value>
+ *                                       exit code 1 when exceeded (latency: p99; tptime,
+ *                                       tpfail: tp and tptx; stmin: CF separations below STmin)
+ * Each generator is a node with a 16-frame transmit queue, sent in order.
+ * CanIf takes at most 4 RX and 4 TX routes (CANIF_MAX_RX_PDUS/TX_PDUS).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+#include "can.h"
+#include "canif.h"
+#include "CanTp.h"
+
+#define GEN_QUEUE           16U
+#define MAX_GENERATORS      32U
+#define MAIN_PERIOD         (10U * SIM_MS)     /* CanTp_MainFunction, like the demo's Com tick */
+#define TP_SEG_SIZE         512U
+#define TP_TIMEOUT          (1000U * SIM_MS)   /* tester N_Bs */
+#define TP_PAD              0xCCU
+#define TP_FC_WAIT_DELAY    (20U * SIM_MS)     /* tester FC WAIT -> next FC */
+
+/* ================= Scenario ================= */
+typedef enum { ROUTE_RX, ROUTE_GATEWAY, ROUTE_TP } RxRouteKind;
+
+typedef struct {
+    uint32_t Id;
+    RxRouteKind Kind;
+    int TxPdu;                  /* gateway: CanIf TxPduId */
+    PduIdType TpChannel;        /* tp, tptx: CanTp channel */
+    uint64_t Indicated;
+    uint64_t Forwarded, ForwardFailed;
+} RxRoute;
+
+typedef struct {
+    uint32_t Id;
+    SimTime Period;             /* 0: not sent from the main loop */
+    uint8_t Dlc;
+    uint64_t Sent, Failed;
+} TxRoute;
+
+typedef enum { GEN_PERIODIC, GEN_BURST, GEN_RANDOM } GenKind;
+
+typedef struct {
+    SimNode Node;               /* first: callbacks get &Node */
+    char Name[40];
+    GenKind Kind;
+    uint32_t Id, IdHi;
+    uint8_t DlcLo, DlcHi;
+    SimTime Period, Offset;
+    uint32_t Count;
+    double Rate;
+    SimFrame Queue[GEN_QUEUE];
+    unsigned Head, Len;
+    uint64_t Queued, Dropped;
+} Generator;
+
+typedef enum { TP_IDLE, TP_SEND, TP_WAIT_FC, TP_WAIT_STMIN, TP_WAIT_DUT } TpState;
+
+typedef struct {
+    SimNode Node;
+    uint32_t ReqId, RespId;
+    uint32_t Size;
+    SimTime Period;
+    uint8_t Bs, Stmin;          /* DUT's FC parameters */
+    uint8_t* Data;
+    uint16_t Sum;
+    TpState State;
+    SimFrame Frame;             /* frame in the queue (TP_SEND) */
+    uint32_t Sent;
+    uint8_t Sn, BlockSize, BlockLeft;
+    SimTime StminNs;
+    uint32_t Gen;               /* timeout generation */
+    SimTime Start;
+    uint64_t Started, Done, Failed, Skipped, DataErrors;
+    SimSamples TimeNs;
+} TpPeer;
+
+typedef enum { TPR_IDLE, TPR_RECEIVING } TpReceiverState;
+
+typedef struct {
+    SimNode Node;
+    uint32_t DutId, FcId;
+    uint32_t Size;
+    SimTime Period;
+    uint8_t Bs, Stmin, Waits;   /* tester's FC parameters */
+    uint8_t* Data;              /* DUT's source buffer, owned by CanTp while DutBusy */
+    int DutBusy;
+    TpReceiverState State;
+    uint32_t Length, Received;
+    uint8_t Sn, BlockLeft, WaitsLeft;
+    SimFrame Fc;
+    int FcPending;
+    uint32_t Gen;               /* FC WAIT delay generation */
+    SimTime LastCfEof;          /* 0: no CF yet in this block */
+    SimTime Start;
+    uint64_t Started, Done, Confirmed, Failed, Skipped, DataErrors, StminBelow;
+    SimSamples TimeNs, CfGapNs;
+} TpReceiver;
+
+static struct {
+    uint32_t Bitrate;
+    SimTime Duration;
+    uint64_t Seed;
+    SimTime IsrCost[SIM_NUM_IRQS];
+    SimTime LockPeriod, LockLength;
+    uint32_t FilterId, FilterMask;
+    RxRoute Rx[CANIF_MAX_RX_PDUS];
+    unsigned NumRx;
+    TxRoute Tx[CANIF_MAX_TX_PDUS];
+    unsigned NumTx;
+    Generator* Gens[MAX_GENERATORS];
+    unsigned NumGens;
+    TpPeer* Tp;
+    TpReceiver* TpTx;
+    /* limits, -1: none */
+    long long LimOverruns, LimTxFail, LimTpFail, LimStmin;
+    long long LimLatency, LimTpTime;            /* ns */
+} scn = {
+    .Bitrate = 250000, .Duration = SIM_S, .Seed = 1,
+    .IsrCost = { [SIM_IRQ_CAN_TX] = 2 * SIM_US, [SIM_IRQ_CAN_RX0] = 6 * SIM_US, [SIM_IRQ_GPT] = 3 * SIM_US },
+    .FilterMask = 0,
+    .LimOverruns = -1, .LimTxFail = -1, .LimTpFail = -1, .LimStmin = -1, .LimLatency = -1, .LimTpTime = -1
+};
+
+static const char* scnPath;
+static unsigned lineNo;
+static FILE* latencyCsv;
+static SimSamples rxLatencyNs;
+
+static void fail(const char* what, const char* arg) {
+    fprintf(stderr, "%s:%u: %s%s%s\n", scnPath, lineNo, what, arg ? ": " : "", arg ? arg : "");
+    exit(2);
+}
+
+/* xorshift64*: one stream consumed in event order, so runs repeat exactly */
+static uint64_t rngState;
+
+static uint64_t rng(void) {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return rngState * 2685821657736338717ULL;
+}
+
+static uint32_t rngRange(uint32_t lo, uint32_t hi) {
+    return lo + (uint32_t)(rng() % (uint64_t)(hi - lo + 1U));
+}
+
+/* ----- value parsing ----- */
+static unsigned long parseNum(const char* s, unsigned long max) {
+    char* end;
+    unsigned long v = strtoul(s, &end, 0);
+    if (end == s || *end || v > max) fail("bad number", s);
+    return v;
+}
+
+static SimTime parseTime(const char* s) {
+    char* end;
+    double v = strtod(s, &end);
+    double unit;
+    if (end == s || v < 0) fail("bad time", s);
+    if (!strcmp(end, "ns")) unit = 1;
+    else if (!strcmp(end, "us")) unit = (double)SIM_US;
+    else if (!strcmp(end, "ms")) unit = (double)SIM_MS;
+    else if (!strcmp(end, "s")) unit = (double)SIM_S;
+    else fail("time needs a unit (ns, us, ms, s)", s);
+    return (SimTime)(v * unit + 0.5);
+}
+
+static void parseRange(const char* s, unsigned long max, unsigned long* lo, unsigned long* hi) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s", s);
+    char* dash = strchr(buf, '-');
+    if (dash) *dash = '\0';
+    *lo = parseNum(buf, max);
+    *hi = dash ? parseNum(dash + 1, max) : *lo;
+    if (*hi < *lo) fail("bad range", s);
+}
+
+/* key=value options after the positional arguments */
+static const char* option(char** tok, int n, int first, const char* key) {
+    size_t len = strlen(key);
+    for (int i = first; i < n; i++) {
+        if (!strncmp(tok[i], key, len) && tok[i][len] == '=') return tok[i] + len + 1;
+    }
+    return NULL;
+}
+
+static void checkOptions(char** tok, int n, int first, const char* const* keys) {
+    for (int i = first; i < n; i++) {
+        int ok = 0;
+        for (const char* const* k = keys; *k; k++) {
+            size_t len = strlen(*k);
+            if (!strncmp(tok[i], *k, len) && tok[i][len] == '=') ok = 1;
+        }
+        if (!ok) fail("unknown option", tok[i]);
+    }
+}
+
+/* ----- routes (CanIf PDU ids in order of appearance) ----- */
+static int addRx(uint32_t id, RxRouteKind kind) {
+    for (unsigned i = 0; i < scn.NumRx; i++) {
+        if (scn.Rx[i].Id == id) fail("RX route defined twice", NULL);
+    }
+    if (scn.NumRx == CANIF_MAX_RX_PDUS) fail("too many RX routes (CANIF_MAX_RX_PDUS)", NULL);
+    scn.Rx[scn.NumRx] = (RxRoute){ .Id = id, .Kind = kind, .TxPdu = -1 };
+    return (int)scn.NumRx++;
+}
+
+static int rxRoute(uint32_t id) {
+    for (unsigned i = 0; i < scn.NumRx; i++) {
+        if (scn.Rx[i].Id == id) return (int)i;
+    }
+    return -1;
+}
+
+static int addTx(uint32_t id) {
+    for (unsigned i = 0; i < scn.NumTx; i++) {
+        if (scn.Tx[i].Id == id) return (int)i;      /* shared by gateway and tx */
+    }
+    if (scn.NumTx == CANIF_MAX_TX_PDUS) fail("too many TX routes (CANIF_MAX_TX_PDUS)", NULL);
+    scn.Tx[scn.NumTx] = (TxRoute){ .Id = id };
+    return (int)scn.NumTx++;
+}
+
+static Generator* addGenerator(GenKind kind, const char* name) {
+    if (scn.NumGens == MAX_GENERATORS) fail("too many generators", NULL);
+    Generator* g = calloc(1, sizeof(*g));
+    if (!g) { perror("cansim"); exit(2); }
+    g->Kind = kind;
+    snprintf(g->Name, sizeof(g->Name), "%s", name);
+    g->DlcLo = g->DlcHi = 8;
+    scn.Gens[scn.NumGens++] = g;
+    return g;
+}
+
+static void parseDlc(Generator* g, const char* s) {
+    unsigned long lo, hi;
+    if (!s) return;
+    parseRange(s, 8, &lo, &hi);
+    g->DlcLo = (uint8_t)lo;
+    g->DlcHi = (uint8_t)hi;
+}
+
+static void parseLine(char** tok, int n) {
+    const char* d = tok[0];
+#define NEED(k) do { if (n < (k)) fail("missing argument", d); } while (0)
+    if (!strcmp(d, "bitrate")) {
+        NEED(2); scn.Bitrate = (uint32_t)parseNum(tok[1], 1000000);
+    } else if (!strcmp(d, "duration")) {
+        NEED(2); scn.Duration = parseTime(tok[1]);
+    } else if (!strcmp(d, "seed")) {
+        NEED(2); scn.Seed = parseNum(tok[1], 0xFFFFFFFFUL);
+    } else if (!strcmp(d, "isr")) {
+        NEED(3);
+        if (!strcmp(tok[1], "can_rx")) scn.IsrCost[SIM_IRQ_CAN_RX0] = parseTime(tok[2]);
+        else if (!strcmp(tok[1], "can_tx")) scn.IsrCost[SIM_IRQ_CAN_TX] = parseTime(tok[2]);
+        else if (!strcmp(tok[1], "gpt")) scn.IsrCost[SIM_IRQ_GPT] = parseTime(tok[2]);
+        else fail("unknown interrupt", tok[1]);
+    } else if (!strcmp(d, "lock")) {
+        NEED(3);
+        scn.LockPeriod = parseTime(tok[1]);
+        scn.LockLength = parseTime(tok[2]);
+        if (scn.LockLength >= scn.LockPeriod) fail("lock length must be below its period", NULL);
+    } else if (!strcmp(d, "filter")) {
+        NEED(3);
+        scn.FilterId = (uint32_t)parseNum(tok[1], 0x7FF);
+        scn.FilterMask = (uint32_t)parseNum(tok[2], 0x7FF);
+    } else if (!strcmp(d, "rx")) {
+        NEED(2); addRx((uint32_t)parseNum(tok[1], 0x7FF), ROUTE_RX);
+    } else if (!strcmp(d, "gateway")) {
+        NEED(3);
+        int r = addRx((uint32_t)parseNum(tok[1], 0x7FF), ROUTE_GATEWAY);
+        scn.Rx[r].TxPdu = addTx((uint32_t)parseNum(tok[2], 0x7FF));
+    } else if (!strcmp(d, "tx")) {
+        static const char* const keys[] = { "dlc", NULL };
+        NEED(3); checkOptions(tok, n, 3, keys);
+        TxRoute* t = &scn.Tx[addTx((uint32_t)parseNum(tok[1], 0x7FF))];
+        t->Period = parseTime(tok[2]);
+        const char* dlc = option(tok, n, 3, "dlc");
+        t->Dlc = dlc ? (uint8_t)parseNum(dlc, 8) : 8;
+        if (t->Period == 0) fail("tx period must not be 0", NULL);
+    } else if (!strcmp(d, "tp")) {
+        static const char* const keys[] = { "bs", "stmin", NULL };
+        NEED(5); checkOptions(tok, n, 5, keys);
+        if (scn.Tp) fail("only one tp tester", NULL);
+        TpPeer* p = calloc(1, sizeof(*p));
+        if (!p) { perror("cansim"); exit(2); }
+        p->ReqId = (uint32_t)parseNum(tok[1], 0x7FF);
+        p->RespId = (uint32_t)parseNum(tok[2], 0x7FF);
+        p->Size = (uint32_t)parseNum(tok[3], 0xFFFF);
+        p->Period = parseTime(tok[4]);
+        const char* bs = option(tok, n, 5, "bs");
+        const char* st = option(tok, n, 5, "stmin");
+        p->Bs = bs ? (uint8_t)parseNum(bs, 0xFF) : 0;
+        p->Stmin = st ? (uint8_t)parseNum(st, 0xFF) : 0;
+        if (p->Size == 0 || p->Period == 0) fail("tp size and period must not be 0", NULL);
+        addRx(p->ReqId, ROUTE_TP);
+        addTx(p->RespId);
+        scn.Tp = p;
+    } else if (!strcmp(d, "tptx")) {
+        static const char* const keys[] = { "bs", "stmin", "wait", NULL };
+        NEED(5); checkOptions(tok, n, 5, keys);
+        if (scn.TpTx) fail("only one tptx tester", NULL);
+        TpReceiver* r = calloc(1, sizeof(*r));
+        if (!r) { perror("cansim"); exit(2); }
+        r->DutId = (uint32_t)parseNum(tok[1], 0x7FF);
+        r->FcId = (uint32_t)parseNum(tok[2], 0x7FF);
+        r->Size = (uint32_t)parseNum(tok[3], 0xFFFF);
+        r->Period = parseTime(tok[4]);
+        const char* bs = option(tok, n, 5, "bs");
+        const char* st = option(tok, n, 5, "stmin");
+        const char* wt = option(tok, n, 5, "wait");
+        r->Bs = bs ? (uint8_t)parseNum(bs, 0xFF) : 0;
+        r->Stmin = st ? (uint8_t)parseNum(st, 0xFF) : 0;
+        r->Waits = wt ? (uint8_t)parseNum(wt, 0xFF) : 0;
+        if (r->Size == 0 || r->Period == 0) fail("tptx size and period must not be 0", NULL);
+        addRx(r->FcId, ROUTE_TP);
+        addTx(r->DutId);
+        scn.TpTx = r;
+    } else if (!strcmp(d, "periodic")) {
+        static const char* const keys[] = { "dlc", "offset", NULL };
+        NEED(3); checkOptions(tok, n, 3, keys);
+        char name[40];
+        Generator* g = addGenerator(GEN_PERIODIC, (snprintf(name, sizeof(name), "periodic %s", tok[1]), name));
+        g->Id = (uint32_t)parseNum(tok[1], 0x7FF);
+        g->Period = parseTime(tok[2]);
+        parseDlc(g, option(tok, n, 3, "dlc"));
+        const char* off = option(tok, n, 3, "offset");
+        g->Offset = off ? parseTime(off) : 0;
+        if (g->Period == 0) fail("period must not be 0", NULL);
+    } else if (!strcmp(d, "burst")) {
+        static const char* const keys[] = { "dlc", "offset", NULL };
+        NEED(4); checkOptions(tok, n, 4, keys);
+        char name[40];
+        Generator* g = addGenerator(GEN_BURST, (snprintf(name, sizeof(name), "burst %s", tok[1]), name));
+        g->Id = (uint32_t)parseNum(tok[1], 0x7FF);
+        g->Count = (uint32_t)parseNum(tok[2], GEN_QUEUE * 64U);
+        g->Period = parseTime(tok[3]);
+        parseDlc(g, option(tok, n, 4, "dlc"));
+        const char* off = option(tok, n, 4, "offset");
+        g->Offset = off ? parseTime(off) : 0;
+        if (g->Period == 0 || g->Count == 0) fail("burst count and period must not be 0", NULL);
+    } else if (!strcmp(d, "random")) {
+        static const char* const keys[] = { "dlc", NULL };
+        NEED(3); checkOptions(tok, n, 3, keys);
+        char name[40];
+        Generator* g = addGenerator(GEN_RANDOM, (snprintf(name, sizeof(name), "random %s", tok[1]), name));
+        unsigned long lo, hi;
+        parseRange(tok[1], 0x7FF, &lo, &hi);
+        g->Id = (uint32_t)lo;
+        g->IdHi = (uint32_t)hi;
+        g->Rate = strtod(tok[2], NULL);
+        parseDlc(g, option(tok, n, 3, "dlc"));
+        if (g->Rate <= 0) fail("bad rate", tok[2]);
+    } else if (!strcmp(d, "limit")) {
+        NEED(3);
+        if (!strcmp(tok[1], "overruns")) scn.LimOverruns = (long long)parseNum(tok[2], 0xFFFFFFFFUL);
+        else if (!strcmp(tok[1], "txfail")) scn.LimTxFail = (long long)parseNum(tok[2], 0xFFFFFFFFUL);
+        else if (!strcmp(tok[1], "tpfail")) scn.LimTpFail = (long long)parseNum(tok[2], 0xFFFFFFFFUL);
+        else if (!strcmp(tok[1], "stmin")) scn.LimStmin = (long long)parseNum(tok[2], 0xFFFFFFFFUL);
+        else if (!strcmp(tok[1], "latency")) scn.LimLatency = (long long)parseTime(tok[2]);
+        else if (!strcmp(tok[1], "tptime")) scn.LimTpTime = (long long)parseTime(tok[2]);
+        else fail("unknown limit", tok[1]);
+    } else {
+        fail("unknown directive", d);
+    }
+#undef NEED
+}
+
+static void readScenario(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (!f) { perror(path); exit(2); }
+    scnPath = path;
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        lineNo++;
+        char* hash = strchr(line, '#');
+        if (hash) *hash = '\0';
+        char* tok[16];
+        int n = 0;
+        for (char* t = strtok(line, " \t\r\n"); t && n < 16; t = strtok(NULL, " \t\r\n")) tok[n++] = t;
+        if (n > 0) parseLine(tok, n);
+    }
+    fclose(f);
+    lineNo = 0;
+}
+
+/* ================= Traffic generators ================= */
+static void genFill(Generator* g, uint32_t id) {
+    if (g->Len == GEN_QUEUE) {
+        g->Dropped++;
+        return;
+    }
+    SimFrame* f = &g->Queue[(g->Head + g->Len) % GEN_QUEUE];
+    f->Id = id;
+    f->Dlc = (uint8_t)rngRange(g->DlcLo, g->DlcHi);
+    uint64_t r = rng();
+    memcpy(f->Data, &r, 8);     /* random payload: realistic stuff bits */
+    g->Len++;
+    g->Queued++;
+    Bus_Request();
+}
+
+static int genOffer(SimNode* node, SimFrame* frame) {
+    Generator* g = (Generator*)node;
+    if (g->Len == 0) return -1;
+    *frame = g->Queue[g->Head];
+    return 0;
+}
+
+static void genTxDone(SimNode* node, int slot) {
+    Generator* g = (Generator*)node;
+    (void)slot;
+    g->Head = (g->Head + 1U) % GEN_QUEUE;
+    g->Len--;
+}
+
+static void genTick(void* ctx, uint32_t arg) {
+    Generator* g = ctx;
+    (void)arg;
+    SimTime next;
+    switch (g->Kind) {
+    case GEN_PERIODIC:
+        genFill(g, g->Id);
+        next = g->Period;
+        break;
+    case GEN_BURST:
+        for (uint32_t i = 0; i < g->Count; i++) genFill(g, g->Id);
+        next = g->Period;
+        break;
+    default: {
+        genFill(g, rngRange(g->Id, g->IdHi));
+        double u = ((double)(rng() >> 11) + 1.0) / 9007199254740993.0;    /* (0, 1] */
+        next = (SimTime)(-log(u) / g->Rate * (double)SIM_S) + 1U;
+        break;
+    }
+    }
+    Sim_At(Sim_Now() + next, genTick, g, 0);
+}
+
+static void startGenerator(Generator* g) {
+    g->Node.Name = g->Name;
+    g->Node.Offer = genOffer;
+    g->Node.TxDone = genTxDone;
+    g->Node.Rx = NULL;
+    Bus_Attach(&g->Node);
+    Sim_At(g->Offset, genTick, g, 0);
+}
+
+/* ================= ISO-TP tester (sender side of ISO 15765-2) ================= */
+static void tpFinish(TpPeer* p, int ok) {
+    if (ok) {
+        p->Done++;
+        Samples_Add(&p->TimeNs, (uint32_t)(Sim_Now() - p->Start));
+    } else {
+        p->Failed++;
+    }
+    p->State = TP_IDLE;
+    p->Gen++;
+}
+
+static void tpTimeout(void* ctx, uint32_t arg) {
+    TpPeer* p = ctx;
+    if (arg == p->Gen && p->State != TP_IDLE) tpFinish(p, 0);
+}
+
+static void tpArmTimeout(TpPeer* p) {
+    p->Gen++;
+    Sim_At(Sim_Now() + TP_TIMEOUT, tpTimeout, p, p->Gen);
+}
+
+static void tpQueue(TpPeer* p, const uint8_t* pci, unsigned pciLen, unsigned n) {
+    SimFrame* f = &p->Frame;
+    f->Id = p->ReqId;
+    f->Dlc = 8;
+    memset(f->Data, TP_PAD, 8);
+    memcpy(f->Data, pci, pciLen);
+    memcpy(f->Data + pciLen, p->Data + p->Sent, n);
+    p->State = TP_SEND;
+    Bus_Request();
+}
+
+static void tpNextCf(void* ctx, uint32_t arg) {
+    TpPeer* p = ctx;
+    if (arg != p->Gen || p->State != TP_WAIT_STMIN) return;
+    uint8_t pci = (uint8_t)(0x20U | p->Sn);
+    uint32_t n = p->Size - p->Sent;
+    tpQueue(p, &pci, 1, (n > 7U) ? 7U : n);
+}
+
+static void tpTick(void* ctx, uint32_t arg) {
+    TpPeer* p = ctx;
+    (void)arg;
+    Sim_At(Sim_Now() + p->Period, tpTick, p, 0);
+    if (p->State != TP_IDLE) {
+        p->Skipped++;           /* previous transfer still running */
+        return;
+    }
+    p->Started++;
+    p->Sum = 0;
+    for (uint32_t i = 0; i < p->Size; i++) {
+        p->Data[i] = (uint8_t)rng();
+        p->Sum = (uint16_t)(p->Sum + p->Data[i]);
+    }
+    p->Start = Sim_Now();
+    p->Sent = 0;
+    p->Sn = 1;
+    if (p->Size <= 7U) {
+        uint8_t pci = (uint8_t)p->Size;
+        tpQueue(p, &pci, 1, p->Size);
+    } else if (p->Size <= 4095U) {
+        uint8_t pci[2] = { (uint8_t)(0x10U | (p->Size >> 8)), (uint8_t)p->Size };
+        tpQueue(p, pci, 2, 6);
+    } else {
+        uint8_t pci[6] = { 0x10, 0x00, (uint8_t)(p->Size >> 24), (uint8_t)(p->Size >> 16),
+                           (uint8_t)(p->Size >> 8), (uint8_t)p->Size };
+        tpQueue(p, pci, 6, 2);
+    }
+    tpArmTimeout(p);
+}
+
+static int tpOffer(SimNode* node, SimFrame* frame) {
+    TpPeer* p = (TpPeer*)node;
+    if (p->State != TP_SEND) return -1;
+    *frame = p->Frame;
+    return 0;
+}
+
+static void tpTxDone(SimNode* node, int slot) {
+    TpPeer* p = (TpPeer*)node;
+    (void)slot;
+    uint8_t pci = p->Frame.Data[0];
+    switch (pci & 0xF0U) {
+    case 0x00:                  /* SF: the DUT's RxIndication ends the transfer */
+        p->Sent = p->Size;
+        p->State = TP_WAIT_DUT;
+        return;
+    case 0x10:
+        p->Sent = (pci & 0x0FU) || p->Frame.Data[1] ? 6U : 2U;
+        p->State = TP_WAIT_FC;
+        tpArmTimeout(p);
+        return;
+    default: {
+        uint32_t n = p->Size - p->Sent;
+        p->Sent += (n > 7U) ? 7U : n;
+        p->Sn = (uint8_t)((p->Sn + 1U) & 0x0FU);
+        if (p->Sent == p->Size) {
+            p->State = TP_WAIT_DUT;
+        } else if (p->BlockSize && --p->BlockLeft == 0U) {
+            p->State = TP_WAIT_FC;
+            tpArmTimeout(p);
+        } else {
+            p->State = TP_WAIT_STMIN;
+            Sim_At(Sim_Now() + p->StminNs, tpNextCf, p, p->Gen);
+        }
+        return;
+    }
+    }
+}
+
+static SimTime tpStmin(uint8_t st) {
+    if (st <= 0x7FU) return st * SIM_MS;
+    if (st >= 0xF1U && st <= 0xF9U) return (st - 0xF0U) * 100U * SIM_US;
+    return 0x7FU * SIM_MS;      /* reserved: longest */
+}
+
+static void tpRx(SimNode* node, const SimFrame* f) {
+    TpPeer* p = (TpPeer*)node;
+    if (f->Id != p->RespId || p->State != TP_WAIT_FC || (f->Data[0] & 0xF0U) != 0x30U) return;
+    switch (f->Data[0] & 0x0FU) {
+    case 0:                     /* CTS */
+        p->BlockSize = f->Data[1];
+        p->BlockLeft = f->Data[1];
+        p->StminNs = tpStmin(f->Data[2]);
+        p->Gen++;
+        p->State = TP_WAIT_STMIN;
+        tpNextCf(p, p->Gen);
+        break;
+    case 1:                     /* WAIT */
+        tpArmTimeout(p);
+        break;
+    default:                    /* OVFLW */
+        tpFinish(p, 0);
+        break;
+    }
+}
+
+static void startTp(TpPeer* p) {
+    p->Data = malloc(p->Size);
+    if (!p->Data) { perror("cansim"); exit(2); }
+    p->Node.Name = "tp";
+    p->Node.Offer = tpOffer;
+    p->Node.TxDone = tpTxDone;
+    p->Node.Rx = tpRx;
+    Bus_Attach(&p->Node);
+    Sim_At(p->Period, tpTick, p, 0);
+}
+
+/* ================= ISO-TP tester (receiver side, for the DUT's CanTp_Transmit) ================= */
+static void tprEnd(TpReceiver* r, int ok) {
+    if (ok) {
+        r->Done++;
+        Samples_Add(&r->TimeNs, (uint32_t)(Sim_Now() - r->Start));
+    } else {
+        r->Failed++;
+    }
+    r->State = TPR_IDLE;
+    r->FcPending = 0;
+    r->Gen++;
+}
+
+/* FC for the FF or the end of a block: the configured WAITs first, then CTS */
+static void tprQueueFc(TpReceiver* r) {
+    SimFrame* f = &r->Fc;
+    f->Id = r->FcId;
+    f->Dlc = 8;
+    memset(f->Data, TP_PAD, 8);
+    if (r->WaitsLeft) {
+        f->Data[0] = 0x31;
+        r->WaitsLeft--;
+    } else {
+        f->Data[0] = 0x30;
+        f->Data[1] = r->Bs;
+        f->Data[2] = r->Stmin;
+        r->BlockLeft = r->Bs;
+        r->LastCfEof = 0;       /* separations are measured inside a block */
+    }
+    r->FcPending = 1;
+    Bus_Request();
+}
+
+static void tprFcAgain(void* ctx, uint32_t arg) {
+    TpReceiver* r = ctx;
+    if (arg == r->Gen && r->State == TPR_RECEIVING) tprQueueFc(r);
+}
+
+static int tprOffer(SimNode* node, SimFrame* frame) {
+    TpReceiver* r = (TpReceiver*)node;
+    if (!r->FcPending) return -1;
+    *frame = r->Fc;
+    return 0;
+}
+
+static void tprTxDone(SimNode* node, int slot) {
+    TpReceiver* r = (TpReceiver*)node;
+    (void)slot;
+    r->FcPending = 0;
+    if (r->Fc.Data[0] == 0x31U) Sim_At(Sim_Now() + TP_FC_WAIT_DELAY, tprFcAgain, r, r->Gen);
+}
+
+/* Payload against the DUT's buffer (unchanged while the transfer runs) */
+static void tprCheck(TpReceiver* r, const uint8_t* data, uint32_t n) {
+    if (r->Received + n > r->Size || memcmp(data, r->Data + r->Received, n) != 0) r->DataErrors++;
+    r->Received += n;
+}
+
+static void tprRx(SimNode* node, const SimFrame* f) {
+    TpReceiver* r = (TpReceiver*)node;
+    if (f->Id != r->DutId) return;
+    uint8_t pci = f->Data[0];
+    switch (pci & 0xF0U) {
+    case 0x00:                  /* SF */
+        r->Gen++;
+        r->Received = 0;
+        r->Length = pci & 0x0FU;
+        tprCheck(r, &f->Data[1], r->Length);
+        tprEnd(r, r->Length == r->Size);
+        return;
+    case 0x10: {                /* FF */
+        uint32_t len = ((uint32_t)(pci & 0x0FU) << 8) | f->Data[1];
+        unsigned off = 2;
+        if (len == 0U) {
+            len = ((uint32_t)f->Data[2] << 24) | ((uint32_t)f->Data[3] << 16) |
+                  ((uint32_t)f->Data[4] << 8) | f->Data[5];
+            off = 6;
+        }
+        r->Gen++;
+        r->State = TPR_RECEIVING;
+        r->Length = len;
+        r->Received = 0;
+        r->Sn = 1;
+        r->WaitsLeft = r->Waits;
+        if (len != r->Size) r->DataErrors++;
+        tprCheck(r, &f->Data[off], 8U - off);
+        tprQueueFc(r);
+        return;
+    }
+    case 0x20: {                /* CF */
+        if (r->State != TPR_RECEIVING) return;
+        if ((pci & 0x0FU) != r->Sn) {
+            tprEnd(r, 0);
+            return;
+        }
+        SimTime sof = Sim_Now() - Bus_FrameBits(f) * Bus_BitTime();
+        if (r->LastCfEof) {
+            SimTime gap = sof - r->LastCfEof;
+            Samples_Add(&r->CfGapNs, (uint32_t)gap);
+            if (gap < tpStmin(r->Stmin)) r->StminBelow++;
+        }
+        r->LastCfEof = Sim_Now();
+        uint32_t n = r->Length - r->Received;
+        tprCheck(r, &f->Data[1], (n > 7U) ? 7U : n);
+        r->Sn = (uint8_t)((r->Sn + 1U) & 0x0FU);
+        if (r->Received >= r->Length) {
+            tprEnd(r, 1);
+        } else if (r->Bs && --r->BlockLeft == 0U) {
+            tprQueueFc(r);
+        }
+        return;
+    }
+    default:
+        return;
+    }
+}
+
+static void startTpTx(TpReceiver* r) {
+    r->Data = malloc(r->Size);
+    if (!r->Data) { perror("cansim"); exit(2); }
+    r->Node.Name = "tptx";
+    r->Node.Offer = tprOffer;
+    r->Node.TxDone = tprTxDone;
+    r->Node.Rx = tprRx;
+    Bus_Attach(&r->Node);
+}
+
+/* ================= DUT application ================= */
+/* CanTp consumer as in the CAN demo: two segments, checksum in the main loop */
+static uint8_t tpBuf[2][TP_SEG_SIZE];
+static uint16_t tpFill[2];
+static uint8_t tpSeg, tpNext;
+static uint32_t tpLength, tpHanded;
+static uint8_t tpDone;
+static uint16_t tpSum;
+
+static PduIdType tpRxChannel, tpTxChannel;
+
+static Std_ReturnType App_TpRxStart(PduIdType Channel, uint32_t Length, CanTp_SegmentType* Segment) {
+    if (Channel != tpRxChannel || scn.Tp == NULL) return E_NOT_OK;
+    if (tpDone != 0U || tpFill[0] != 0U || tpFill[1] != 0U) return E_NOT_OK;
+    tpLength = Length;
+    tpHanded = 0;
+    tpSeg = 0;
+    Segment->Data = tpBuf[0];
+    Segment->Size = TP_SEG_SIZE;
+    return E_OK;
+}
+
+static Std_ReturnType App_TpRxSegment(PduIdType Channel, CanTp_SegmentType* Segment) {
+    (void)Channel;
+    if (tpFill[tpSeg] == 0U) {
+        tpFill[tpSeg] = Segment->Size;
+        tpHanded += Segment->Size;
+    }
+    uint8_t next = (uint8_t)(tpSeg ^ 1U);
+    if (tpFill[next] != 0U) return E_NOT_OK;
+    tpSeg = next;
+    Segment->Data = tpBuf[next];
+    Segment->Size = TP_SEG_SIZE;
+    return E_OK;
+}
+
+static void App_TpRxIndication(PduIdType Channel, Std_ReturnType Result) {
+    if (Channel != tpRxChannel || scn.Tp == NULL) return;
+    if (Result == E_OK) {
+        tpFill[tpSeg] = (uint16_t)(tpLength - tpHanded);
+        tpDone = 1;
+        if (scn.Tp->State == TP_WAIT_DUT) tpFinish(scn.Tp, 1);
+    } else {
+        tpDone = 2;
+        if (scn.Tp->State != TP_IDLE) tpFinish(scn.Tp, 0);
+    }
+}
+
+/* DUT transmitter: one message every period from the main loop, buffer kept until the confirmation */
+static void App_TpTxConfirmation(PduIdType Channel, Std_ReturnType Result) {
+    TpReceiver* r = scn.TpTx;
+    if (Channel != tpTxChannel || r == NULL) return;
+    r->DutBusy = 0;
+    if (Result == E_OK) {
+        r->Confirmed++;
+    } else if (r->State != TPR_IDLE) {
+        tprEnd(r, 0);           /* N_Bs or FC OVFLW on the DUT side */
+    }
+}
+
+static void App_TpTransmit(void) {
+    TpReceiver* r = scn.TpTx;
+    if (r->DutBusy) {
+        r->Skipped++;           /* previous transfer still running */
+        return;
+    }
+    for (uint32_t i = 0; i < r->Size; i++) r->Data[i] = (uint8_t)rng();
+    r->Started++;
+    r->Start = Sim_Now();
+    r->DutBusy = 1;
+    if (CanTp_Transmit(tpTxChannel, r->Data, r->Size) != E_OK) {
+        r->DutBusy = 0;
+        r->Failed++;            /* no mailbox for the SF/FF */
+    }
+}
+
+static void tptxTick(void* ctx, uint32_t arg) {
+    TpReceiver* r = ctx;
+    (void)arg;
+    Sim_At(Sim_Now() + r->Period, tptxTick, r, 0);
+    Cpu_RunMain(App_TpTransmit);
+}
+
+static const CanTp_ChannelConfigType tpChannelDefault = {
+    .TxPduId = 0, .BlockSize = 0, .STmin = 0, .TimeoutMs = 1000, .MaxWaits = 10,
+    .Padding = TRUE, .PaddingByte = TP_PAD
+};
+static CanTp_ChannelConfigType tpChannels[CANTP_MAX_CHANNELS];
+static CanTp_ConfigType tpCfg = {
+    .Channels = tpChannels, .numChannels = 0, .GptChannel = 0,
+    .MainFunctionPeriodMs = (uint16_t)(MAIN_PERIOD / SIM_MS),
+    .RxStart = App_TpRxStart, .RxSegment = App_TpRxSegment,
+    .RxIndication = App_TpRxIndication, .TxConfirmation = App_TpTxConfirmation
+};
+
+static const Gpt_ChannelConfigType gptChannels[1] = {
+    { GPT_CH_MODE_ONESHOT, CanTp_GptNotification }
+};
+static const Gpt_ConfigType gptCfg = { GPT_HW_TIM2, 0, gptChannels, 1 };
+
+static void App_TpMain(void) {
+    if (scn.Tp == NULL) return;
+    while (tpFill[tpNext] != 0U) {
+        for (uint16_t i = 0; i < tpFill[tpNext]; i++) tpSum = (uint16_t)(tpSum + tpBuf[tpNext][i]);
+        tpFill[tpNext] = 0;
+        tpNext ^= 1U;
+    }
+    if (tpDone == 0U) return;
+    if (tpDone == 1U && (tpLength != scn.Tp->Size || tpSum != scn.Tp->Sum)) scn.Tp->DataErrors++;
+    tpNext = 0;
+    tpSum = 0;
+    tpDone = 0;
+}
+
+static void App_MainFunction(void) {
+    CanTp_MainFunction();
+    App_TpMain();
+}
+
+static void mainTick(void* ctx, uint32_t arg) {
+    (void)ctx; (void)arg;
+    Cpu_RunMain(App_MainFunction);
+    Sim_At(Sim_Now() + MAIN_PERIOD, mainTick, NULL, 0);
+}
+
+/* DUT frames sent from the main loop */
+static TxRoute* txCurrent;
+
+static void App_SendTx(void) {
+    TxRoute* t = txCurrent;
+    uint8_t data[8];
+    uint64_t r = rng();
+    memcpy(data, &r, 8);
+    if (CanIf_Transmit((uint32_t)(t - scn.Tx), data, t->Dlc) == 0) t->Sent++;
+    else t->Failed++;
+}
+
+static void txTick(void* ctx, uint32_t arg) {
+    (void)arg;
+    txCurrent = ctx;
+    App_SendTx();               /* main loop task: zero time, not delayed by ISRs */
+    Sim_At(Sim_Now() + txCurrent->Period, txTick, ctx, 0);
+}
+
+/* CanIf rxIndication: the upper layer of the DUT (PduR in the demo) */
+static void App_RxIndication(uint32_t RxPduId, uint8_t* data, uint8_t len) {
+    RxRoute* r = &scn.Rx[RxPduId];
+    /* The handler runs at entry; the frame is with the upper layer once it returns */
+    SimTime latency = Sim_Now() + Cpu_Irqs[SIM_IRQ_CAN_RX0].Cost - Bxcan_LastRxEof();
+    Samples_Add(&rxLatencyNs, (uint32_t)latency);
+    if (latencyCsv) {
+        fprintf(latencyCsv, "%llu,0x%03X,%llu\n", (unsigned long long)Sim_Now(),
+                (unsigned)r->Id, (unsigned long long)latency);
+    }
+    r->Indicated++;
+    if (r->Kind == ROUTE_GATEWAY) {
+        if (CanIf_Transmit((uint32_t)r->TxPdu, data, len) == 0) r->Forwarded++;
+        else r->ForwardFailed++;
+    } else if (r->Kind == ROUTE_TP) {
+        CanTp_RxIndication(r->TpChannel, data, len);
+    }
+}
+
+/* CanIf txConfirmation: CanTp starts STmin when its CF has left the bus (App_TxConfirm in the demo) */
+static void App_TxConfirmation(uint32_t TxPduId) {
+    CanTp_TxConfirmation((PduIdType)TxPduId);
+}
+
+static Can_ConfigType canCfg;
+static CanIf_ConfigType canIfCfg;
+
+/* Prescaler and segments for the bit rate from PCLK1, sample point near 87.5 % */
+static void dutTiming(uint32_t bitrate) {
+    static const uint8_t tqs[] = { 16, 18, 20, 12, 24, 15, 10, 25, 14, 9, 8 };
+    for (unsigned i = 0; i < sizeof(tqs); i++) {
+        uint32_t tq = tqs[i];
+        if (SIM_PCLK1_HZ % (bitrate * tq) != 0U) continue;
+        uint32_t bs2 = (tq + 4U) / 8U;
+        canCfg.CAN_Prescaler = (uint16_t)(SIM_PCLK1_HZ / (bitrate * tq));
+        canCfg.CAN_BS1 = (uint8_t)(tq - 1U - bs2 - 1U);    /* CAN_BS1_1tq = 0 */
+        canCfg.CAN_BS2 = (uint8_t)(bs2 - 1U);
+        return;
+    }
+    fprintf(stderr, "cansim: %lu bit/s cannot be reached from PCLK1 = %lu Hz\n",
+            (unsigned long)bitrate, (unsigned long)SIM_PCLK1_HZ);
+    exit(2);
+}
+
+static void startDut(void) {
+    dutTiming(scn.Bitrate);
+    canCfg.CAN_Mode = CAN_Mode_Normal;
+    canCfg.CAN_SJW = CAN_SJW_1tq;
+    canCfg.FilterIdHigh = (uint16_t)(scn.FilterId << 5);
+    canCfg.FilterMaskIdHigh = (uint16_t)(scn.FilterMask << 5);
+
+    canIfCfg.numControllers = 1;
+    canIfCfg.defaultControllerMode[0] = CANIF_CONTROLLER_STARTED;
+    canIfCfg.numTxPdus = (uint8_t)scn.NumTx;
+    canIfCfg.numRxPdus = (uint8_t)scn.NumRx;
+    for (unsigned i = 0; i < scn.NumTx; i++) {
+        canIfCfg.defaultTxPduMode[i] = CANIF_ONLINE;
+        canIfCfg.routingTable[canIfCfg.numRoutingEntry++] = (CanIf_RoutingEntry){ i, scn.Tx[i].Id, 1 };
+    }
+    for (unsigned i = 0; i < scn.NumRx; i++) {
+        canIfCfg.defaultRxPduMode[i] = CANIF_ONLINE;
+        canIfCfg.routingTable[canIfCfg.numRoutingEntry++] = (CanIf_RoutingEntry){ i, scn.Rx[i].Id, 0 };
+    }
+    canIfCfg.rxIndication = App_RxIndication;
+    canIfCfg.txConfirmation = App_TxConfirmation;
+
+    for (int i = 0; i < SIM_NUM_IRQS; i++) Cpu_Irqs[i].Cost = scn.IsrCost[i];
+    Cpu_Irqs[SIM_IRQ_CAN_RX0].Handler = USB_LP_CAN1_RX0_IRQHandler;
+    Cpu_Irqs[SIM_IRQ_CAN_TX].Handler = USB_HP_CAN1_TX_IRQHandler;
+    Cpu_SetLock(scn.LockPeriod, scn.LockLength);
+
+    /* Same order as the demo's main(): Gpt, Can, CanTp, CanIf */
+    Gpt_Init(&gptCfg);
+    Can_Init(&canCfg);
+    if (scn.Tp) {
+        CanTp_ChannelConfigType* c = &tpChannels[tpCfg.numChannels];
+        tpRxChannel = tpCfg.numChannels++;
+        *c = tpChannelDefault;
+        c->TxPduId = (PduIdType)addTx(scn.Tp->RespId);
+        c->BlockSize = scn.Tp->Bs;
+        c->STmin = scn.Tp->Stmin;
+        scn.Rx[rxRoute(scn.Tp->ReqId)].TpChannel = tpRxChannel;
+    }
+    if (scn.TpTx) {
+        CanTp_ChannelConfigType* c = &tpChannels[tpCfg.numChannels];
+        tpTxChannel = tpCfg.numChannels++;
+        *c = tpChannelDefault;
+        c->TxPduId = (PduIdType)addTx(scn.TpTx->DutId);
+        scn.Rx[rxRoute(scn.TpTx->FcId)].TpChannel = tpTxChannel;
+    }
+    if (tpCfg.numChannels) CanTp_Init(&tpCfg);
+    CanIf_Init(&canIfCfg);
+    Bus_Attach(&Bxcan_Node);
+
+    for (unsigned i = 0; i < scn.NumTx; i++) {
+        if (scn.Tx[i].Period) Sim_At(scn.Tx[i].Period, txTick, &scn.Tx[i], 0);
+    }
+    if (scn.Tp || scn.TpTx) Sim_At(MAIN_PERIOD, mainTick, NULL, 0);
+    if (scn.TpTx) Sim_At(scn.TpTx->Period, tptxTick, scn.TpTx, 0);
+}
+
+/* ================= Report ================= */
+static double us(uint64_t ns) {
+    return (double)ns / (double)SIM_US;
+}
+
+static int exceeded;
+
+static void checkLimit(const char* what, long long limit, long long value, int isTime) {
+    if (limit < 0 || value <= limit) return;
+    exceeded = 1;
+    if (isTime) printf("LIMIT %s %.1f us > %.1f us\n", what, us((uint64_t)value), us((uint64_t)limit));
+    else printf("LIMIT %s %lld > %lld\n", what, value, limit);
+}
+
+static void report(int deterministic) {
+    printf("cansim: %s, %.3f s at %lu bit/s, seed %llu\n", scnPath, (double)scn.Duration / SIM_S,
+           (unsigned long)scn.Bitrate, (unsigned long long)scn.Seed);
+    printf("bus      %llu frames, load %.1f %%\n", (unsigned long long)Bus_Frames(),
+           100.0 * (double)Bus_BusyTime() / (double)scn.Duration);
+
+    printf("nodes    %-20s %10s %10s %10s\n", "", "sent", "queued", "dropped");
+    printf("         %-20s %10llu\n", "dut", (unsigned long long)Bxcan_Node.TxFrames);
+    for (unsigned i = 0; i < scn.NumGens; i++) {
+        const Generator* g = scn.Gens[i];
+        printf("         %-20s %10llu %10llu %10llu\n", g->Name, (unsigned long long)g->Node.TxFrames,
+               (unsigned long long)g->Queued, (unsigned long long)g->Dropped);
+    }
+    if (scn.Tp) printf("         %-20s %10llu\n", "tp tester", (unsigned long long)scn.Tp->Node.TxFrames);
+    if (scn.TpTx) printf("         %-20s %10llu\n", "tptx tester", (unsigned long long)scn.TpTx->Node.TxFrames);
+
+    const BxcanStats* s = &Bxcan_Stats;
+    uint64_t indicated = 0, txFail = 0;
+    for (unsigned i = 0; i < scn.NumRx; i++) indicated += scn.Rx[i].Indicated;
+    printf("dut rx   seen %llu, filtered %llu, fifo0 %llu, fifo1 %llu, overruns %llu/%llu, read %llu, "
+           "indicated %llu, not routed %llu\n",
+           (unsigned long long)s->RxFrames, (unsigned long long)s->RxFiltered,
+           (unsigned long long)s->RxAccepted[0], (unsigned long long)s->RxAccepted[1],
+           (unsigned long long)s->RxOverruns[0], (unsigned long long)s->RxOverruns[1],
+           (unsigned long long)s->RxRead, (unsigned long long)indicated,
+           (unsigned long long)(s->RxRead - indicated));
+    printf("latency  rx indication (us, modelled isr cost): n %zu, min %.1f, mean %.1f, p50 %.1f, p99 %.1f, max %.1f\n",
+           rxLatencyNs.n, us(Samples_Pct(&rxLatencyNs, 0)), Samples_Mean(&rxLatencyNs) / SIM_US,
+           us(Samples_Pct(&rxLatencyNs, 50)), us(Samples_Pct(&rxLatencyNs, 99)),
+           us(Samples_Pct(&rxLatencyNs, 100)));
+    printf("dut tx   requests %llu, no mailbox %llu, sent %llu; request -> end of frame (us): p50 %.1f, p99 %.1f, max %.1f\n",
+           (unsigned long long)s->TxRequests, (unsigned long long)s->TxNoMailbox,
+           (unsigned long long)s->TxFrames, us(Samples_Pct(&Bxcan_Stats.TxQueueNs, 50)),
+           us(Samples_Pct(&Bxcan_Stats.TxQueueNs, 99)), us(Samples_Pct(&Bxcan_Stats.TxQueueNs, 100)));
+    for (unsigned i = 0; i < scn.NumRx; i++) {
+        const RxRoute* r = &scn.Rx[i];
+        if (r->Kind != ROUTE_GATEWAY) continue;
+        printf("         gateway 0x%03X -> 0x%03X: forwarded %llu, failed %llu\n", (unsigned)r->Id,
+               (unsigned)scn.Tx[r->TxPdu].Id, (unsigned long long)r->Forwarded,
+               (unsigned long long)r->ForwardFailed);
+        txFail += r->ForwardFailed;
+    }
+    for (unsigned i = 0; i < scn.NumTx; i++) {
+        const TxRoute* t = &scn.Tx[i];
+        if (!t->Period) continue;
+        printf("         tx 0x%03X: sent %llu, failed %llu\n", (unsigned)t->Id,
+               (unsigned long long)t->Sent, (unsigned long long)t->Failed);
+        txFail += t->Failed;
+    }
+
+    TpPeer* p = scn.Tp;
+    if (p) {
+        double meanNs = Samples_Mean(&p->TimeNs);
+        printf("tp       %u B every %.0f ms: started %llu, done %llu, failed %llu, skipped %llu, data errors %llu\n",
+               (unsigned)p->Size, (double)p->Period / SIM_MS, (unsigned long long)p->Started,
+               (unsigned long long)p->Done, (unsigned long long)p->Failed,
+               (unsigned long long)p->Skipped, (unsigned long long)p->DataErrors);
+        if (p->Done) {
+            printf("         transfer (ms): mean %.2f, max %.2f; %.0f B/s\n", meanNs / SIM_MS,
+                   (double)Samples_Pct(&p->TimeNs, 100) / SIM_MS, (double)p->Size * SIM_S / meanNs);
+        }
+    }
+
+    TpReceiver* r = scn.TpTx;
+    uint64_t tpTxLost = 0;
+    if (r) {
+        /* Started but neither done nor failed: lost, unless it is the one still running */
+        tpTxLost = r->Started - r->Done - r->Failed - (uint64_t)(r->DutBusy || r->State != TPR_IDLE);
+        printf("tptx     %u B every %.0f ms, tester bs %u stmin 0x%02X wait %u: started %llu, done %llu, "
+               "confirmed %llu, failed %llu, lost %llu, skipped %llu, data errors %llu\n",
+               (unsigned)r->Size, (double)r->Period / SIM_MS, r->Bs, r->Stmin, r->Waits,
+               (unsigned long long)r->Started, (unsigned long long)r->Done, (unsigned long long)r->Confirmed,
+               (unsigned long long)r->Failed, (unsigned long long)tpTxLost, (unsigned long long)r->Skipped,
+               (unsigned long long)r->DataErrors);
+        if (r->Done) {
+            double meanNs = Samples_Mean(&r->TimeNs);
+            printf("         transfer (ms): mean %.2f, max %.2f; %.0f B/s\n", meanNs / SIM_MS,
+                   (double)Samples_Pct(&r->TimeNs, 100) / SIM_MS, (double)r->Size * SIM_S / meanNs);
+        }
+        printf("         CF separation (us): n %zu, min %.1f, p50 %.1f, max %.1f; below STmin (%.1f us) %llu\n",
+               r->CfGapNs.n, us(Samples_Pct(&r->CfGapNs, 0)), us(Samples_Pct(&r->CfGapNs, 50)),
+               us(Samples_Pct(&r->CfGapNs, 100)), us(tpStmin(r->Stmin)), (unsigned long long)r->StminBelow);
+    }
+
+    printf("cpu      modelled: ");
+    for (int i = 0; i < SIM_NUM_IRQS; i++) {
+        const SimIrq* irq = &Cpu_Irqs[i];
+        printf("%s%s %llu calls x %.1f us = %.1f %%", i ? ", " : "", irq->Name,
+               (unsigned long long)irq->Calls, us(irq->Cost),
+               100.0 * (double)(irq->Calls * irq->Cost) / (double)scn.Duration);
+    }
+    printf("\n");
+    if (!deterministic) {
+        printf("host     ns per handler call (this machine):");
+        for (int i = 0; i < SIM_NUM_IRQS; i++) {
+            SimIrq* irq = &Cpu_Irqs[i];
+            if (!irq->Calls) continue;
+            printf(" %s mean %.0f p50 %u p99 %u;", irq->Name, Samples_Mean(&irq->HostNs),
+                   Samples_Pct(&irq->HostNs, 50), Samples_Pct(&irq->HostNs, 99));
+        }
+        printf("\n");
+    }
+
+    checkLimit("overruns", scn.LimOverruns, (long long)(s->RxOverruns[0] + s->RxOverruns[1]), 0);
+    checkLimit("latency p99", scn.LimLatency, (long long)Samples_Pct(&rxLatencyNs, 99), 1);
+    checkLimit("txfail", scn.LimTxFail, (long long)txFail, 0);
+    if (p) {
+        checkLimit("tpfail", scn.LimTpFail, (long long)(p->Failed + p->DataErrors), 0);
+        checkLimit("tptime", scn.LimTpTime, (long long)Samples_Pct(&p->TimeNs, 100), 1);
+    }
+    if (r) {
+        checkLimit("tptx tpfail", scn.LimTpFail, (long long)(r->Failed + tpTxLost + r->DataErrors), 0);
+        checkLimit("tptx tptime", scn.LimTpTime, (long long)Samples_Pct(&r->TimeNs, 100), 1);
+        checkLimit("stmin", scn.LimStmin, (long long)r->StminBelow, 0);
+    }
+}
+
+static void usage(void) {
+    fprintf(stderr, "usage: cansim [-d] [-l latency.csv] scenario.txt\n");
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    int deterministic = 0;
+    const char* csvPath = NULL;
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-'; i++) {
+        if (!strcmp(argv[i], "-d")) deterministic = 1;
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc) csvPath = argv[++i];
+        else usage();
+    }
+    if (i != argc - 1) usage();
+
+    readScenario(argv[i]);
+    rngState = scn.Seed * 0x9E3779B97F4A7C15ULL + 1U;
+    if (csvPath) {
+        latencyCsv = fopen(csvPath, "w");
+        if (!latencyCsv) { perror(csvPath); return 2; }
+        fprintf(latencyCsv, "time_ns,can_id,latency_ns\n");
+    }
+
+    Bus_Init(scn.Bitrate);
+    startDut();
+    for (unsigned g = 0; g < scn.NumGens; g++) startGenerator(scn.Gens[g]);
+    if (scn.Tp) startTp(scn.Tp);
+    if (scn.TpTx) startTpTx(scn.TpTx);
+
+    Sim_Run(scn.Duration);
+
+    if (latencyCsv) fclose(latencyCsv);
+    report(deterministic);
+    return exceeded ? 1 : 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * stm32f10x.h (host)
+ * Stand-in for the device header when firmware sources are built on Linux
+ * (cansim, host tests in Host/test). It is found before SPL/inc and uses the
+ * same include guard, so the real header (which SPL headers include by
+ * quotes from their own directory) is skipped and can.c, canif.c, CanTp.c
+ * and Port.c compile unchanged. The SPL peripheral headers (stm32f10x_can.h ...) are the real
+ * ones and only need the types below.
+ *
+ * Peripheral pointers are addresses of simulator objects, never registers:
+ * the SPL functions the firmware calls are implemented by bxcan.c against
+ * the bxCAN model, and TIM_TypeDef only carries the two fields read by the
+ * inline Gpt_GetTimestamp (kept in step with virtual time by sim.c).
+ * GPIO ports have the real register layout at GPIOA_BASE + n * 0x400 inside
+ * Sim_GpioMem, which the program using them defines (plain memory: a BSRR
+ * store does not change ODR).
+ */
+
+#ifndef __STM32F10x_H
+#define __STM32F10x_H
+
+#include <stdint.h>
+
+#ifndef STM32F10X_MD
+#define STM32F10X_MD
+#endif
+
+#define __INLINE                inline
+#define __IO                    volatile
+
+/* The simulator runs interrupts between calls into the firmware, never in the
+   middle of one: Compiler_EnterCritical is empty off-target and these are too. */
+static inline void __disable_irq(void) { }
+static inline void __enable_irq(void) { }
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { ERROR = 0, SUCCESS = !ERROR } ErrorStatus;
+
+#define IS_FUNCTIONAL_STATE(STATE) (((STATE) == DISABLE) || ((STATE) == ENABLE))
+
+typedef enum {
+    USB_HP_CAN1_TX_IRQn         = 19,
+    USB_LP_CAN1_RX0_IRQn        = 20,
+    CAN1_RX1_IRQn               = 21,
+    TIM2_IRQn                   = 28
+} IRQn_Type;
+
+/* NVIC enable bits are kept by the CPU model (sim.c) */
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+
+typedef struct { int unused; } CAN_TypeDef;
+
+typedef struct {
+    __IO uint32_t CRL;
+    __IO uint32_t CRH;
+    __IO uint32_t IDR;
+    __IO uint32_t ODR;
+    __IO uint32_t BSRR;
+    __IO uint32_t BRR;
+    __IO uint32_t LCKR;
+} GPIO_TypeDef;
+typedef struct { int unused; } USART_TypeDef;
+
+typedef struct {
+    __IO uint32_t CNT;
+    __IO uint32_t SR;
+} TIM_TypeDef;
+
+#define TIM_SR_UIF              ((uint16_t)0x0001)
+
+extern CAN_TypeDef Sim_Can1;
+#define CAN1                    (&Sim_Can1)
+
+extern uint32_t Sim_GpioMem[4 * 0x400 / 4];
+#define GPIOA_BASE              ((uintptr_t)Sim_GpioMem)
+#define GPIOA                   ((GPIO_TypeDef*)GPIOA_BASE)
+#define GPIOB                   ((GPIO_TypeDef*)(GPIOA_BASE + 0x400))
+#define GPIOC                   ((GPIO_TypeDef*)(GPIOA_BASE + 0x800))
+#define GPIOD                   ((GPIO_TypeDef*)(GPIOA_BASE + 0xC00))
+
+#endif /* __STM32F10x_H */
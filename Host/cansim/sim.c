@@ -0,0 +1,284 @@
+/*
+ * sim.c
+ * Virtual time, event queue and CPU model of cansim, plus the host versions
+ * of the Gpt, Mcu and NVIC functions called by the firmware sources
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "Gpt.h"
+#include "Mcu.h"
+
+/* ================= Event queue ================= */
+typedef struct {
+    SimTime t;
+    uint64_t seq;               /* FIFO order among equal times: runs are reproducible */
+    SimEventFunc fn;
+    void* ctx;
+    uint32_t arg;
+} SimEvent;
+
+static SimEvent* heap;
+static size_t heapLen, heapCap;
+static uint64_t nextSeq;
+static SimTime now;
+
+static TIM_TypeDef simTim;
+Gpt_TimebaseType Gpt_Timebase = { &simTim, 0 };
+
+static int eventBefore(const SimEvent* a, const SimEvent* b) {
+    return (a->t != b->t) ? (a->t < b->t) : (a->seq < b->seq);
+}
+
+void Sim_At(SimTime t, SimEventFunc fn, void* ctx, uint32_t arg) {
+    if (heapLen == heapCap) {
+        heapCap = heapCap ? heapCap * 2 : 256;
+        heap = realloc(heap, heapCap * sizeof(*heap));
+        if (!heap) { perror("cansim"); exit(2); }
+    }
+    SimEvent e = { (t < now) ? now : t, nextSeq++, fn, ctx, arg };
+    size_t i = heapLen++;
+    while (i > 0 && eventBefore(&e, &heap[(i - 1) / 2])) {
+        heap[i] = heap[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    heap[i] = e;
+}
+
+static SimEvent popEvent(void) {
+    SimEvent top = heap[0];
+    SimEvent last = heap[--heapLen];
+    size_t i = 0;
+    for (;;) {
+        size_t c = 2 * i + 1;
+        if (c >= heapLen) break;
+        if (c + 1 < heapLen && eventBefore(&heap[c + 1], &heap[c])) c++;
+        if (!eventBefore(&heap[c], &last)) break;
+        heap[i] = heap[c];
+        i = c;
+    }
+    heap[i] = last;
+    return top;
+}
+
+SimTime Sim_Now(void) {
+    return now;
+}
+
+void Sim_Run(SimTime end) {
+    while (heapLen > 0 && heap[0].t <= end) {
+        SimEvent e = popEvent();
+        now = e.t;
+        /* Timebase read by the inline Gpt_GetTimestamp: counter + overflows at 1 MHz */
+        uint64_t us = now / SIM_US;
+        simTim.CNT = (uint32_t)(us & 0xFFFFU);
+        Gpt_Timebase.Overflows = (uint32_t)(us >> 16);
+        e.fn(e.ctx, e.arg);
+    }
+    now = end;
+}
+
+/* ================= Samples ================= */
+void Samples_Add(SimSamples* s, uint32_t value) {
+    if (s->n == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 1024;
+        s->v = realloc(s->v, s->cap * sizeof(*s->v));
+        if (!s->v) { perror("cansim"); exit(2); }
+    }
+    s->v[s->n++] = value;
+    s->sum += value;
+    s->sorted = 0;
+}
+
+static int cmpU32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+uint32_t Samples_Pct(SimSamples* s, unsigned pct) {
+    if (s->n == 0) return 0;
+    if (!s->sorted) {
+        qsort(s->v, s->n, sizeof(*s->v), cmpU32);
+        s->sorted = 1;
+    }
+    size_t i = (s->n * pct + 99) / 100;     /* nearest rank */
+    return s->v[i ? i - 1 : 0];
+}
+
+double Samples_Mean(const SimSamples* s) {
+    return s->n ? (double)s->sum / (double)s->n : 0.0;
+}
+
+/* ================= CPU ================= */
+SimIrq Cpu_Irqs[SIM_NUM_IRQS] = {
+    [SIM_IRQ_CAN_TX]  = { .Name = "can_tx" },
+    [SIM_IRQ_CAN_RX0] = { .Name = "can_rx" },
+    [SIM_IRQ_GPT]     = { .Name = "gpt", .Enabled = 1 }    /* Gpt_Init enables it */
+};
+
+static SimTime busyUntil;       /* end of the running handler */
+static SimTime checkAt = (SimTime)-1;
+static SimTime lockPeriod, lockLength;
+
+void Cpu_SetLock(SimTime period, SimTime length) {
+    lockPeriod = period;
+    lockLength = (length < period) ? length : 0;
+}
+
+/* Earliest time >= t at which the main loop has interrupts unmasked */
+static SimTime unlockedAt(SimTime t) {
+    if (lockLength == 0) return t;
+    SimTime phase = t % lockPeriod;
+    return (phase < lockLength) ? t - phase + lockLength : t;
+}
+
+static uint64_t hostNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void cpuCheck(void* ctx, uint32_t arg);
+
+static void scheduleCheck(SimTime t) {
+    if (checkAt <= t) return;                   /* an earlier check will look again */
+    checkAt = t;
+    Sim_At(t, cpuCheck, NULL, 0);
+}
+
+static void cpuCheck(void* ctx, uint32_t arg) {
+    (void)ctx; (void)arg;
+    if (checkAt <= now) checkAt = (SimTime)-1;  /* extra checks are harmless */
+
+    SimTime free = unlockedAt(busyUntil > now ? busyUntil : now);
+    if (free > now) {
+        scheduleCheck(free);
+        return;
+    }
+    for (int i = 0; i < SIM_NUM_IRQS; i++) {
+        SimIrq* irq = &Cpu_Irqs[i];
+        if (!irq->Enabled || !irq->Handler || !irq->Pending()) continue;
+        uint64_t t0 = hostNs();
+        irq->Handler();
+        uint64_t t1 = hostNs();
+        Samples_Add(&irq->HostNs, (uint32_t)(t1 - t0));
+        irq->Calls++;
+        busyUntil = now + irq->Cost;
+        scheduleCheck(busyUntil);               /* tail-chain if still pending */
+        return;
+    }
+}
+
+void Cpu_Kick(void) {
+    scheduleCheck(now);
+}
+
+static void runMain(void* ctx, uint32_t arg) {
+    (void)arg;
+    void (*fn)(void) = (void (*)(void))(uintptr_t)ctx;
+    if (busyUntil > now) {
+        Sim_At(busyUntil, runMain, ctx, 0);
+        return;
+    }
+    fn();
+}
+
+void Cpu_RunMain(void (*fn)(void)) {
+    runMain((void*)(uintptr_t)fn, 0);
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn) {
+    if (IRQn == USB_HP_CAN1_TX_IRQn) Cpu_Irqs[SIM_IRQ_CAN_TX].Enabled = 1;
+    if (IRQn == USB_LP_CAN1_RX0_IRQn) Cpu_Irqs[SIM_IRQ_CAN_RX0].Enabled = 1;
+    if (IRQn == TIM2_IRQn) Cpu_Irqs[SIM_IRQ_GPT].Enabled = 1;
+    Cpu_Kick();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn) {
+    if (IRQn == USB_HP_CAN1_TX_IRQn) Cpu_Irqs[SIM_IRQ_CAN_TX].Enabled = 0;
+    if (IRQn == USB_LP_CAN1_RX0_IRQn) Cpu_Irqs[SIM_IRQ_CAN_RX0].Enabled = 0;
+    if (IRQn == TIM2_IRQn) Cpu_Irqs[SIM_IRQ_GPT].Enabled = 0;
+}
+
+/* ================= Gpt (channels on virtual time) ================= */
+typedef struct {
+    uint32_t Gen;               /* bumped on start/stop: stale expiry events are ignored */
+    uint32_t Period;            /* us */
+    uint8_t Running;
+    uint8_t Expired;            /* waiting for the timer interrupt */
+} SimGptChannel;
+
+static const Gpt_ConfigType* gptCfg;
+static SimGptChannel gptCh[GPT_MAX_CHANNELS];
+
+static void gptExpire(void* ctx, uint32_t arg) {
+    SimGptChannel* ch = ctx;
+    if (!ch->Running || arg != ch->Gen) return;
+    ch->Expired = 1;
+    Gpt_ChannelType idx = (Gpt_ChannelType)(ch - gptCh);
+    if (gptCfg->Channels[idx].Mode == GPT_CH_MODE_CONTINUOUS) {
+        Sim_At(now + ch->Period * SIM_US, gptExpire, ch, ch->Gen);     /* no drift */
+    } else {
+        ch->Running = 0;
+    }
+    Cpu_Kick();
+}
+
+static int gptPending(void) {
+    for (uint8_t i = 0; gptCfg && i < gptCfg->numChannels; i++) {
+        if (gptCh[i].Expired) return 1;
+    }
+    return 0;
+}
+
+static void gptIrqHandler(void) {
+    for (uint8_t i = 0; i < gptCfg->numChannels; i++) {
+        if (!gptCh[i].Expired) continue;
+        gptCh[i].Expired = 0;
+        if (gptCfg->Channels[i].Notification) gptCfg->Channels[i].Notification();
+    }
+}
+
+void Gpt_Init(const Gpt_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR || ConfigPtr->numChannels > GPT_MAX_CHANNELS) return;
+    gptCfg = ConfigPtr;
+    memset(gptCh, 0, sizeof(gptCh));
+    Cpu_Irqs[SIM_IRQ_GPT].Pending = gptPending;
+    Cpu_Irqs[SIM_IRQ_GPT].Handler = gptIrqHandler;
+}
+
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value) {
+    if (gptCfg == NULL_PTR || Channel >= gptCfg->numChannels || Value == 0U) return;
+    SimGptChannel* ch = &gptCh[Channel];
+    ch->Gen++;
+    ch->Running = 1;
+    ch->Expired = 0;
+    ch->Period = Value;
+    Sim_At(now + (SimTime)Value * SIM_US, gptExpire, ch, ch->Gen);
+}
+
+void Gpt_StopTimer(Gpt_ChannelType Channel) {
+    if (gptCfg == NULL_PTR || Channel >= gptCfg->numChannels) return;
+    gptCh[Channel].Gen++;
+    gptCh[Channel].Running = 0;
+    gptCh[Channel].Expired = 0;
+}
+
+uint32_t Gpt_GetTimeUs(void) {
+    return (uint32_t)(now / SIM_US);
+}
+
+/* ================= Mcu ================= */
+Std_ReturnType Mcu_EnablePeripheral(Mcu_PeripheralType Periph) {
+    (void)Periph;
+    return E_OK;
+}
+
+uint32_t Mcu_GetClockFreq(Mcu_ClockDomainType Domain) {
+    return (Domain == MCU_CLK_PCLK1) ? SIM_PCLK1_HZ : 2U * SIM_PCLK1_HZ;
+}
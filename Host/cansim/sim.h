@@ -0,0 +1,133 @@
+/*
+ * sim.h
+ * Shared declarations of the host CAN simulator (see cansim.c)
+ *
+ * sim.c    virtual time, event queue, CPU/interrupt model, host versions of
+ *          the Gpt/Mcu/NVIC functions the firmware sources call
+ * bus.c    virtual CAN bus: arbitration, frame length with stuff bits
+ * bxcan.c  bxCAN model behind the SPL CAN_* functions used by can.c
+ * cansim.c scenario, traffic generators, ISO-TP peer, report
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* ---------------- Virtual time and events (sim.c) ---------------- */
+typedef uint64_t SimTime;               /* ns since start of the run */
+
+#define SIM_US              1000ULL
+#define SIM_MS              1000000ULL
+#define SIM_S               1000000000ULL
+
+/* APB1 clock the DUT's Can_Init prescaler is computed for (72 MHz SYSCLK) */
+#define SIM_PCLK1_HZ        36000000UL
+
+typedef void (*SimEventFunc)(void* ctx, uint32_t arg);
+
+/* Runs fn(ctx, arg) at time t (>= now). Equal times run in scheduling order. */
+void Sim_At(SimTime t, SimEventFunc fn, void* ctx, uint32_t arg);
+SimTime Sim_Now(void);
+/* Processes events up to and including time end */
+void Sim_Run(SimTime end);
+
+/* ---------------- Samples for percentiles (sim.c) ---------------- */
+typedef struct {
+    uint32_t* v;
+    size_t n, cap;
+    int sorted;
+    uint64_t sum;
+} SimSamples;
+
+void Samples_Add(SimSamples* s, uint32_t value);
+uint32_t Samples_Pct(SimSamples* s, unsigned pct);     /* 0 when empty; 100 = max */
+double Samples_Mean(const SimSamples* s);
+
+/* ---------------- CPU model (sim.c) ---------------- */
+/* One CPU runs interrupt handlers to completion, one at a time: the
+   handler is called at entry (firmware sees that time on Gpt_GetTimestamp)
+   and the CPU is then busy for Cost. Pending requests are taken in the
+   order below (NVIC: equal priority, lower IRQ number first). The main loop
+   masks interrupts for Length of every Period (its critical sections);
+   main-loop code itself takes no virtual time. */
+typedef enum {
+    SIM_IRQ_CAN_TX = 0,         /* USB_HP_CAN1_TX_IRQn */
+    SIM_IRQ_CAN_RX0,            /* USB_LP_CAN1_RX0_IRQn */
+    SIM_IRQ_GPT,                /* TIM2_IRQn */
+    SIM_NUM_IRQS
+} SimIrqType;
+
+typedef struct {
+    const char* Name;
+    int (*Pending)(void);       /* level of the request line */
+    void (*Handler)(void);
+    SimTime Cost;
+    int Enabled;                /* NVIC_EnableIRQ */
+    uint64_t Calls;
+    SimSamples HostNs;          /* host time per handler call */
+} SimIrq;
+
+extern SimIrq Cpu_Irqs[SIM_NUM_IRQS];
+
+void Cpu_SetLock(SimTime period, SimTime length);
+/* A request line may have changed: run handlers as soon as the CPU is free */
+void Cpu_Kick(void);
+/* Runs fn from the main loop: now, or when the running handler returns */
+void Cpu_RunMain(void (*fn)(void));
+
+/* ---------------- Virtual bus (bus.c) ---------------- */
+typedef struct {
+    uint32_t Id;                /* 11-bit identifier */
+    uint8_t Dlc;
+    uint8_t Data[8];
+} SimFrame;
+
+typedef struct SimNode {
+    const char* Name;
+    /* Frame for the next arbitration; returns its slot, -1 when none is pending.
+       The slot must stay pending until TxDone. */
+    int (*Offer)(struct SimNode* node, SimFrame* frame);
+    /* Frame of slot won arbitration and was sent (end of EOF) */
+    void (*TxDone)(struct SimNode* node, int slot);
+    /* Frame of another node received (end of EOF), NULL: not listening */
+    void (*Rx)(struct SimNode* node, const SimFrame* frame);
+    struct SimNode* Next;
+    uint64_t TxFrames;
+    uint64_t TxBits;
+} SimNode;
+
+void Bus_Init(uint32_t bitrate);
+uint32_t Bus_Bitrate(void);
+SimTime Bus_BitTime(void);
+void Bus_Attach(SimNode* node);
+/* A node has a new frame: arbitrate now if the bus is idle */
+void Bus_Request(void);
+/* Bits from SOF to the end of EOF, stuff bits included (3-bit IFS not included) */
+unsigned Bus_FrameBits(const SimFrame* frame);
+SimTime Bus_BusyTime(void);     /* frames + IFS */
+uint64_t Bus_Frames(void);
+
+/* ---------------- bxCAN model (bxcan.c) ---------------- */
+typedef struct {
+    uint64_t RxFrames;          /* seen on the bus */
+    uint64_t RxFiltered;        /* rejected by the acceptance filters */
+    uint64_t RxAccepted[2];     /* stored in FIFO0 / FIFO1 */
+    uint64_t RxOverruns[2];     /* lost because the FIFO was full */
+    uint64_t RxRead;            /* CAN_Receive */
+    uint64_t TxRequests;        /* CAN_Transmit */
+    uint64_t TxNoMailbox;
+    uint64_t TxFrames;
+    SimSamples TxQueueNs;       /* CAN_Transmit -> end of frame */
+} BxcanStats;
+
+extern BxcanStats Bxcan_Stats;
+extern SimNode Bxcan_Node;
+
+/* End of frame of the message read by the last CAN_Receive */
+SimTime Bxcan_LastRxEof(void);
+/* Frames waiting in a receive FIFO */
+unsigned Bxcan_FifoLevel(uint8_t fifo);
+
+#endif /* SIM_H */
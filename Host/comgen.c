@@ -0,0 +1,676 @@
+/*
+ * comgen.c
+ * Host generator of the Com configuration (signal pack/unpack routines,
+ * signal and I-PDU tables) from a DBC message description (Linux, C99)
+ *
+ * Build:  make comgen (top level); demos regenerate Com/Com_Cfg.c/.h from
+ *         their .dbc file when it changes
+ * Use:    ./comgen -n ECU [-t 10] [-o outdir] network.dbc
+ *
+ * Messages sent by the node (-n) become TX I-PDUs; messages with at least
+ * one signal received by the node become RX I-PDUs, with those signals.
+ * Every signal gets its own pack and unpack function: the bytes it touches,
+ * their masks and shifts are resolved here, so the target runs two to five
+ * straight-line byte operations per signal instead of a loop over bits.
+ *
+ * Supported DBC subset:
+ *   BO_ <id> <name>: <dlc> <sender>
+ *    SG_ <name> : <start>|<length>@<1 Intel|0 Motorola><+|-> (<factor>,<offset>) [<min>|<max>] "<unit>" <receivers>
+ *   BA_DEF_ BO_ "GenMsgSendType" ENUM "...",...;     Cyclic, OnChange (Spontaneous), Mixed (CyclicAndSpontaneous)
+ *   BA_DEF_ SG_ "GenSigSendType" ENUM "...",...;     Cyclic, OnChange (Spontaneous), OnWrite
+ *   BA_DEF_DEF_ "<attribute>" <default>;
+ *   BA_ "GenMsgSendType" BO_ <id> <value>;
+ *   BA_ "GenMsgCycleTime" BO_ <id> <ms>;            period of Cyclic and Mixed messages
+ *   BA_ "GenMsgDelayTime" BO_ <id> <ms>;            minimum delay between two sends
+ *   BA_ "GenSigSendType" SG_ <id> <signal> <value>;
+ * Other lines are ignored. Multiplexed signals, extended (29-bit)
+ * identifiers, signals wider than 32 bits and DLC above 8 are rejected.
+ *
+ * Signals of Cyclic messages default to Cyclic (pending: sent with the next
+ * period), those of OnChange and Mixed messages to OnChange.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NAME_LEN        64
+#define LINE_LEN        1024
+#define MAX_ENUM        8
+
+enum { MODE_PERIODIC, MODE_DIRECT, MODE_MIXED };
+enum { XFER_PENDING, XFER_TRIGGERED, XFER_ON_CHANGE };
+
+typedef struct {
+    char name[NAME_LEN];        /* As in the DBC file */
+    char ident[NAME_LEN * 2];   /* C identifier suffix, unique over all signals */
+    int msg;                    /* Index in msgs[] */
+    unsigned start;
+    unsigned len;
+    int motorola;
+    int isSigned;
+    double factor, offset, min, max;
+    char unit[32];
+    int received;               /* Node is among the receivers */
+    int xfer;                   /* XFER_*, -1 = message default */
+} Signal;
+
+typedef struct {
+    char name[NAME_LEN];
+    unsigned long id;
+    unsigned dlc;
+    char sender[NAME_LEN];
+    int mode;                   /* MODE_*, -1 = attribute default */
+    long cycle;                 /* ms, -1 = attribute default */
+    long delay;                 /* ms, -1 = attribute default */
+    int isTx;
+    int isRx;
+    unsigned pduId;             /* Com I-PDU id within its direction */
+} Message;
+
+typedef struct {
+    char name[NAME_LEN];
+    char values[MAX_ENUM][NAME_LEN];
+    int numValues;
+    char def[NAME_LEN];         /* BA_DEF_DEF_ value, "" = none */
+} AttrDef;
+
+static Message* msgs;
+static size_t numMsgs, capMsgs;
+static Signal* sigs;
+static size_t numSigs, capSigs;
+static AttrDef attrs[4] = {
+    { "GenMsgSendType", { "" }, 0, "" },
+    { "GenSigSendType", { "" }, 0, "" },
+    { "GenMsgCycleTime", { "" }, 0, "" },
+    { "GenMsgDelayTime", { "" }, 0, "" },
+};
+
+static const char* dbcPath;
+static unsigned lineNo;
+
+static void* grow(void* p, size_t* cap, size_t elem) {
+    *cap = *cap ? *cap * 2U : 64U;
+    p = realloc(p, *cap * elem);
+    if (p == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static void fail(const char* what) {
+    fprintf(stderr, "%s:%u: %s\n", dbcPath, lineNo, what);
+    exit(2);
+}
+
+static const char* skipSpace(const char* p) {
+    while (isspace((unsigned char)*p)) p++;
+    return p;
+}
+
+/* Copies an identifier token; returns the position after it */
+static const char* getIdent(const char* p, char* out) {
+    size_t n = 0;
+    p = skipSpace(p);
+    while (isalnum((unsigned char)*p) || *p == '_') {
+        if (n + 1U < NAME_LEN) out[n++] = *p;
+        p++;
+    }
+    out[n] = '\0';
+    return p;
+}
+
+/* Copies a "quoted" string; returns the position after the closing quote or NULL */
+static const char* getQuoted(const char* p, char* out, size_t size) {
+    size_t n = 0;
+    p = skipSpace(p);
+    if (*p != '"') return NULL;
+    for (p++; *p && *p != '"'; p++) {
+        if (n + 1U < size) out[n++] = *p;
+    }
+    out[n] = '\0';
+    return *p == '"' ? p + 1 : NULL;
+}
+
+static AttrDef* findAttr(const char* name) {
+    for (size_t i = 0; i < sizeof(attrs) / sizeof(attrs[0]); i++) {
+        if (strcmp(attrs[i].name, name) == 0) return &attrs[i];
+    }
+    return NULL;
+}
+
+static Message* findMsg(unsigned long id) {
+    for (size_t i = 0; i < numMsgs; i++) {
+        if (msgs[i].id == id) return &msgs[i];
+    }
+    return NULL;
+}
+
+static int nameIs(const char* s, const char* const* names) {
+    for (; *names; names++) {
+        size_t n = strlen(*names);
+        if (strncmp(s, *names, n) == 0 && s[n] == '\0') return 1;
+    }
+    return 0;
+}
+
+static int msgModeFromName(const char* s) {
+    static const char* const periodic[] = { "Cyclic", "cyclic", NULL };
+    static const char* const direct[] = { "OnChange", "Spontaneous", "spontaneous", "OnWrite", NULL };
+    static const char* const mixed[] = { "Mixed", "CyclicAndSpontaneous", "cyclicAndSpontaneous", NULL };
+    if (nameIs(s, periodic)) return MODE_PERIODIC;
+    if (nameIs(s, direct)) return MODE_DIRECT;
+    if (nameIs(s, mixed)) return MODE_MIXED;
+    return -1;
+}
+
+static int sigXferFromName(const char* s) {
+    static const char* const pending[] = { "Cyclic", "cyclic", NULL };
+    static const char* const onChange[] = { "OnChange", "Spontaneous", "spontaneous", NULL };
+    static const char* const onWrite[] = { "OnWrite", "Triggered", NULL };
+    if (nameIs(s, pending)) return XFER_PENDING;
+    if (nameIs(s, onChange)) return XFER_ON_CHANGE;
+    if (nameIs(s, onWrite)) return XFER_TRIGGERED;
+    return -1;
+}
+
+/* Attribute value: enum index or "quoted" enum name -> name; number -> text */
+static const char* attrValue(const AttrDef* a, const char* p, char* out) {
+    const char* q = getQuoted(p, out, NAME_LEN);
+    if (q != NULL) return q;
+    char* end;
+    long v = strtol(p, &end, 10);
+    if (end == p) fail("attribute value expected");
+    if (a->numValues != 0) {
+        if (v < 0 || v >= a->numValues) fail("enum attribute value out of range");
+        strcpy(out, a->values[v]);
+    } else {
+        snprintf(out, NAME_LEN, "%ld", v);
+    }
+    return end;
+}
+
+static void parseMessage(const char* p) {
+    if (numMsgs == capMsgs) msgs = grow(msgs, &capMsgs, sizeof(*msgs));
+    Message* m = &msgs[numMsgs];
+    memset(m, 0, sizeof(*m));
+    char* end;
+    m->id = strtoul(p, &end, 10);
+    p = getIdent(end, m->name);
+    p = skipSpace(p);
+    if (m->name[0] == '\0' || *p != ':') fail("BO_ <id> <name>: <dlc> <sender> expected");
+    m->dlc = (unsigned)strtoul(p + 1, &end, 10);
+    getIdent(end, m->sender);
+    m->mode = -1;
+    m->cycle = -1;
+    m->delay = -1;
+    // VECTOR__INDEPENDENT_SIG_MSG and similar pseudo messages carry no frame
+    if (m->id & 0x80000000UL) {
+        if ((m->id & 0x7FFFFFFFUL) == 0x40000000UL) return;
+        fail("extended identifiers are not supported by the CAN driver");
+    }
+    if (m->id > 0x7FFUL || m->dlc > 8U) fail("standard identifier and DLC 0..8 expected");
+    numMsgs++;
+}
+
+static void parseSignal(const char* p, const char* node) {
+    if (numMsgs == 0) fail("SG_ outside of a message");
+    if (numSigs == capSigs) sigs = grow(sigs, &capSigs, sizeof(*sigs));
+    Signal* s = &sigs[numSigs];
+    memset(s, 0, sizeof(*s));
+    s->msg = (int)numMsgs - 1;
+    s->xfer = -1;
+    p = getIdent(p, s->name);
+    p = skipSpace(p);
+    if (*p != ':') fail("multiplexed signals are not supported");
+    char order, sign;
+    int used = 0;
+    if (sscanf(p + 1, " %u|%u@%c%c (%lf,%lf) [%lf|%lf]%n", &s->start, &s->len, &order, &sign,
+               &s->factor, &s->offset, &s->min, &s->max, &used) != 8) {
+        fail("SG_ <name> : <start>|<len>@<order><sign> (<factor>,<offset>) [<min>|<max>] expected");
+    }
+    p = getQuoted(p + 1 + used, s->unit, sizeof(s->unit));
+    if (p == NULL) fail("signal unit expected");
+    s->motorola = (order == '0');
+    s->isSigned = (sign == '-');
+    if (s->len == 0U || s->len > 32U) fail("signal length must be 1..32 bits");
+
+    char rx[NAME_LEN];
+    for (;;) {
+        p = skipSpace(p);
+        if (*p == ',') p++;
+        p = getIdent(p, rx);
+        if (rx[0] == '\0') break;
+        if (strcmp(rx, node) == 0) s->received = 1;
+    }
+    numSigs++;
+}
+
+static void parseAttrDef(const char* p) {
+    char name[NAME_LEN];
+    p = skipSpace(p);
+    if (strncmp(p, "BO_", 3) == 0 || strncmp(p, "SG_", 3) == 0) p += 3;
+    p = getQuoted(p, name, sizeof(name));
+    AttrDef* a = p ? findAttr(name) : NULL;
+    if (a == NULL) return;
+    p = skipSpace(p);
+    if (strncmp(p, "ENUM", 4) != 0) return;
+    p += 4;
+    a->numValues = 0;
+    while ((p = getQuoted(p, a->values[a->numValues], NAME_LEN)) != NULL) {
+        if (++a->numValues == MAX_ENUM) break;
+        p = skipSpace(p);
+        if (*p != ',') break;
+        p++;
+    }
+}
+
+static void parseAttrDefault(const char* p) {
+    char name[NAME_LEN];
+    p = getQuoted(p, name, sizeof(name));
+    AttrDef* a = p ? findAttr(name) : NULL;
+    if (a != NULL) {
+        attrValue(a, skipSpace(p), a->def);
+    }
+}
+
+static void parseAttr(const char* p) {
+    char name[NAME_LEN];
+    char obj[8];
+    char value[NAME_LEN];
+    p = getQuoted(p, name, sizeof(name));
+    AttrDef* a = p ? findAttr(name) : NULL;
+    if (a == NULL) return;
+    p = getIdent(p, obj);
+    char* end;
+    unsigned long id = strtoul(p, &end, 10);
+    Message* m = findMsg(id);
+    if (m == NULL) fail("attribute of an unknown message");
+
+    if (strcmp(obj, "SG_") == 0) {
+        char sigName[NAME_LEN];
+        p = getIdent(end, sigName);
+        attrValue(a, skipSpace(p), value);
+        for (size_t i = 0; i < numSigs; i++) {
+            if (&msgs[sigs[i].msg] == m && strcmp(sigs[i].name, sigName) == 0) {
+                if (a == &attrs[1] && (sigs[i].xfer = sigXferFromName(value)) < 0) fail("unknown GenSigSendType");
+                return;
+            }
+        }
+        fail("attribute of an unknown signal");
+    }
+    if (strcmp(obj, "BO_") != 0) return;
+    attrValue(a, skipSpace(end), value);
+    if (a == &attrs[0]) {
+        if ((m->mode = msgModeFromName(value)) < 0) fail("unknown GenMsgSendType");
+    } else if (a == &attrs[2]) {
+        m->cycle = strtol(value, NULL, 10);
+    } else if (a == &attrs[3]) {
+        m->delay = strtol(value, NULL, 10);
+    }
+}
+
+static int readDbc(const char* path, const char* node) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    char line[LINE_LEN];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        lineNo++;
+        const char* p = skipSpace(line);
+        if (strncmp(p, "BO_ ", 4) == 0) {
+            parseMessage(p + 4);
+        } else if (strncmp(p, "SG_ ", 4) == 0) {
+            parseSignal(p + 4, node);
+        } else if (strncmp(p, "BA_DEF_DEF_ ", 12) == 0) {
+            parseAttrDefault(p + 12);
+        } else if (strncmp(p, "BA_DEF_ ", 8) == 0) {
+            parseAttrDef(p + 8);
+        } else if (strncmp(p, "BA_ ", 4) == 0) {
+            parseAttr(p + 4);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+/* Bit positions: bitPos[i] = position (byte * 8 + bit) of signal bit i, LSB first */
+static void signalBits(const Signal* s, unsigned* bitPos) {
+    if (!s->motorola) {
+        for (unsigned i = 0; i < s->len; i++) bitPos[i] = s->start + i;
+        return;
+    }
+    // Motorola: start bit is the MSB; going towards the LSB walks down a byte, then into the next one
+    unsigned pos = s->start;
+    for (unsigned i = s->len; i-- > 0;) {
+        bitPos[i] = pos;
+        pos = (pos % 8U == 0U) ? pos + 15U : pos - 1U;
+    }
+}
+
+/* One byte of a signal: pdu[byte] & mask holds signal bits lsb.., shifted by (lsb - first bit in byte) */
+typedef struct {
+    unsigned byte;
+    unsigned mask;
+    int shift;                  /* > 0: raw bits = (byte & mask) << shift; < 0: >> -shift */
+} ByteTerm;
+
+static unsigned signalTerms(const Signal* s, ByteTerm* terms) {
+    unsigned bitPos[32];
+    unsigned n = 0;
+    signalBits(s, bitPos);
+    for (unsigned i = 0; i < s->len; i++) {
+        unsigned byte = bitPos[i] / 8U;
+        unsigned bit = bitPos[i] % 8U;
+        if (n == 0 || terms[n - 1].byte != byte) {
+            terms[n].byte = byte;
+            terms[n].mask = 0;
+            terms[n].shift = (int)i - (int)bit;
+            n++;
+        }
+        terms[n - 1].mask |= 1U << bit;
+    }
+    return n;
+}
+
+static const char* valueType(const Signal* s) {
+    static const char* const types[2][3] = {
+        { "uint8_t", "uint16_t", "uint32_t" }, { "int8_t", "int16_t", "int32_t" }
+    };
+    return types[s->isSigned][s->len <= 8U ? 0 : (s->len <= 16U ? 1 : 2)];
+}
+
+static void emitUnpack(FILE* f, const Signal* s) {
+    ByteTerm t[5];
+    unsigned n = signalTerms(s, t);
+    fprintf(f, "static void Com_Unpack_%s(const uint8_t* pdu, void* value) {\n    uint32_t raw =", s->ident);
+    for (unsigned i = 0; i < n; i++) {
+        char byteExpr[32];
+        if (t[i].mask == 0xFFU) {
+            snprintf(byteExpr, sizeof(byteExpr), "(uint32_t)pdu[%u]", t[i].byte);
+        } else {
+            snprintf(byteExpr, sizeof(byteExpr), "(uint32_t)(pdu[%u] & 0x%02XU)", t[i].byte, t[i].mask);
+        }
+        fprintf(f, "%s", i ? "\n        | " : " ");
+        const char* open = n > 1U ? "(" : "";
+        const char* close = n > 1U ? ")" : "";
+        if (t[i].shift > 0) {
+            fprintf(f, "%s%s << %d%s", open, byteExpr, t[i].shift, close);
+        } else if (t[i].shift < 0) {
+            fprintf(f, "%s%s >> %d%s", open, byteExpr, -t[i].shift, close);
+        } else {
+            fprintf(f, "%s", byteExpr);
+        }
+    }
+    fprintf(f, ";\n");
+    if (s->isSigned && s->len < 32U) {
+        // Sign extension without a branch: flip the sign bit, subtract it
+        unsigned long sign = 1UL << (s->len - 1U);
+        fprintf(f, "    *(%s*)value = (%s)(int32_t)((raw ^ 0x%lXUL) - 0x%lXUL);\n}\n\n",
+                valueType(s), valueType(s), sign, sign);
+    } else {
+        fprintf(f, "    *(%s*)value = (%s)raw;\n}\n\n", valueType(s), valueType(s));
+    }
+}
+
+static void emitPack(FILE* f, const Signal* s) {
+    ByteTerm t[5];
+    unsigned n = signalTerms(s, t);
+    fprintf(f, "static boolean Com_Pack_%s(uint8_t* pdu, const void* value) {\n", s->ident);
+    fprintf(f, "    uint32_t raw = (uint32_t)*(const %s*)value;\n", valueType(s));
+    for (unsigned i = 0; i < n; i++) {
+        char rawExpr[32];
+        if (t[i].shift > 0) {
+            snprintf(rawExpr, sizeof(rawExpr), "(raw >> %d)", t[i].shift);
+        } else if (t[i].shift < 0) {
+            snprintf(rawExpr, sizeof(rawExpr), "(raw << %d)", -t[i].shift);
+        } else {
+            snprintf(rawExpr, sizeof(rawExpr), "raw");
+        }
+        if (t[i].mask == 0xFFU) {
+            fprintf(f, "    uint8_t b%u = (uint8_t)%s;\n", t[i].byte, rawExpr);
+        } else {
+            fprintf(f, "    uint8_t b%u = (uint8_t)((pdu[%u] & 0x%02XU) | (%s & 0x%02XU));\n",
+                    t[i].byte, t[i].byte, ~t[i].mask & 0xFFU, rawExpr, t[i].mask);
+        }
+    }
+    if (n == 1U) {
+        fprintf(f, "    uint8_t diff = (uint8_t)(pdu[%u] ^ b%u);\n", t[0].byte, t[0].byte);
+    } else {
+        fprintf(f, "    uint8_t diff = (uint8_t)(");
+        for (unsigned i = 0; i < n; i++) {
+            fprintf(f, "%s(pdu[%u] ^ b%u)", i ? " | " : "", t[i].byte, t[i].byte);
+        }
+        fprintf(f, ");\n");
+    }
+    for (unsigned i = 0; i < n; i++) {
+        fprintf(f, "    pdu[%u] = b%u;\n", t[i].byte, t[i].byte);
+    }
+    fprintf(f, "    return (boolean)(diff != 0U);\n}\n\n");
+}
+
+static const char* const modeNames[] = { "COM_TX_MODE_PERIODIC", "COM_TX_MODE_DIRECT", "COM_TX_MODE_MIXED" };
+static const char* const xferNames[] = { "COM_PENDING", "COM_TRIGGERED", "COM_TRIGGERED_ON_CHANGE" };
+
+static int xferOf(const Signal* s) {
+    if (s->xfer >= 0) return s->xfer;
+    int x = attrs[1].def[0] ? sigXferFromName(attrs[1].def) : -1;
+    if (x >= 0) return x;
+    return msgs[s->msg].mode == MODE_PERIODIC ? XFER_PENDING : XFER_ON_CHANGE;
+}
+
+static int included(const Signal* s) {
+    const Message* m = &msgs[s->msg];
+    return m->isTx || (m->isRx && s->received);
+}
+
+static unsigned ticks(long ms, unsigned tickMs) {
+    return ms <= 0 ? 0U : (unsigned)((ms + (long)tickMs - 1) / (long)tickMs);
+}
+
+/* Resolves directions, defaults and identifiers; returns the number of included signals */
+static unsigned resolve(const char* node, unsigned tickMs, unsigned* numRx, unsigned* numTx) {
+    int defMode = attrs[0].def[0] ? msgModeFromName(attrs[0].def) : MODE_PERIODIC;
+    long defCycle = attrs[2].def[0] ? strtol(attrs[2].def, NULL, 10) : 0;
+    long defDelay = attrs[3].def[0] ? strtol(attrs[3].def, NULL, 10) : 0;
+    *numRx = *numTx = 0;
+    for (size_t i = 0; i < numMsgs; i++) {
+        Message* m = &msgs[i];
+        m->isTx = strcmp(m->sender, node) == 0;
+        for (size_t j = 0; j < numSigs && !m->isTx; j++) {
+            m->isRx |= (sigs[j].msg == (int)i && sigs[j].received);
+        }
+        if (m->mode < 0) m->mode = defMode < 0 ? MODE_PERIODIC : defMode;
+        if (m->cycle < 0) m->cycle = defCycle;
+        if (m->delay < 0) m->delay = defDelay;
+        if (m->isTx) {
+            m->pduId = (*numTx)++;
+            if (m->mode != MODE_DIRECT && ticks(m->cycle, tickMs) == 0U) {
+                fprintf(stderr, "%s: %s is cyclic but has no GenMsgCycleTime\n", dbcPath, m->name);
+                exit(2);
+            }
+        } else if (m->isRx) {
+            m->pduId = (*numRx)++;
+        }
+    }
+    unsigned count = 0;
+    for (size_t i = 0; i < numSigs; i++) {
+        Signal* s = &sigs[i];
+        if (!included(s)) continue;
+        unsigned bitPos[32];
+        signalBits(s, bitPos);
+        for (unsigned b = 0; b < s->len; b++) {
+            if (bitPos[b] >= msgs[s->msg].dlc * 8U) {
+                fprintf(stderr, "%s: signal %s does not fit in %s\n", dbcPath, s->name, msgs[s->msg].name);
+                exit(2);
+            }
+        }
+        // Signal names only need to be unique within a message: qualify duplicates
+        snprintf(s->ident, sizeof(s->ident), "%s", s->name);
+        for (size_t j = 0; j < numSigs; j++) {
+            if (j != i && included(&sigs[j]) && strcmp(sigs[j].name, s->name) == 0) {
+                snprintf(s->ident, sizeof(s->ident), "%s_%s", s->name, msgs[s->msg].name);
+                break;
+            }
+        }
+        count++;
+    }
+    return count;
+}
+
+static void emitHeader(FILE* f, const char* node, unsigned tickMs, unsigned numRx, unsigned numTx, unsigned count) {
+    fprintf(f, "/*\n * Com_Cfg.h\n * Com configuration of node %s, generated by Host/comgen from %s\n"
+               " * Do not edit: change the .dbc file and rebuild\n */\n\n", node, dbcPath);
+    fprintf(f, "#ifndef COM_CFG_H\n#define COM_CFG_H\n\n");
+    fprintf(f, "/* Period of Com_MainFunctionTx in ms (GenMsgCycleTime/GenMsgDelayTime are counted in calls) */\n");
+    fprintf(f, "#define COM_MAIN_FUNCTION_PERIOD_MS  %uU\n\n", tickMs);
+    fprintf(f, "#define COM_NUM_RX_PDUS              %uU\n", numRx);
+    fprintf(f, "#define COM_NUM_TX_PDUS              %uU\n", numTx);
+    fprintf(f, "#define COM_NUM_SIGNALS              %uU\n\n", count);
+
+    for (int tx = 0; tx <= 1; tx++) {
+        fprintf(f, "/* %s I-PDUs */\n", tx ? "TX" : "RX");
+        for (size_t i = 0; i < numMsgs; i++) {
+            const Message* m = &msgs[i];
+            if (tx ? !m->isTx : !m->isRx) continue;
+            char num[16];
+            snprintf(num, sizeof(num), "%uU", m->pduId);
+            fprintf(f, "#define ComConf_ComIPdu_%-24s %-5s /* CAN ID 0x%03lX, DLC %u", m->name, num, m->id, m->dlc);
+            if (tx) {
+                fprintf(f, ", %s", modeNames[m->mode] + 12);
+                if (m->mode != MODE_DIRECT) fprintf(f, " %ld ms", m->cycle);
+            } else {
+                fprintf(f, ", from %s", m->sender);
+            }
+            fprintf(f, " */\n");
+        }
+        fprintf(f, "\n");
+    }
+
+    fprintf(f, "/* Signals: value type for Com_SendSignal/Com_ReceiveSignal, physical = raw * factor + offset */\n");
+    unsigned id = 0;
+    for (size_t i = 0; i < numSigs; i++) {
+        const Signal* s = &sigs[i];
+        if (!included(s)) continue;
+        char num[16];
+        snprintf(num, sizeof(num), "%uU", id++);
+        fprintf(f, "#define ComConf_ComSignal_%-22s %-5s /* %s %s, %s, %u bit, * %g + %g", s->ident, num,
+                msgs[s->msg].isTx ? "TX" : "RX", msgs[s->msg].name, valueType(s), s->len, s->factor, s->offset);
+        if (s->unit[0]) fprintf(f, " %s", s->unit);
+        fprintf(f, " */\n");
+    }
+    fprintf(f, "\n#endif /* COM_CFG_H */\n");
+}
+
+static void emitSource(FILE* f, const char* node, unsigned tickMs, unsigned numRx, unsigned numTx) {
+    fprintf(f, "/*\n * Com_Cfg.c\n * Com configuration of node %s, generated by Host/comgen from %s\n"
+               " * Do not edit: change the .dbc file and rebuild\n */\n\n#include \"Com.h\"\n\n", node, dbcPath);
+
+    for (size_t i = 0; i < numSigs; i++) {
+        const Signal* s = &sigs[i];
+        if (!included(s)) continue;
+        fprintf(f, "/* %s: %s bit %u, %u bit%s, %s */\n", s->ident, s->motorola ? "Motorola" : "Intel",
+                s->start, s->len, s->len > 1U ? "s" : "", s->isSigned ? "signed" : "unsigned");
+        if (msgs[s->msg].isTx) {
+            emitPack(f, s);
+        } else {
+            emitUnpack(f, s);
+        }
+    }
+
+    fprintf(f, "static const Com_RxPduConfigType Com_RxPdus[%s] = {\n", numRx ? "COM_NUM_RX_PDUS" : "1");
+    for (size_t i = 0; i < numMsgs; i++) {
+        if (msgs[i].isRx) {
+            fprintf(f, "    [ComConf_ComIPdu_%s] = { .Dlc = %u },\n", msgs[i].name, msgs[i].dlc);
+        }
+    }
+    fprintf(f, "};\n\nstatic const Com_TxPduConfigType Com_TxPdus[%s] = {\n", numTx ? "COM_NUM_TX_PDUS" : "1");
+    for (size_t i = 0; i < numMsgs; i++) {
+        const Message* m = &msgs[i];
+        if (!m->isTx) continue;
+        fprintf(f, "    [ComConf_ComIPdu_%s] = { .Mode = %s, .PeriodTicks = %u, .MdtTicks = %u, .Dlc = %u },\n",
+                m->name, modeNames[m->mode], m->mode == MODE_DIRECT ? 0U : ticks(m->cycle, tickMs),
+                ticks(m->delay, tickMs), m->dlc);
+    }
+    fprintf(f, "};\n\nstatic const Com_SignalConfigType Com_Signals[COM_NUM_SIGNALS] = {\n");
+    for (size_t i = 0; i < numSigs; i++) {
+        const Signal* s = &sigs[i];
+        if (!included(s)) continue;
+        const Message* m = &msgs[s->msg];
+        if (m->isTx) {
+            fprintf(f, "    [ComConf_ComSignal_%s] = { ComConf_ComIPdu_%s, COM_SIGNAL_TX, %s, NULL_PTR, Com_Pack_%s },\n",
+                    s->ident, m->name, xferNames[xferOf(s)], s->ident);
+        } else {
+            fprintf(f, "    [ComConf_ComSignal_%s] = { ComConf_ComIPdu_%s, COM_SIGNAL_RX, COM_PENDING, Com_Unpack_%s, NULL_PTR },\n",
+                    s->ident, m->name, s->ident);
+        }
+    }
+    fprintf(f, "};\n\nconst Com_ConfigType Com_Config = {\n"
+               "    .RxPdus     = Com_RxPdus,\n    .numRxPdus  = COM_NUM_RX_PDUS,\n"
+               "    .TxPdus     = Com_TxPdus,\n    .numTxPdus  = COM_NUM_TX_PDUS,\n"
+               "    .Signals    = Com_Signals,\n    .numSignals = COM_NUM_SIGNALS\n};\n");
+}
+
+static FILE* openOut(const char* dir, const char* name) {
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE* f = fopen(path, "w");
+    if (f == NULL) perror(path);
+    return f;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s -n node [-t main_function_ms] [-o outdir] file.dbc\n", prog);
+}
+
+int main(int argc, char** argv) {
+    const char* node = NULL;
+    const char* outDir = ".";
+    unsigned tickMs = 10;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            node = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            tickMs = (unsigned)strtoul(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outDir = argv[++i];
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            dbcPath = argv[i];
+        }
+    }
+    if (node == NULL || dbcPath == NULL || tickMs == 0U) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (readDbc(dbcPath, node) != 0) {
+        return 2;
+    }
+    unsigned numRx, numTx;
+    unsigned count = resolve(node, tickMs, &numRx, &numTx);
+    if (count == 0U) {
+        fprintf(stderr, "%s: node %s neither sends nor receives any signal\n", dbcPath, node);
+        return 2;
+    }
+
+    FILE* h = openOut(outDir, "Com_Cfg.h");
+    FILE* c = openOut(outDir, "Com_Cfg.c");
+    if (h == NULL || c == NULL) {
+        return 2;
+    }
+    emitHeader(h, node, tickMs, numRx, numTx, count);
+    emitSource(c, node, tickMs, numRx, numTx);
+    fclose(h);
+    fclose(c);
+    printf("%s: %u RX and %u TX I-PDUs, %u signals\n", node, numRx, numTx, count);
+    return 0;
+}
@@ -0,0 +1,506 @@
+/*
+ * mapreport.c
+ * Host report of flash/RAM use per module and symbol from a GNU ld map file,
+ * with optional cycle figures and budget checks (Linux, C99)
+ *
+ * Build:  make mapreport (top level) or make report in a demo
+ * Use:    ./mapreport [-b budget.txt] [-c cycles.csv] [-n N] blinkled.map
+ *
+ * Sizes are taken from the input sections of the memory map. With
+ * -ffunction-sections -fdata-sections every function and variable has its
+ * own section, so the section name gives the symbol. Module = object file
+ * (build directory and .o stripped; member name for libmcal.a, archive name
+ * for toolchain libraries). LTO
+ * builds link ltrans objects instead of the original files; their sections
+ * are attributed by symbol prefix ("Dio_*", "GPIO_*"), which follows the
+ * module naming of the drivers.
+ *
+ * Flash = sections in 0x08000000.., plus initialized .data and .ramfunc
+ * code (copied from flash). RAM = sections in 0x20000000..; the stack is not part of the map.
+ *
+ * Cycles (-c) are read from the CSV of trace_decode (TASK and ISR records:
+ * task / ISR index, execution cycles) or from plain "name,cycles" lines, e.g. figures
+ * copied from a target benchmark result.
+ *
+ * Budget file, one entry per line, '#' starts a comment, sizes accept a K suffix:
+ *   flash  <bytes>                    total flash (default 64K)
+ *   ram    <bytes>                    total RAM without stack (default 20K)
+ *   module <name> <flash> <ram>       per module, as printed in the report
+ *   cycles <name> <max>               worst case per cycle entry ("task0", "isr0", ...)
+ * The exit code is 1 when a budget is exceeded, so "make report" fails.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FLASH_BASE      0x08000000UL
+#define FLASH_END       0x08080000UL
+#define RAM_BASE        0x20000000UL
+#define RAM_END         0x20020000UL
+#define NAME_LEN        96
+
+typedef struct {
+    char name[NAME_LEN];
+    unsigned long flash;
+    unsigned long ram;
+    unsigned long flashBudget;  /* 0 = none */
+    unsigned long ramBudget;
+    int hasBudget;
+} Module;
+
+typedef struct {
+    char name[NAME_LEN];
+    int module;                 /* Index in modules[] */
+    unsigned long flash;
+    unsigned long ram;
+} Symbol;
+
+typedef struct {
+    char name[NAME_LEN];
+    unsigned long count;
+    unsigned long long sum;
+    unsigned long max;
+    unsigned long budget;       /* 0 = none */
+} Cycles;
+
+static Module* modules;
+static size_t numModules, capModules;
+static Symbol* symbols;
+static size_t numSymbols, capSymbols;
+static Cycles* cycles;
+static size_t numCycles, capCycles;
+
+static unsigned long flashTotal = 64UL * 1024UL;
+static unsigned long ramTotal = 20UL * 1024UL;
+
+static void* grow(void* p, size_t* cap, size_t elem) {
+    *cap = *cap ? *cap * 2U : 64U;
+    p = realloc(p, *cap * elem);
+    if (p == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(2);
+    }
+    return p;
+}
+
+static void copyName(char* dst, const char* src, size_t len) {
+    if (len >= NAME_LEN) {
+        len = NAME_LEN - 1U;
+    }
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static int findModule(const char* name) {
+    for (size_t i = 0; i < numModules; i++) {
+        if (strcmp(modules[i].name, name) == 0) {
+            return (int)i;
+        }
+    }
+    if (numModules == capModules) {
+        modules = grow(modules, &capModules, sizeof(*modules));
+    }
+    memset(&modules[numModules], 0, sizeof(*modules));
+    copyName(modules[numModules].name, name, strlen(name));
+    return (int)numModules++;
+}
+
+static Symbol* findSymbol(const char* name, int module) {
+    for (size_t i = 0; i < numSymbols; i++) {
+        if (symbols[i].module == module && strcmp(symbols[i].name, name) == 0) {
+            return &symbols[i];
+        }
+    }
+    if (numSymbols == capSymbols) {
+        symbols = grow(symbols, &capSymbols, sizeof(*symbols));
+    }
+    Symbol* s = &symbols[numSymbols++];
+    memset(s, 0, sizeof(*s));
+    copyName(s->name, name, strlen(name));
+    s->module = module;
+    return s;
+}
+
+static Cycles* findCycles(const char* name) {
+    for (size_t i = 0; i < numCycles; i++) {
+        if (strcmp(cycles[i].name, name) == 0) {
+            return &cycles[i];
+        }
+    }
+    if (numCycles == capCycles) {
+        cycles = grow(cycles, &capCycles, sizeof(*cycles));
+    }
+    Cycles* c = &cycles[numCycles++];
+    memset(c, 0, sizeof(*c));
+    copyName(c->name, name, strlen(name));
+    return c;
+}
+
+/*
+ * "Tools/release/Config/Adc_Cfg.o" -> "Config/Adc_Cfg", "../build/release/libmcal.a(Adc.o)" -> "Adc",
+ * ".../libc_nano.a(lib_a-memcpy.o)" -> "libc_nano.a"
+ */
+static void moduleFromObject(const char* obj, char* out) {
+    const char* paren = strchr(obj, '(');
+    if (paren != NULL) {
+        const char* base = obj;
+        for (const char* p = obj; p < paren; p++) {
+            if (*p == '/') base = p + 1;
+        }
+        if (strncmp(base, "libmcal.a(", 10) == 0) {
+            size_t len = strcspn(paren + 1, ")");   // One member per driver / SPL file
+            if (len > 2U && strncmp(paren + 1 + len - 2U, ".o", 2) == 0) {
+                len -= 2U;
+            }
+            copyName(out, paren + 1, len);
+        } else {
+            copyName(out, base, (size_t)(paren - base));
+        }
+        return;
+    }
+    if (strncmp(obj, "Tools/", 6) == 0) {
+        const char* next = strchr(obj + 6, '/');    // Skip the profile directory
+        obj = next ? next + 1 : obj + 6;
+    }
+    size_t len = strlen(obj);
+    if (len > 2U && strcmp(obj + len - 2U, ".o") == 0) {
+        len -= 2U;
+    }
+    copyName(out, obj, len);
+}
+
+/* Symbol prefix for LTO output: "Dio_WriteChannel" -> "Dio_*" */
+static void moduleFromSymbol(const char* sym, char* out) {
+    if (strcmp(sym, ".ramfunc") == 0) {
+        strcpy(out, "(lto) ramfunc");   // Named section: no symbol to attribute it by
+        return;
+    }
+    const char* us = strchr(sym, '_');
+    if (us == NULL || us == sym) {
+        strcpy(out, "(lto) other");
+        return;
+    }
+    size_t len = (size_t)(us - sym);
+    if (len > NAME_LEN - 3U) len = NAME_LEN - 3U;
+    memcpy(out, sym, len);
+    strcpy(out + len, "_*");
+}
+
+/* ".text.Dio_WriteChannel.lto_priv.0" -> "Dio_WriteChannel"; ".bss" stays ".bss" */
+static void symbolFromSection(const char* sect, char* out) {
+    const char* p = sect;
+    if (*p == '.') {
+        const char* dot = strchr(p + 1, '.');
+        if (dot != NULL && dot[1] != '\0') {
+            p = dot + 1;
+            size_t len = strcspn(p, ".");   // Drops .lto_priv.N, .constprop.N, .isra.N
+            copyName(out, p, len);
+            return;
+        }
+    }
+    copyName(out, sect, strlen(sect));
+}
+
+static void addSection(const char* sect, unsigned long addr, unsigned long size, const char* obj) {
+    unsigned long flash = 0, ram = 0;
+    if (size == 0UL) {
+        return;
+    }
+    if (addr >= FLASH_BASE && addr < FLASH_END) {
+        flash = size;
+    } else if (addr >= RAM_BASE && addr < RAM_END) {
+        ram = size;
+        if (strncmp(sect, ".data", 5) == 0 || strncmp(sect, ".ramfunc", 8) == 0) {
+            flash = size;   // Initial values / RAMFUNC code are stored in flash
+        }
+    } else {
+        return;             // Debug info, attributes
+    }
+
+    char sym[NAME_LEN], mod[NAME_LEN];
+    symbolFromSection(sect, sym);
+    if (strstr(obj, ".ltrans") != NULL) {
+        moduleFromSymbol(sym, mod);
+    } else {
+        moduleFromObject(obj, mod);
+    }
+    int m = findModule(mod);
+    modules[m].flash += flash;
+    modules[m].ram += ram;
+    Symbol* s = findSymbol(sym, m);
+    s->flash += flash;
+    s->ram += ram;
+}
+
+/* Parses "0xADDR 0xSIZE object" after the section name; returns 0 if the line is not of that form */
+static int parsePlacement(const char* p, unsigned long* addr, unsigned long* size, const char** obj) {
+    char* end;
+    while (*p == ' ') p++;
+    if (strncmp(p, "0x", 2) != 0) return 0;
+    *addr = strtoul(p, &end, 16);
+    p = end;
+    while (*p == ' ') p++;
+    if (strncmp(p, "0x", 2) != 0) return 0;
+    *size = strtoul(p, &end, 16);
+    p = end;
+    while (*p == ' ') p++;
+    if (*p == '\0') return 0;
+    *obj = p;
+    return 1;
+}
+
+static int readMap(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    char line[1024];
+    char pending[256] = "";     // Input section whose placement is on the next line
+    int inMap = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (!inMap) {
+            inMap = (strncmp(line, "Linker script and memory map", 28) == 0);
+            continue;
+        }
+        unsigned long addr, size;
+        const char* obj;
+        if (pending[0] != '\0') {
+            if (parsePlacement(line, &addr, &size, &obj)) {
+                addSection(pending, addr, size, obj);
+            }
+            pending[0] = '\0';
+            continue;
+        }
+        // Input sections are indented by one space; patterns (" *(.text*)"), fill and symbols are not sections
+        if (line[0] != ' ' || (line[1] != '.' && strncmp(line + 1, "COMMON", 6) != 0)) {
+            continue;
+        }
+        const char* name = line + 1;
+        size_t len = strcspn(name, " ");
+        if (len >= sizeof(pending)) len = sizeof(pending) - 1U;
+        if (name[len] == '\0') {
+            memcpy(pending, name, len + 1U);    // Long name: placement follows on the next line
+            continue;
+        }
+        char sect[256];
+        memcpy(sect, name, len);
+        sect[len] = '\0';
+        if (parsePlacement(name + len, &addr, &size, &obj)) {
+            addSection(sect, addr, size, obj);
+        }
+    }
+    fclose(f);
+    if (!inMap) {
+        fprintf(stderr, "%s: no memory map found (link with -Wl,-Map=...)\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static unsigned long parseSize(const char* s) {
+    char* end;
+    unsigned long v = strtoul(s, &end, 0);
+    if (*end == 'K' || *end == 'k') v *= 1024UL;
+    return v;
+}
+
+static int readBudget(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    char line[256];
+    unsigned lineNo = 0;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        lineNo++;
+        line[strcspn(line, "#\r\n")] = '\0';
+        char kind[16], name[NAME_LEN], a[32], b[32];
+        int n = sscanf(line, "%15s %95s %31s %31s", kind, name, a, b);
+        if (n <= 0) {
+            continue;
+        }
+        if (strcmp(kind, "flash") == 0 && n >= 2) {
+            flashTotal = parseSize(name);
+        } else if (strcmp(kind, "ram") == 0 && n >= 2) {
+            ramTotal = parseSize(name);
+        } else if (strcmp(kind, "module") == 0 && n == 4) {
+            int idx = findModule(name);     // May move modules[]
+            Module* m = &modules[idx];
+            m->flashBudget = parseSize(a);
+            m->ramBudget = parseSize(b);
+            m->hasBudget = 1;
+        } else if (strcmp(kind, "cycles") == 0 && n >= 3) {
+            findCycles(name)->budget = parseSize(a);
+        } else {
+            fprintf(stderr, "%s:%u: ignored: %s\n", path, lineNo, line);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+/* trace_decode CSV (seq,time_us,event,data0,data1) or "name,cycles" */
+static int readCycles(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL) {
+        perror(path);
+        return -1;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f) != NULL) {
+        line[strcspn(line, "\r\n")] = '\0';
+        char* field[5];
+        int n = 0;
+        for (char* tok = strtok(line, ","); tok != NULL && n < 5; tok = strtok(NULL, ",")) {
+            field[n++] = tok;
+        }
+        char name[NAME_LEN];
+        unsigned long value;
+        if (n == 5 && strcmp(field[2], "TASK") == 0) {
+            snprintf(name, sizeof(name), "task%lu", strtoul(field[3], NULL, 0));
+            value = strtoul(field[4], NULL, 0);
+        } else if (n == 5 && strcmp(field[2], "ISR") == 0) {
+            snprintf(name, sizeof(name), "isr%lu", strtoul(field[3], NULL, 0));
+            value = strtoul(field[4], NULL, 0);
+        } else if (n == 2 && isdigit((unsigned char)field[1][0])) {
+            copyName(name, field[0], strlen(field[0]));
+            value = strtoul(field[1], NULL, 0);
+        } else {
+            continue;   // Header, other events
+        }
+        Cycles* c = findCycles(name);
+        c->count++;
+        c->sum += value;
+        if (value > c->max) c->max = value;
+    }
+    fclose(f);
+    return 0;
+}
+
+static int byFlash(const void* a, const void* b) {
+    unsigned long x = ((const Symbol*)a)->flash, y = ((const Symbol*)b)->flash;
+    return (x < y) - (x > y);
+}
+
+static int byRam(const void* a, const void* b) {
+    unsigned long x = ((const Symbol*)a)->ram, y = ((const Symbol*)b)->ram;
+    return (x < y) - (x > y);
+}
+
+static int moduleByFlash(const void* a, const void* b) {
+    const Module* x = a;
+    const Module* y = b;
+    if (x->flash != y->flash) return (x->flash < y->flash) - (x->flash > y->flash);
+    return (x->ram < y->ram) - (x->ram > y->ram);
+}
+
+static void printSymbols(const char* title, int (*cmp)(const void*, const void*), int ram, size_t top) {
+    qsort(symbols, numSymbols, sizeof(*symbols), cmp);
+    printf("\n%s\n  %-36s %-28s %8s\n", title, "symbol", "module", "bytes");
+    for (size_t i = 0; i < numSymbols && i < top; i++) {
+        unsigned long v = ram ? symbols[i].ram : symbols[i].flash;
+        if (v == 0UL) break;
+        printf("  %-36s %-28s %8lu\n", symbols[i].name, modules[symbols[i].module].name, v);
+    }
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-b budget.txt] [-c cycles.csv] [-n N] file.map\n", prog);
+}
+
+int main(int argc, char** argv) {
+    const char* mapPath = NULL;
+    const char* budgetPath = NULL;
+    const char* cyclesPath = NULL;
+    size_t top = 15;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            budgetPath = argv[++i];
+        } else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+            cyclesPath = argv[++i];
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            top = (size_t)strtoul(argv[++i], NULL, 0);
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            mapPath = argv[i];
+        }
+    }
+    if (mapPath == NULL) {
+        usage(argv[0]);
+        return 2;
+    }
+    // Budgets first so budgeted modules are listed even when they end up empty
+    if ((budgetPath && readBudget(budgetPath) != 0) || readMap(mapPath) != 0 ||
+        (cyclesPath && readCycles(cyclesPath) != 0)) {
+        return 2;
+    }
+
+    unsigned long flash = 0, ram = 0;
+    for (size_t i = 0; i < numModules; i++) {
+        flash += modules[i].flash;
+        ram += modules[i].ram;
+    }
+    int over = 0;
+
+    // Symbols keep module indices: sort a copy of the module order only for printing
+    Module* sorted = malloc((numModules ? numModules : 1U) * sizeof(*sorted));
+    if (sorted == NULL) {
+        return 2;
+    }
+    memcpy(sorted, modules, numModules * sizeof(*sorted));
+    qsort(sorted, numModules, sizeof(*sorted), moduleByFlash);
+
+    printf("%s\n", mapPath);
+    printf("  flash %7lu / %7lu B  %5.1f %%%s\n", flash, flashTotal,
+           100.0 * (double)flash / (double)flashTotal, flash > flashTotal ? "  OVER" : "");
+    printf("  RAM   %7lu / %7lu B  %5.1f %%%s   (without stack)\n", ram, ramTotal,
+           100.0 * (double)ram / (double)ramTotal, ram > ramTotal ? "  OVER" : "");
+    over += (flash > flashTotal) + (ram > ramTotal);
+
+    printf("\nPer module\n  %-36s %8s %8s %16s\n", "module", "flash", "ram", "budget");
+    for (size_t i = 0; i < numModules; i++) {
+        const Module* m = &sorted[i];
+        printf("  %-36s %8lu %8lu", m->name, m->flash, m->ram);
+        if (m->hasBudget) {
+            int bad = (m->flash > m->flashBudget) || (m->ram > m->ramBudget);
+            printf(" %7lu %7lu%s", m->flashBudget, m->ramBudget, bad ? "  OVER" : "");
+            over += bad;
+        }
+        printf("\n");
+    }
+    free(sorted);
+
+    printSymbols("Largest in flash", byFlash, 0, top);
+    printSymbols("Largest in RAM", byRam, 1, top);
+
+    if (numCycles != 0U) {
+        printf("\nCycles\n  %-36s %8s %10s %10s %10s\n", "name", "runs", "avg", "max", "budget");
+        for (size_t i = 0; i < numCycles; i++) {
+            const Cycles* c = &cycles[i];
+            int bad = c->budget != 0UL && c->max > c->budget;
+            printf("  %-36s %8lu %10llu %10lu", c->name, c->count,
+                   c->count ? c->sum / c->count : 0ULL, c->max);
+            if (c->budget != 0UL) {
+                printf(" %10lu%s", c->budget, bad ? "  OVER" : (c->count ? "" : "  (no data)"));
+            }
+            printf("\n");
+            over += bad;
+        }
+    }
+
+    if (over) {
+        fprintf(stderr, "%d budget(s) exceeded\n", over);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * port_test.c
+ * Host check of MCAL/Port/Port.c: Port_RefreshPortDirection keeps the mode
+ * set by Port_SetPinMode, and a mode switch selects the same pull as
+ * Port_Init (Linux, C99)
+ *
+ * Build:  make test (top level, also runs it)
+ * Use:    ./port_test      exit code 0: all checks passed
+ *
+ * Port.c is built against Host/cansim/include/stm32f10x.h, whose GPIO ports
+ * are plain memory here. The pins are PA11/PA12 of the CAN demo: PA12 has a
+ * fixed direction but switches between CAN and DIO for bus-off recovery.
+ * PB8 is a CAN RX input configured with a pull-down that can switch to DIO:
+ * Port_GetPinCnf pulls a CAN RX line up regardless.
+ */
+
+#include <stdio.h>
+
+#include "Port.h"
+#include "Mcu.h"
+
+uint32_t Sim_GpioMem[4 * 0x400 / 4];
+
+/* Pull selected by the last BSRR store of a pin: 1 up, 0 down, -1 none */
+static int pull(GPIO_TypeDef* port, uint8_t pin) {
+    if (port->BSRR & (1UL << pin)) return 1;
+    if (port->BSRR & (1UL << (pin + 16))) return 0;
+    return -1;
+}
+
+/* Clock references and remaps are not checked here */
+Std_ReturnType Mcu_EnablePeripheral(Mcu_PeripheralType Periph) {
+    (void)Periph;
+    return E_OK;
+}
+
+Std_ReturnType Mcu_DisablePeripheral(Mcu_PeripheralType Periph) {
+    (void)Periph;
+    return E_OK;
+}
+
+void GPIO_PinRemapConfig(uint32_t GPIO_Remap, FunctionalState NewState) {
+    (void)GPIO_Remap;
+    (void)NewState;
+}
+
+static const Port_PinConfigType pins[] = {
+    {
+      .PortNum           = PORT_ID_A,   /* PA11 = CAN1_RX */
+      .PinNum            = 11,
+      .Mode              = PORT_PIN_MODE_CAN,
+      .Direction         = PORT_PIN_IN,
+      .speed             = 2,
+      .DirectionChangeable = 0,
+      .Level             = PORT_PIN_LEVEL_LOW,
+      .Pull              = PORT_PIN_PULL_UP,
+      .ModeChangeable    = 0,
+      .Remap             = 0
+    },
+    {
+      .PortNum           = PORT_ID_A,   /* PA12 = CAN1_TX */
+      .PinNum            = 12,
+      .Mode              = PORT_PIN_MODE_CAN,
+      .Direction         = PORT_PIN_OUT,
+      .speed             = 50,
+      .DirectionChangeable = 0,
+      .Level             = PORT_PIN_LEVEL_HIGH,
+      .Pull              = PORT_PIN_PULL_NONE,
+      .ModeChangeable    = 1,
+      .Remap             = 0
+    },
+    {
+      .PortNum           = PORT_ID_B,   /* PB8 = CAN RX of a second transceiver, pulled down as DIO */
+      .PinNum            = 8,
+      .Mode              = PORT_PIN_MODE_CAN,
+      .Direction         = PORT_PIN_IN,
+      .speed             = 2,
+      .DirectionChangeable = 0,
+      .Level             = PORT_PIN_LEVEL_LOW,
+      .Pull              = PORT_PIN_PULL_DOWN,
+      .ModeChangeable    = 1,
+      .Remap             = 0
+    }
+};
+
+static const Port_ConfigType cfg = { .PinConfigs = pins, .PinCount = 3 };
+
+/* CRH nibbles: CNF|MODE of PA11 (input pull) and PA12 (AF push-pull / open-drain output, 50 MHz) */
+#define PA11_CAN                0x8U
+#define PA12_CAN                0xBU
+#define PA12_DIO                0x7U
+
+static int failures;
+
+static void expect(const char* what, uint32_t got, uint32_t want) {
+    if (got == want) return;
+    printf("FAIL %s: 0x%08lX, expected 0x%08lX\n", what, (unsigned long)got, (unsigned long)want);
+    failures++;
+}
+
+static uint32_t nibble(uint8_t pin) {
+    return (GPIOA->CRH >> ((pin - 8U) * 4U)) & 0xFU;
+}
+
+int main(void) {
+    Port_Init(&cfg);
+    expect("init PA11", nibble(11), PA11_CAN);
+    expect("init PA12", nibble(12), PA12_CAN);
+
+    /* Bus-off recovery: PA12 to DIO; a refresh must not switch it back to CAN */
+    Port_SetPinMode(1, PORT_PIN_MODE_DIO);
+    expect("SetPinMode PA12", nibble(12), PA12_DIO);
+    Port_RefreshPortDirection();
+    expect("refresh after SetPinMode PA12", nibble(12), PA12_DIO);
+    expect("refresh after SetPinMode PA11", nibble(11), PA11_CAN);
+
+    /* Corrupted registers are restored to the current modes, pull-up re-selected */
+    GPIOA->CRH = 0x44444444UL;
+    GPIOA->BSRR = 0;
+    Port_RefreshPortDirection();
+    expect("restore PA11", nibble(11), PA11_CAN);
+    expect("restore PA12", nibble(12), PA12_DIO);
+    expect("restore pins of other nibbles", GPIOA->CRH & ~0x000FF000UL, 0x44444444UL & ~0x000FF000UL);
+    expect("restore PA11 pull-up (BSRR)", GPIOA->BSRR, 1UL << 11);
+
+    /* Back to CAN */
+    Port_SetPinMode(1, PORT_PIN_MODE_CAN);
+    Port_RefreshPortDirection();
+    expect("refresh after CAN PA12", nibble(12), PA12_CAN);
+
+    /* Mode of a pin without ModeChangeable is not changed, nor refreshed to another one */
+    Port_SetPinMode(0, PORT_PIN_MODE_DIO);
+    Port_RefreshPortDirection();
+    expect("fixed mode PA11", nibble(11), PA11_CAN);
+
+    /* CAN RX is pulled up by Port_Init and by a switch back to CAN, down as DIO input */
+    GPIOB->BSRR = 0;
+    Port_Init(&cfg);
+    expect("init PB8 pull-up", (uint32_t)pull(GPIOB, 8), 1U);
+    Port_SetPinMode(2, PORT_PIN_MODE_DIO);
+    expect("DIO PB8 pull-down", (uint32_t)pull(GPIOB, 8), 0U);
+    Port_SetPinMode(2, PORT_PIN_MODE_CAN);
+    expect("CAN PB8 pull-up", (uint32_t)pull(GPIOB, 8), 1U);
+    GPIOB->BSRR = 0;
+    Port_RefreshPortDirection();
+    expect("refresh PB8 pull-up", (uint32_t)pull(GPIOB, 8), 1U);
+
+    printf("port_test: %s\n", failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
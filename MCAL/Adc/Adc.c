@@ -4,8 +4,10 @@
  */
 
 #include "Adc.h"
-#include "Adc_Cfg.h"
 #include "Port.h"
+#include "Mcu.h"
+#include "Gpt.h"
+#include "Trace.h"
 #include "stm32f10x.h"
 #include <stddef.h>
 #include "stm32f10x_adc.h"
@@ -13,16 +15,24 @@
 
 extern Adc_GroupDefType Adc_Groups[];
 
+/* Result buffer of each DMA group (indexed like AdcGroupDmaConfig) */
+static Adc_ValueGroupType* Adc_DmaBuffer[ADC_MAX_GROUPS_DMA];
+
+/* Timebase stamp of the last completed DMA transfer of each DMA group, 0 = none yet */
+static volatile Gpt_TimestampType Adc_DmaTimestamp[ADC_MAX_GROUPS_DMA];
+
+/* Only ADC1 has a DMA request (DMA1 Channel 1); index of the group streaming on it, -1 = none */
+static int8_t Adc_DmaActive = -1;
+
+/* Instances whose clock reference is held (ADC_1, ADC_2), so repeated Adc_Init calls count once */
+static boolean Adc_ClockHeld[2] = { FALSE, FALSE };
+
 ADC_InitTypeDef ADC_InitStruct;
 
 void Adc_Init(const Adc_ConfigType* ConfigPtr)
 {
     if (ConfigPtr == NULL_PTR) return;
-    // Initialize ADC peripheral based on ConfigPtr
-    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);  // DMA1 for ADC1/ADC2
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1 | RCC_APB2Periph_ADC2, ENABLE); // Enable ADC clocks
     // Select ADC instance
-
     ADC_TypeDef* adcInstance = NULL;
     if (ConfigPtr->Instance == ADC_1) {
         adcInstance = ADC1;
@@ -31,6 +41,11 @@ void Adc_Init(const Adc_ConfigType* ConfigPtr)
     } else {
         return; // Invalid ADC instance
     }
+    // Clock of the configured instance only; ADCCLK prescaler is set by Mcu_InitClock
+    if (!Adc_ClockHeld[ConfigPtr->Instance]) {
+        (void)Mcu_EnablePeripheral((ConfigPtr->Instance == ADC_1) ? MCU_PERIPH_ADC1 : MCU_PERIPH_ADC2);
+        Adc_ClockHeld[ConfigPtr->Instance] = TRUE;
+    }
     // Initialize ADC peripheral
     ADC_InitStruct.ADC_Mode = ADC_Mode_Independent; // Independent mode for ADC1/ADC2
     ADC_InitStruct.ADC_ContinuousConvMode = (ConfigPtr->ConvMode == ADC_CONV_MODE_CONTINUOUS) ? ENABLE : DISABLE; // Single channel conversion
@@ -73,7 +88,18 @@ void Adc_DeInit(void)
 
     ADC_DeInit(ADC1);
     ADC_DeInit(ADC2);
-    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, DISABLE);  // Disable DMA clock
+    if (Adc_DmaActive >= 0) {
+        Dma_ReleaseChannel(ADC_DMA_CHANNEL);  // DMA1 clock belongs to the DMA driver
+        Adc_DmaActive = -1;
+    }
+    if (Adc_ClockHeld[ADC_1]) {
+        (void)Mcu_DisablePeripheral(MCU_PERIPH_ADC1);
+        Adc_ClockHeld[ADC_1] = FALSE;
+    }
+    if (Adc_ClockHeld[ADC_2]) {
+        (void)Mcu_DisablePeripheral(MCU_PERIPH_ADC2);
+        Adc_ClockHeld[ADC_2] = FALSE;
+    }
 }
 
 Std_ReturnType Adc_SetupResultBuffer(Adc_GroupType Group, Adc_ValueGroupType* DataBufferPtr)
@@ -267,9 +293,95 @@ void Adc_DisableGroupNotification(Adc_GroupType Group){
     }
 }
 
+/* DMA transfer complete of the streaming group: one-shot groups give the channel back */
+static void Adc_DmaNotification(Dma_ChannelType Channel, Dma_EventType Events)
+{
+    (void)Events;
+    if (Adc_DmaActive < 0) return;
+    Adc_DmaTimestamp[Adc_DmaActive] = Gpt_GetTimestamp();
+    const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[Adc_DmaActive];
+    TRACE_EMIT(TRACE_EV_ADC_DONE, cfg->groupId,
+               (Adc_DmaBuffer[Adc_DmaActive] != NULL_PTR) ? Adc_DmaBuffer[Adc_DmaActive][0] : 0U);
+
+    if (Adc_Groups[cfg->groupId].Adc_StreamBufferMode != ADC_STREAM_BUFFER_CIRCULAR) {
+        ADC_DMACmd(cfg->ADCx, DISABLE);
+        Dma_ReleaseChannel(Channel);
+        Adc_DmaActive = -1;
+    }
+    if (cfg->Adc_DmaNotificationCbType) cfg->Adc_DmaNotificationCbType();
+}
 
+/* The table size is a configuration constant, not a macro, so the driver builds once for every demo */
+static uint8_t Adc_NumGroupsDma(void)
+{
+    return (AdcNumGroupsDma < ADC_MAX_GROUPS_DMA) ? AdcNumGroupsDma : (uint8_t)ADC_MAX_GROUPS_DMA;
+}
 
+Std_ReturnType Adc_SetupResultBuffer_Dma(Adc_GroupType group, Adc_ValueGroupType* buf)
+{
+    for (int i = 0; i < Adc_NumGroupsDma(); i++) {
+        if (AdcGroupDmaConfig[i].groupId == group) {
+            Adc_DmaBuffer[i] = buf;
+            Dma_ReserveChannel(ADC_DMA_CHANNEL); // Keep DMA_CHANNEL_ANY requests off it
+            return E_OK;
+        }
+    }
+    return E_NOT_OK;
+}
 
+Std_ReturnType Adc_EnableDma(Adc_GroupType group)
+{
+    for (int i = 0; i < Adc_NumGroupsDma(); i++) {
+        const Adc_GroupDmaConfigType* cfg = &AdcGroupDmaConfig[i];
+        if (cfg->groupId != group) continue;
+        if (cfg->ADCx != ADC1 || Adc_DmaBuffer[i] == NULL_PTR) return E_NOT_OK;
+
+        // 1. Xin kênh DMA của ADC1 từ DMA driver (E_NOT_OK nếu driver khác đang dùng)
+        Dma_ChannelConfigType dcfg = {
+            .Direction    = DMA_DIR_PERIPH_TO_MEM,
+            .Mode         = (Adc_Groups[group].Adc_StreamBufferMode == ADC_STREAM_BUFFER_CIRCULAR)
+                            ? DMA_MODE_CIRCULAR : DMA_MODE_NORMAL,
+            .Priority     = DMA_PRIORITY_HIGH,
+            .PeriphWidth  = DMA_WIDTH_16,
+            .MemWidth     = DMA_WIDTH_16,
+            .PeriphInc    = 0,
+            .MemInc       = 1,
+            .Events       = DMA_EVENT_TC,
+            .Notification = Adc_DmaNotification
+        };
+        Dma_ChannelType ch = ADC_DMA_CHANNEL;
+        if (Dma_RequestChannel(&ch, &dcfg) != E_OK) return E_NOT_OK;
+        Adc_DmaActive = (int8_t)i;
+
+        // 2. Bật DMA & ADC<->DMA link
+        Dma_Start(ch, (uint32_t)&cfg->ADCx->DR, (uint32_t)Adc_DmaBuffer[i], cfg->channelCount);
+        ADC_DMACmd(cfg->ADCx, ENABLE);
+        return E_OK;
+    }
+    return E_NOT_OK;
+}
 
+Std_ReturnType Adc_DisableDma(Adc_GroupType group)
+{
+    if (Adc_DmaActive < 0 || AdcGroupDmaConfig[Adc_DmaActive].groupId != group) {
+        return E_NOT_OK;
+    }
+    ADC_DMACmd(AdcGroupDmaConfig[Adc_DmaActive].ADCx, DISABLE);
+    Dma_ReleaseChannel(ADC_DMA_CHANNEL);
+    Adc_DmaActive = -1;
+    return E_OK;
+}
 
-    
+Gpt_TimestampType Adc_GetDmaTimestamp(Adc_GroupType group)
+{
+    for (int i = 0; i < Adc_NumGroupsDma(); i++) {
+        if (AdcGroupDmaConfig[i].groupId == group) {
+            Gpt_TimestampType ts;
+            do {
+                ts = Adc_DmaTimestamp[i];
+            } while (ts != Adc_DmaTimestamp[i]);   // Two words: re-read if the notification wrote in between
+            return ts;
+        }
+    }
+    return 0;
+}
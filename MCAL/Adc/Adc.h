@@ -13,7 +13,8 @@
 #include "Std_Types.h"
 #include "stm32f10x_adc.h"
 #include "stm32f10x_rcc.h"
-#include "stm32f10x_dma.h"
+#include "Dma.h"
+#include "Gpt.h"
 #include "Port.h"
 #include "misc.h"
 
@@ -170,7 +171,7 @@ typedef struct{
     uint8 Adc_StreamEnableType; /** Enable DMA streaming **/
     uint8 Adc_StreamBufferSize; /** Size of the DMA buffer for streaming **/
     Adc_StreamBufferModeType Adc_StreamBufferMode; /** Buffer handling mode **/
-    
+
 } Adc_GroupDefType;
 
 extern Adc_GroupDefType Adc_Groups[MAX_ADC_GROUPS];
@@ -199,17 +200,20 @@ typedef struct {
 
 extern Adc_ConfigType Adc_Configs[2];
 
+#define ADC_DMA_CHANNEL 1U  // DMA1 Channel 1 is the only ADC request line (ADC1)
+
 typedef struct {
-    ADC_TypeDef*           ADCx;           // ADC instance (ADC1)
-    DMA_Channel_TypeDef*   DMA_Channel;    // DMA channel (DMA1_Channel1)
-    uint32_t               DMA_FLAG_TC;    // Flag Transfer Complete
+    ADC_TypeDef*           ADCx;           // ADC instance (chỉ ADC1 có DMA)
     Adc_GroupType          groupId;        // ID nhóm ADC
     uint8_t                channelCount;   // Số kênh trong nhóm
     void (*Adc_DmaNotificationCbType)(void); // Callback khi DMA TC
 } Adc_GroupDmaConfigType;
 
+#define ADC_MAX_GROUPS_DMA      4U      /* DMA result buffers held by the driver */
 
-
+/* DMA groups of the application configuration (defined next to the group table) */
+extern const Adc_GroupDmaConfigType AdcGroupDmaConfig[];
+extern const uint8_t AdcNumGroupsDma;   /* Entries in AdcGroupDmaConfig, at most ADC_MAX_GROUPS_DMA */
 
 /**
  * @brief Initializes the ADC driver with the given configuration
@@ -294,13 +298,37 @@ Adc_StreamNumSampleType Adc_GetStreamLastPointer (Adc_GroupType Group,Adc_ValueG
  */
 void Adc_GetVersionInfo (Std_VersionInfoType* versioninfo);
 
-void ADC1_2_IRQHandler(void);
-
-void Port_ConfigAdcPin(uint8 portNum, uint8 pinNum);
-
+/**
+ * @brief Sets the buffer that receives the DMA results of a group
+ * @param group Group listed in AdcGroupDmaConfig
+ * @param buf Buffer of channelCount results
+ * @return E_OK if the group has a DMA configuration
+ */
 Std_ReturnType Adc_SetupResultBuffer_Dma(Adc_GroupType group, Adc_ValueGroupType* buf);
 
+/**
+ * @brief Streams the results of a group into its buffer by DMA
+ * @param group Group listed in AdcGroupDmaConfig (ADC1 only)
+ * @return E_OK if started, E_NOT_OK if DMA1 Channel 1 is owned by another driver/group
+ * @details One-shot groups release the DMA channel on transfer complete,
+ *          circular groups keep it until Adc_DisableDma.
+ */
 Std_ReturnType Adc_EnableDma(Adc_GroupType group);
 
+/**
+ * @brief Stops DMA streaming of a group and releases its DMA channel
+ * @param group Group passed to Adc_EnableDma
+ */
 Std_ReturnType Adc_DisableDma(Adc_GroupType group);
+
+/**
+ * @brief Completion time of the last DMA transfer of a group
+ * @param group Group listed in AdcGroupDmaConfig
+ * @return Gpt_GetTimestamp taken in the DMA notification (us), 0 if no transfer completed yet
+ */
+Gpt_TimestampType Adc_GetDmaTimestamp(Adc_GroupType group);
+
+void ADC1_2_IRQHandler(void);
+
+void Port_ConfigAdcPin(uint8 portNum, uint8 pinNum);
 #endif /* ADC_H */
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "can.h"
+#include "stm32f10x_can.h"
+#include "stm32f10x_rcc.h"
+#include "stm32f10x_gpio.h"
+#include "Trace.h"
+#include "Compiler.h"
+#include "Mcu.h"
+#include "Gpt.h"
+
+// Biến callback nhận từ CanIf (lưu function pointer)
+static void (*rxCallback)(Can_IdType, uint8_t*, uint8_t) = 0;
+
+// Callback xác nhận gửi (CanIf_TxConfirmation) và CAN ID của frame đang nằm trong từng mailbox
+static void (*txCallback)(Can_IdType) = 0;
+static Can_IdType txMailboxId[3];
+
+// Thời điểm (timebase Gpt, us) của frame đang được báo qua rxCallback
+static Gpt_TimestampType rxTimestamp = 0;
+
+// Đã giữ clock CAN1 qua Mcu chưa (Can_Init gọi lại sau khi đổi clock thì không đếm thêm)
+static uint8_t canClockHeld = 0;
+
+void Can_Init(const Can_ConfigType* Config)
+{
+    // 1. Enable clock for CAN1
+    //    Chân RX/TX (PA11/PA12 hoặc PB8/PB9 remap) do Port_Init cấu hình
+    //    Prescaler trong Config tính theo PCLK1 (Mcu_GetClockFreq(MCU_CLK_PCLK1))
+    if (!canClockHeld) {
+        (void)Mcu_EnablePeripheral(MCU_PERIPH_CAN1);
+        canClockHeld = 1;
+    }
+
+    // 2. Init cấu hình CAN
+    CAN_InitTypeDef can_init;
+    CAN_DeInit(CAN1);
+    CAN_StructInit(&can_init);
+
+    can_init.CAN_TTCM = DISABLE;
+    can_init.CAN_ABOM = ENABLE;
+    can_init.CAN_AWUM = DISABLE;
+    can_init.CAN_NART = DISABLE;
+    can_init.CAN_RFLM = DISABLE;
+    can_init.CAN_TXFP = ENABLE;   // 3 mailbox gửi theo thứ tự yêu cầu: CF của CanTp (cùng CAN ID) không bị đảo
+    can_init.CAN_Mode = Config->CAN_Mode;
+    can_init.CAN_SJW = Config->CAN_SJW;
+    can_init.CAN_BS1 = Config->CAN_BS1;
+    can_init.CAN_BS2 = Config->CAN_BS2;
+    can_init.CAN_Prescaler = Config->CAN_Prescaler;
+    CAN_Init(CAN1, &can_init);
+
+    // 4. Init bộ lọc (filter)
+    CAN_FilterInitTypeDef filter;
+    filter.CAN_FilterNumber = 0;
+    filter.CAN_FilterMode = CAN_FilterMode_IdMask;
+    filter.CAN_FilterScale = CAN_FilterScale_32bit;
+    filter.CAN_FilterIdHigh     = Config->FilterIdHigh;
+    filter.CAN_FilterIdLow      = Config->FilterIdLow;
+    filter.CAN_FilterMaskIdHigh = Config->FilterMaskIdHigh;
+    filter.CAN_FilterMaskIdLow  = Config->FilterMaskIdLow;
+    filter.CAN_FilterFIFOAssignment = CAN_FIFO0;
+    filter.CAN_FilterActivation = ENABLE;
+    CAN_FilterInit(&filter);
+
+    // 5. Enable interrupt nhận FIFO0 và mailbox gửi xong (TME: xác nhận gửi)
+    CAN_ITConfig(CAN1, CAN_IT_FMP0 | CAN_IT_TME, ENABLE);
+    NVIC_EnableIRQ(USB_LP_CAN1_RX0_IRQn); // ĐÚNG IRQ cho F103
+    NVIC_EnableIRQ(USB_HP_CAN1_TX_IRQn);
+}
+
+// Gửi 1 frame CAN (chuẩn AUTOSAR: truyền vào Hth, PduInfo)
+uint8_t Can_Write(Can_HwHandleType Hth, const Can_PduType* PduInfo)
+{
+    (void)Hth; // demo: 1 mailbox
+    CanTxMsg tx;
+    tx.StdId = (uint16_t)(PduInfo->id & 0x7FF);
+    tx.ExtId = 0;
+    tx.IDE   = CAN_Id_Standard;  // Sửa IDE cho đúng SPL
+    tx.RTR   = CAN_RTR_DATA;
+    tx.DLC   = PduInfo->length;
+    for (uint8_t i = 0; i < PduInfo->length && i < 8; ++i)
+        tx.Data[i] = PduInfo->sdu[i];
+
+    // Khóa ngắt: TX ISR không được thấy mailbox gửi xong trước khi CAN ID của nó được ghi
+    uint32_t primask = Compiler_EnterCritical();
+    uint8_t mbox = CAN_Transmit(CAN1, &tx);
+    if (mbox < 3) txMailboxId[mbox] = tx.StdId;
+    Compiler_ExitCritical(primask);
+    TRACE_EMIT(TRACE_EV_CAN_TX, tx.StdId, tx.DLC | ((uint32_t)mbox << 8));
+    return (mbox < 3) ? 0 : 1; // 0=E_OK, 1=E_NOT_OK
+}
+
+// Đăng ký callback nhận frame (CanIf sẽ truyền function pointer vào)
+void Can_RegisterRxCallback(void (*cb)(Can_IdType canId, uint8_t* data, uint8_t len))
+{
+    rxCallback = cb;
+}
+
+// Đăng ký callback xác nhận gửi (CanIf_TxConfirmation)
+void Can_RegisterTxCallback(void (*cb)(Can_IdType canId))
+{
+    txCallback = cb;
+}
+
+// Timestamp của frame đang được báo (chỉ có nghĩa khi gọi trong callback nhận)
+Gpt_TimestampType Can_GetRxTimestamp(void)
+{
+    return rxTimestamp;
+}
+
+// ISR nhận dữ liệu từ hardware (tên vector đúng với F103); chạy từ RAM khi build RAMFUNC=1
+RAMFUNC void USB_LP_CAN1_RX0_IRQHandler(void)
+{
+    TRACE_ISR_ENTER();
+    Gpt_TimestampType now = Gpt_GetTimestamp();   // càng sớm càng gần thời điểm frame vào FIFO
+    if (CAN_GetITStatus(CAN1, CAN_IT_FMP0) != RESET) {
+        rxTimestamp = now;
+        CanRxMsg rx;
+        CAN_Receive(CAN1, CAN_FIFO0, &rx);
+        TRACE_EMIT(TRACE_EV_CAN_RX, rx.StdId, rx.DLC | ((uint32_t)rx.Data[0] << 8) |
+                   ((uint32_t)rx.Data[1] << 16) | ((uint32_t)rx.Data[2] << 24));
+        if (rxCallback) {
+            rxCallback(rx.StdId, rx.Data, rx.DLC);
+        }
+        CAN_ClearITPendingBit(CAN1, CAN_IT_FMP0);
+    }
+    TRACE_ISR_EXIT(TRACE_ISR_CAN_RX0);
+}
+
+// ISR gửi xong (RQCPx của từng mailbox); chạy từ RAM khi build RAMFUNC=1
+RAMFUNC void USB_HP_CAN1_TX_IRQHandler(void)
+{
+    static const uint32_t rqcp[3] = { CAN_FLAG_RQCP0, CAN_FLAG_RQCP1, CAN_FLAG_RQCP2 };
+    TRACE_ISR_ENTER();
+    for (uint8_t mbox = 0; mbox < 3; ++mbox) {
+        if (CAN_GetFlagStatus(CAN1, rqcp[mbox]) == RESET) {
+            continue;
+        }
+        // Đọc TXOK trước: ghi RQCP xóa luôn TXOK. Chỉ xóa mailbox này, mailbox
+        // khác gửi xong trong lúc đó vẫn giữ ngắt
+        uint8_t ok = (CAN_TransmitStatus(CAN1, mbox) == CAN_TxStatus_Ok);
+        CAN_ClearFlag(CAN1, rqcp[mbox]);
+        if (ok && txCallback) {
+            txCallback(txMailboxId[mbox]);
+        }
+    }
+    TRACE_ISR_EXIT(TRACE_ISR_CAN_TX);
+}
@@ -5,6 +5,7 @@
 #include "stm32f10x.h"   // Thư viện SPL STM32F1
 #include "stm32f10x_can.h"
 #include "stm32f10x_usart.h"
+#include "Gpt.h"         // Gpt_TimestampType (timebase chung của các driver)
 // ===================== AUTOSAR Type Definitions =====================
 
 // Chuẩn AUTOSAR: Can_IdType, Can_HwHandleType, Can_PduType
@@ -36,8 +37,14 @@ typedef struct {
 void Can_Init(const Can_ConfigType* Config);
 uint8_t Can_Write(Can_HwHandleType Hth, const Can_PduType* PduInfo);
 void Can_RegisterRxCallback(void (*cb)(Can_IdType canId, uint8_t* data, uint8_t len));
+// Callback xác nhận gửi: gọi trong CAN TX ISR khi frame của mailbox đã rời bus thành công
+void Can_RegisterTxCallback(void (*cb)(Can_IdType canId));
+// Thời điểm nhận (us, Gpt_GetTimestamp lúc vào ISR) của frame đang được báo; gọi trong callback nhận
+Gpt_TimestampType Can_GetRxTimestamp(void);
 
 // Gọi từ ISR hardware khi nhận được frame (trong USB_LP_CAN1_RX0_IRQHandler)
 void USB_LP_CAN1_RX0_IRQHandler(void);
+// Gọi từ ISR hardware khi mailbox gửi xong (trong USB_HP_CAN1_TX_IRQHandler)
+void USB_HP_CAN1_TX_IRQHandler(void);
 
 #endif // CAN_H_
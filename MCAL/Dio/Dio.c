@@ -16,14 +16,44 @@
 
 /* Implementation of AUTOSAR DIO APIs */
 
+/* ODR bit-band alias of each bit-band channel, NULL = BSRR path.
+ * The IDR alias of the same pin is 32 words below (IDR is at ODR - 4). */
+static volatile uint32_t* Dio_BitBandOdr[DIO_NUM_CHANNELS];
 
-static inline GPIO_TypeDef* GetGPIOPortFromId(uint8 portId) {
-    switch (portId) {
-        case DIO_PORT_A: return GPIOA;
-        case DIO_PORT_B: return GPIOB;
-        case DIO_PORT_C: return GPIOC;
-        case DIO_PORT_D: return GPIOD;
-        default: return NULL;
+#define DIO_BITBAND_IDR(OdrAlias)   ((OdrAlias) - 32)
+
+
+static inline GPIO_TypeDef* GetGPIOPortFromId(uint8_t portId) {
+    /* Ports are 0x400 apart: one compare instead of a switch */
+    return (portId <= DIO_PORT_D) ? DIO_PORT_BASE(portId) : NULL;
+}
+
+/*******************************************************************************
+ * @fn Dio_Init
+ * @brief Precompute the bit-band alias addresses of the configured channels
+ * @param[in] ConfigPtr Channels and access mode; NULL_PTR restores the BSRR path
+ ******************************************************************************/
+void Dio_Init(const Dio_ConfigType* ConfigPtr)
+{
+    for (uint8_t i = 0; i < DIO_NUM_CHANNELS; i++)
+    {
+        Dio_BitBandOdr[i] = NULL_PTR;
+    }
+
+    if (ConfigPtr == NULL_PTR || ConfigPtr->AccessMode != DIO_ACCESS_BITBAND)
+    {
+        return; /* BSRR path for all channels */
+    }
+
+    for (uint8_t i = 0; i < ConfigPtr->numChannels; i++)
+    {
+        uint8_t ChannelId = (uint8_t)ConfigPtr->Channels[i];
+        if (ChannelId >= DIO_NUM_CHANNELS)
+        {
+            continue; /* Invalid channel, keep BSRR path */
+        }
+        GPIO_TypeDef *GPIO_Port = DIO_CHANNEL_PORT(ChannelId);
+        Dio_BitBandOdr[ChannelId] = DIO_BITBAND_ALIAS(&GPIO_Port->ODR, ChannelId % 16);
     }
 }
 
@@ -38,6 +68,12 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
     GPIO_TypeDef *GPIO_Port; /* pointer to indentify GPIO Port */
     uint16_t GPIO_Pin; /* GPIO Pin */
 
+    /* Bit-band channel: the IDR alias word is the pin level (0/1) */
+    if ((uint8_t)ChannelId < DIO_NUM_CHANNELS && Dio_BitBandOdr[(uint8_t)ChannelId] != NULL_PTR)
+    {
+        return (Dio_LevelType)*DIO_BITBAND_IDR(Dio_BitBandOdr[(uint8_t)ChannelId]);
+    }
+
     /* Determine GPIO Port with DIO_GET_PORT */
     GPIO_Port = GetGPIOPortFromId(DIO_GET_PORT(ChannelId));
 
@@ -72,6 +108,13 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
     GPIO_TypeDef *GPIO_Port; /* pointer to indentify GPIO Port */
     uint16_t GPIO_Pin; /* GPIO Pin */
 
+    /* Bit-band channel: one store, the bus does an atomic bit update of ODR */
+    if ((uint8_t)ChannelId < DIO_NUM_CHANNELS && Dio_BitBandOdr[(uint8_t)ChannelId] != NULL_PTR)
+    {
+        *Dio_BitBandOdr[(uint8_t)ChannelId] = (Level == STD_HIGH) ? 1U : 0U;
+        return;
+    }
+
     /* Determine GPIO Port with DIO_GET_PORT */
     GPIO_Port = GetGPIOPortFromId(DIO_GET_PORT(ChannelId));
 
@@ -83,15 +126,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
     /* Determine GPIO Pin with DIO_GET_PIN */
     GPIO_Pin = DIO_GET_PIN(ChannelId);
 
-    /* Write the pin level */
-    if (Level == STD_HIGH)
-    {
-        GPIO_SetBits(GPIO_Port, GPIO_Pin); /* Set pin high */
-    }
-    else
-    {
-        GPIO_ResetBits(GPIO_Port, GPIO_Pin); /* Set pin low */
-    }
+    /* Write the pin level: one BSRR store, set in the low half, reset in the high half */
+    GPIO_Port->BSRR = (Level == STD_HIGH) ? (uint32_t)GPIO_Pin : ((uint32_t)GPIO_Pin << 16);
 }
 
 
@@ -136,7 +172,7 @@ void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
     }
 
     /* Write the port level */
-    GPIO_Write(GPIO_Port, Level);
+    GPIO_Port->ODR = (uint16_t)Level;
 }
 
 /*******************************************************************************
@@ -180,15 +216,10 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
         return; /* Invalid port, do nothing */
     }
     
-    /* Read logic states of all pin */
-    uint16_t portData = GPIO_ReadInputData(GPIO_Port);
-
-    /* Delete old bits in the group and write with new bits */
-    portData &= ~(ChannelGroupIdPtr->mask); /* Clear bits according to mask */
-    portData |= ((Level << ChannelGroupIdPtr->offset) & ChannelGroupIdPtr->mask); /* Write new value */
-
-    /* Write new data to GPIO */
-    GPIO_Write(GPIO_Port, portData);   
+    /* Shift the group value into place and write it with a single BSRR store */
+    uint16_t mask = (uint16_t)ChannelGroupIdPtr->mask;
+    uint16_t level = (uint16_t)(((uint16_t)Level << ChannelGroupIdPtr->offset) & mask);
+    GPIO_Port->BSRR = DIO_BSRR_VALUE(mask, level);
 }
 
 /*******************************************************************************
@@ -198,16 +229,35 @@ void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_Po
  ******************************************************************************/
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-    Dio_LevelType currentLevel = Dio_ReadChannel(ChannelId);
+    /* Bit-band channel: read and write the ODR alias word; the write itself is
+       atomic, only a concurrent writer of the same pin can interleave */
+    if ((uint8_t)ChannelId < DIO_NUM_CHANNELS && Dio_BitBandOdr[(uint8_t)ChannelId] != NULL_PTR)
+    {
+        volatile uint32_t *odr = Dio_BitBandOdr[(uint8_t)ChannelId];
+        uint32_t level = *odr ^ 1U;
+        *odr = level;
+        return (Dio_LevelType)level;
+    }
+
+    GPIO_TypeDef *GPIO_Port = GetGPIOPortFromId(DIO_GET_PORT(ChannelId));
+
+    if (GPIO_Port == NULL_PTR)
+    {
+        return STD_LOW; /* Invalid port, return low level */
+    }
+
+    uint16_t GPIO_Pin = DIO_GET_PIN(ChannelId);
 
-    if (currentLevel == STD_HIGH)
+    /* Toggle from the output latch (ODR), not the pin input, and commit with one
+       BSRR store so other pins of the port are never rewritten */
+    if (GPIO_Port->ODR & GPIO_Pin)
     {
-        Dio_WriteChannel(ChannelId, STD_LOW);
+        GPIO_Port->BSRR = (uint32_t)GPIO_Pin << 16;
         return STD_LOW;
     }
     else
     {
-        Dio_WriteChannel(ChannelId, STD_HIGH);
+        GPIO_Port->BSRR = GPIO_Pin;
         return STD_HIGH;
     }
 }
@@ -246,8 +296,7 @@ void Dio_MaskedWritePort(
         return; /* Invalid port, do nothing */
     }
 
-    uint16_t portData = GPIO_ReadOutputData(GPIO_Port);
-    portData = (portData & ~Mask) | (Level & Mask);
-    GPIO_Write(GPIO_Port, portData);
+    /* No read-modify-write: pins outside Mask are untouched, safe against ISRs */
+    GPIO_Port->BSRR = DIO_BSRR_VALUE((uint16_t)Mask, (uint16_t)Level);
 }
 /* End of file */
\ No newline at end of file
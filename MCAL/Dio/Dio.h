@@ -48,6 +48,24 @@
 #define DIO_GET_PIN(ChannelId) \
 (1 << ((ChannelId) % 16)) 
 
+/* GPIO register block of a port: GPIOA..GPIOD are 0x400 apart, no switch needed */
+#define DIO_PORT_BASE(PortId) \
+    ((GPIO_TypeDef *)(GPIOA_BASE + ((uint32_t)(PortId) * 0x400U)))
+
+/* GPIO register block of a channel */
+#define DIO_CHANNEL_PORT(ChannelId) \
+    DIO_PORT_BASE(DIO_GET_PORT(ChannelId))
+
+/*******************************************************************************
+ * BSRR image for a masked write
+ * @param[in] Mask  Pins to modify
+ * @param[in] Level New levels of the pins in Mask
+ * @details High half resets (Mask & ~Level), low half sets (Mask & Level).
+ *          One store, no read, pins outside Mask are not touched.
+ ******************************************************************************/
+#define DIO_BSRR_VALUE(Mask, Level) \
+    ((((uint32_t)(Mask) & ~(uint32_t)(Level) & 0xFFFFU) << 16) | ((uint32_t)(Mask) & (uint32_t)(Level)))
+
 /*******************************************************************************
  * Macro indentification of Channel ID based on GPIO Port and Pin
  * @param[in] GPIO_Port Port ID of the GPIO port
@@ -160,6 +178,42 @@ typedef struct
     uint8               offset;     /**< Bit offset within the port */
 } Dio_ChannelGroupType;
 
+/*******************************************************************************
+ * @typedef Dio_AccessModeType
+ * @brief  Register access used by the single-channel services
+ ******************************************************************************/
+typedef enum
+{
+    DIO_ACCESS_BSRR    = 0x00,  /**< IDR read / BSRR store (default, no init needed) */
+    DIO_ACCESS_BITBAND = 0x01   /**< One word access to the precomputed bit-band alias */
+} Dio_AccessModeType;
+
+/*******************************************************************************
+ * @struct Dio_ConfigType
+ * @brief Optional DIO configuration passed to Dio_Init
+ */
+typedef struct
+{
+    Dio_AccessModeType      AccessMode;     /**< Access mode of the listed channels */
+    const Dio_ChannelType*  Channels;       /**< Channels that use AccessMode */
+    uint8_t                 numChannels;    /**< Number of entries in Channels */
+} Dio_ConfigType;
+
+/* Number of channel IDs (A0..D15) */
+#define DIO_NUM_CHANNELS    64U
+
+/* Bit-band alias word of bit BitNum of the peripheral register at RegAddr */
+#define DIO_BITBAND_ALIAS(RegAddr, BitNum) \
+    ((volatile uint32_t *)(PERIPH_BB_BASE + (((uint32_t)(RegAddr) - PERIPH_BASE) * 32U) + ((uint32_t)(BitNum) * 4U)))
+
+/*******************************************************************************
+ * @fn Dio_Init
+ * @brief Precompute the bit-band alias addresses of the configured channels
+ * @param[in] ConfigPtr Channels and access mode; NULL_PTR restores the BSRR path
+ * @details Optional: without Dio_Init every channel uses the BSRR path.
+ ******************************************************************************/
+void Dio_Init(const Dio_ConfigType* ConfigPtr);
+
 /*******************************************************************************
  * @fn Dio_ReadChannel
  * @brief Read the level of a specific DIO channel
@@ -232,6 +286,70 @@ void Dio_GetVersionInfo(Std_VersionInfoType* VersionInfo);
 void Dio_MaskedWritePort(Dio_PortType PortId, Dio_PortLevelType Level, Dio_PortLevelType Mask);
 
 
+/*******************************************************************************
+ * DIO fast path (header only)
+ * @details For channel IDs known at compile time (e.g. DIO_CHANNEL_C13) the
+ *          port address, pin mask and BSRR value are constant expressions, so
+ *          each access is a single load or store, even at -O0 for the macros.
+ *          No range check: use only with valid constant IDs; the out-of-line
+ *          API above stays the entry point for runtime IDs.
+ ******************************************************************************/
+
+/* Inlined at every optimization level */
+#define DIO_INLINE static __INLINE __attribute__((always_inline))
+
+/* Read the level of a channel (STD_HIGH/STD_LOW) */
+#define DIO_READ_CHANNEL_FAST(ChannelId) \
+    ((Dio_LevelType)((DIO_CHANNEL_PORT(ChannelId)->IDR >> ((ChannelId) % 16)) & 1U))
+
+/* Drive a channel high or low with one BSRR store */
+#define DIO_WRITE_CHANNEL_FAST(ChannelId, Level) \
+    (DIO_CHANNEL_PORT(ChannelId)->BSRR = ((Level) == STD_HIGH) \
+        ? (uint32_t)DIO_GET_PIN(ChannelId) \
+        : ((uint32_t)DIO_GET_PIN(ChannelId) << 16))
+
+/* Drive a channel high (BSRR) or low (BRR) when the level is a constant too */
+#define DIO_SET_CHANNEL_FAST(ChannelId) \
+    (DIO_CHANNEL_PORT(ChannelId)->BSRR = (uint32_t)DIO_GET_PIN(ChannelId))
+#define DIO_CLEAR_CHANNEL_FAST(ChannelId) \
+    (DIO_CHANNEL_PORT(ChannelId)->BRR = (uint32_t)DIO_GET_PIN(ChannelId))
+
+/*******************************************************************************
+ * @fn Dio_ReadChannelFast
+ * @brief Inline Dio_ReadChannel for constant, valid channel IDs
+ ******************************************************************************/
+DIO_INLINE Dio_LevelType Dio_ReadChannelFast(Dio_ChannelType ChannelId)
+{
+    return DIO_READ_CHANNEL_FAST(ChannelId);
+}
+
+/*******************************************************************************
+ * @fn Dio_WriteChannelFast
+ * @brief Inline Dio_WriteChannel for constant, valid channel IDs
+ ******************************************************************************/
+DIO_INLINE void Dio_WriteChannelFast(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    DIO_WRITE_CHANNEL_FAST(ChannelId, Level);
+}
+
+/*******************************************************************************
+ * @fn Dio_FlipChannelFast
+ * @brief Inline Dio_FlipChannel for constant, valid channel IDs
+ * @return Dio_LevelType: the new level of the channel
+ ******************************************************************************/
+DIO_INLINE Dio_LevelType Dio_FlipChannelFast(Dio_ChannelType ChannelId)
+{
+    GPIO_TypeDef *GPIO_Port = DIO_CHANNEL_PORT(ChannelId);
+    uint32_t GPIO_Pin = (uint32_t)DIO_GET_PIN(ChannelId);
+
+    if (GPIO_Port->ODR & GPIO_Pin)
+    {
+        GPIO_Port->BRR = GPIO_Pin;
+        return STD_LOW;
+    }
+    GPIO_Port->BSRR = GPIO_Pin;
+    return STD_HIGH;
+}
 
 #endif /* DIO_H */
 
@@ -0,0 +1,209 @@
+/*
+ * Dma.c
+ * DMA1 Driver implementation for STM32F103C8
+ */
+
+#include "Dma.h"
+#include "Mcu.h"
+#include "Trace.h"
+#include <stddef.h>
+
+/* Registers of DMA1 channel n (1..7); the channel blocks are 0x14 apart */
+#define DMA_CHANNEL_REGS(Channel) \
+    ((DMA_Channel_TypeDef *)(DMA1_Channel1_BASE + 0x14U * ((uint32_t)(Channel) - 1U)))
+
+/* ISR/IFCR nibble of channel n: GIF, TCIF, HTIF, TEIF at bit 4 * (n - 1) */
+#define DMA_FLAG_SHIFT(Channel)   (4U * ((uint32_t)(Channel) - 1U))
+#define DMA_EVENT_ALL             (DMA_EVENT_TC | DMA_EVENT_HT | DMA_EVENT_TE)
+
+static uint8_t Dma_Initialized = 0;
+static uint8_t Dma_Owned = 0;                                   /* Bit n-1 set: channel n is owned */
+static uint8_t Dma_Reserved = 0;                                /* Bit n-1 set: channel n is wired to a configured peripheral */
+static uint16_t Dma_Ccr[DMA_NUM_CHANNELS];                      /* CCR image (without EN) of each owned channel */
+static Dma_NotificationType Dma_Notifications[DMA_NUM_CHANNELS];
+
+/**
+ * @brief Returns TRUE if Channel is a valid channel owned by a driver.
+ */
+static __INLINE boolean Dma_IsOwned(Dma_ChannelType Channel) {
+    return (Channel != 0U && Channel <= DMA_NUM_CHANNELS &&
+            (Dma_Owned & (1U << (Channel - 1U)))) ? TRUE : FALSE;
+}
+
+void Dma_Init(void) {
+    if (!Dma_Initialized) {
+        (void)Mcu_EnablePeripheral(MCU_PERIPH_DMA1);    // One reference however often Dma_Init runs
+    }
+    for (Dma_ChannelType ch = 1; ch <= DMA_NUM_CHANNELS; ch++) {
+        DMA_CHANNEL_REGS(ch)->CCR = 0;
+        Dma_Notifications[ch - 1U] = NULL_PTR;
+        Dma_Ccr[ch - 1U] = 0;
+    }
+    DMA1->IFCR = 0x0FFFFFFFU; // Clear the flags of all 7 channels
+    Dma_Owned = 0;
+    Dma_Initialized = 1;
+}
+
+void Dma_DeInit(void) {
+    for (Dma_ChannelType ch = 1; ch <= DMA_NUM_CHANNELS; ch++) {
+        Dma_ReleaseChannel(ch);
+    }
+    if (Dma_Initialized) {
+        (void)Mcu_DisablePeripheral(MCU_PERIPH_DMA1);
+    }
+    Dma_Initialized = 0;
+}
+
+Std_ReturnType Dma_RequestChannel(Dma_ChannelType* Channel, const Dma_ChannelConfigType* Config) {
+    if (!Dma_Initialized || Channel == NULL_PTR || Config == NULL_PTR) {
+        return E_NOT_OK;
+    }
+    if (Config->Direction == DMA_DIR_MEM_TO_MEM && Config->Mode == DMA_MODE_CIRCULAR) {
+        return E_NOT_OK; // Not supported by the hardware
+    }
+
+    // 1) CCR image: everything but EN, so Dma_Start is one store
+    uint32_t ccr = ((uint32_t)Config->PeriphWidth << 8) |
+                   ((uint32_t)Config->MemWidth << 10) |
+                   ((uint32_t)Config->Priority << 12) |
+                   (Config->Events & DMA_EVENT_ALL);
+    if (Config->Direction == DMA_DIR_MEM_TO_PERIPH) ccr |= DMA_CCR1_DIR;
+    if (Config->Direction == DMA_DIR_MEM_TO_MEM)    ccr |= DMA_CCR1_MEM2MEM;
+    if (Config->Mode == DMA_MODE_CIRCULAR)          ccr |= DMA_CCR1_CIRC;
+    if (Config->PeriphInc)                          ccr |= DMA_CCR1_PINC;
+    if (Config->MemInc)                             ccr |= DMA_CCR1_MINC;
+
+    // 2) Claim: drivers may request from task and notification context
+    uint32_t primask = Compiler_EnterCritical();
+    Dma_ChannelType ch = *Channel;
+    if (ch == DMA_CHANNEL_ANY) {
+        // Channels no configured peripheral needs first, a reserved one only while it is free
+        uint8_t free = (uint8_t)(~Dma_Owned & ((1U << DMA_NUM_CHANNELS) - 1U));
+        uint8_t pick = (free & (uint8_t)~Dma_Reserved) ? (uint8_t)(free & ~Dma_Reserved) : free;
+        for (ch = DMA_NUM_CHANNELS; ch > 0U; ch--) {
+            if (pick & (1U << (ch - 1U))) break;
+        }
+    } else if (ch > DMA_NUM_CHANNELS || (Dma_Owned & (1U << (ch - 1U)))) {
+        ch = 0;
+    } else {
+        Dma_Reserved |= (uint8_t)(1U << (ch - 1U));    // The peripheral will want it again
+    }
+    if (ch == 0U) {
+        Compiler_ExitCritical(primask);
+        return E_NOT_OK; // Owned by another driver or no channel left
+    }
+    Dma_Owned |= (uint8_t)(1U << (ch - 1U));
+    Compiler_ExitCritical(primask);
+
+    // 3) Program the idle channel
+    DMA_CHANNEL_REGS(ch)->CCR = 0;
+    DMA1->IFCR = 0xFUL << DMA_FLAG_SHIFT(ch);
+    Dma_Ccr[ch - 1U] = (uint16_t)ccr;
+    Dma_Notifications[ch - 1U] = Config->Notification;
+    if (Config->Events & DMA_EVENT_ALL) {
+        NVIC_EnableIRQ((IRQn_Type)(DMA1_Channel1_IRQn + (ch - 1U)));
+    }
+
+    *Channel = ch;
+    return E_OK;
+}
+
+void Dma_ReserveChannel(Dma_ChannelType Channel) {
+    if (Channel == 0U || Channel > DMA_NUM_CHANNELS) {
+        return;
+    }
+    uint32_t primask = Compiler_EnterCritical();
+    Dma_Reserved |= (uint8_t)(1U << (Channel - 1U));
+    Compiler_ExitCritical(primask);
+}
+
+void Dma_ReleaseChannel(Dma_ChannelType Channel) {
+    if (!Dma_IsOwned(Channel)) {
+        return;
+    }
+    NVIC_DisableIRQ((IRQn_Type)(DMA1_Channel1_IRQn + (Channel - 1U)));
+    DMA_CHANNEL_REGS(Channel)->CCR = 0;
+    DMA1->IFCR = 0xFUL << DMA_FLAG_SHIFT(Channel);
+    Dma_Notifications[Channel - 1U] = NULL_PTR;
+
+    uint32_t primask = Compiler_EnterCritical();
+    Dma_Owned &= (uint8_t)~(1U << (Channel - 1U));
+    Compiler_ExitCritical(primask);
+}
+
+Std_ReturnType Dma_Start(Dma_ChannelType Channel, uint32_t SrcAddr, uint32_t DstAddr, uint16_t Count) {
+    if (!Dma_IsOwned(Channel) || Count == 0U) {
+        return E_NOT_OK;
+    }
+    DMA_Channel_TypeDef* regs = DMA_CHANNEL_REGS(Channel);
+    uint32_t ccr = Dma_Ccr[Channel - 1U];
+
+    // CPAR/CMAR/CNDTR are only writable while EN = 0
+    regs->CCR = 0;
+    DMA1->IFCR = 0xFUL << DMA_FLAG_SHIFT(Channel);
+    if (ccr & DMA_CCR1_DIR) {
+        regs->CPAR = DstAddr;   // Memory -> peripheral
+        regs->CMAR = SrcAddr;
+    } else {
+        regs->CPAR = SrcAddr;   // Peripheral (or source memory) -> memory
+        regs->CMAR = DstAddr;
+    }
+    regs->CNDTR = Count;
+    regs->CCR = ccr | DMA_CCR1_EN;
+    return E_OK;
+}
+
+void Dma_Stop(Dma_ChannelType Channel) {
+    if (!Dma_IsOwned(Channel)) {
+        return;
+    }
+    DMA_CHANNEL_REGS(Channel)->CCR = Dma_Ccr[Channel - 1U];
+}
+
+uint16_t Dma_GetRemaining(Dma_ChannelType Channel) {
+    if (!Dma_IsOwned(Channel)) {
+        return 0;
+    }
+    return (uint16_t)DMA_CHANNEL_REGS(Channel)->CNDTR;
+}
+
+boolean Dma_IsBusy(Dma_ChannelType Channel) {
+    if (!Dma_IsOwned(Channel)) {
+        return FALSE;
+    }
+    DMA_Channel_TypeDef* regs = DMA_CHANNEL_REGS(Channel);
+    uint32_t ccr = regs->CCR;
+    // EN is cleared by hardware on a transfer error
+    if (!(ccr & DMA_CCR1_EN)) return FALSE;
+    return ((ccr & DMA_CCR1_CIRC) || regs->CNDTR != 0U) ? TRUE : FALSE;
+}
+
+RAMFUNC void Dma_IrqHandler(Dma_ChannelType Channel) {
+    if (Channel == 0U || Channel > DMA_NUM_CHANNELS) {
+        return;
+    }
+    TRACE_ISR_ENTER();
+    uint32_t shift = DMA_FLAG_SHIFT(Channel);
+    uint32_t flags = (DMA1->ISR >> shift) & DMA_EVENT_ALL;
+    DMA1->IFCR = flags << shift;
+
+    // Flags are set whether or not their interrupt is enabled; report only the requested ones
+    Dma_EventType events = (Dma_EventType)(flags & Dma_Ccr[Channel - 1U]);
+    Dma_NotificationType cb = Dma_Notifications[Channel - 1U];
+    if (events && cb != NULL_PTR) {
+        cb(Channel, events);
+    }
+    TRACE_ISR_EXIT(TRACE_ISR_DMA(Channel));
+}
+
+void Dma_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return; // Invalid pointer
+    }
+
+    versioninfo->vendorID = DMA_VENDOR_ID;
+    versioninfo->moduleID = DMA_MODULE_ID;
+    versioninfo->sw_major_version = DMA_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = DMA_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = DMA_SW_PATCH_VERSION;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file    Dma.h
+ * @brief   DMA1 Driver Header File for STM32F103C8
+ * @version 1.0
+ * @date    2025
+ *
+ * Owns the seven DMA1 channels. Drivers request the channel wired to their
+ * peripheral (RM0008 DMA1 request mapping), memory-to-memory users request
+ * any free channel. A channel has one owner until it is released, so two
+ * drivers can no longer program the same channel behind each other's back.
+ * All DMA1 ISRs live in Dma_Cfg.c and forward to Dma_IrqHandler, which
+ * calls the owner's notification with the HT/TC/TE events that occurred.
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+#include "stm32f10x_rcc.h"
+#include "misc.h"
+
+#define DMA_VENDOR_ID         1234
+#define DMA_MODULE_ID         255
+#define DMA_SW_MAJOR_VERSION  1
+#define DMA_SW_MINOR_VERSION  0
+#define DMA_SW_PATCH_VERSION  0
+
+#define DMA_NUM_CHANNELS      7U    /* DMA1 Channel1..Channel7 */
+#define DMA_CHANNEL_ANY       0U    /* Dma_RequestChannel: any free channel (memory-to-memory) */
+
+/** DMA1 channel number, 1..7 as in the reference manual */
+typedef uint8_t Dma_ChannelType;
+
+/** Event bit mask; values match the TCIE/HTIE/TEIE bits of CCRx and TCIF/HTIF/TEIF of ISR */
+typedef uint8_t Dma_EventType;
+#define DMA_EVENT_TC          ((Dma_EventType)0x02U)   /**< Transfer complete */
+#define DMA_EVENT_HT          ((Dma_EventType)0x04U)   /**< Half transfer */
+#define DMA_EVENT_TE          ((Dma_EventType)0x08U)   /**< Transfer error (channel is disabled by hardware) */
+
+/** Called from the DMA interrupt with the events that occurred */
+typedef void (*Dma_NotificationType)(Dma_ChannelType Channel, Dma_EventType Events);
+
+/** Transfer direction */
+typedef enum {
+    DMA_DIR_PERIPH_TO_MEM = 0x00,   /**< Peripheral register -> memory */
+    DMA_DIR_MEM_TO_PERIPH = 0x01,   /**< Memory -> peripheral register */
+    DMA_DIR_MEM_TO_MEM = 0x02       /**< Memory -> memory, runs without a request */
+} Dma_DirectionType;
+
+/** Normal (stop after Count items) or circular (reload and repeat) */
+typedef enum {
+    DMA_MODE_NORMAL = 0x00,
+    DMA_MODE_CIRCULAR = 0x01
+} Dma_ModeType;
+
+/** Software priority; equal priorities are arbitrated by channel number (lower first) */
+typedef enum {
+    DMA_PRIORITY_LOW = 0x00,
+    DMA_PRIORITY_MEDIUM = 0x01,
+    DMA_PRIORITY_HIGH = 0x02,
+    DMA_PRIORITY_VERY_HIGH = 0x03
+} Dma_PriorityType;
+
+/** Item size of one side of the transfer */
+typedef enum {
+    DMA_WIDTH_8 = 0x00,
+    DMA_WIDTH_16 = 0x01,
+    DMA_WIDTH_32 = 0x02
+} Dma_WidthType;
+
+/**
+ * @brief Configuration of a requested channel
+ * @details For DMA_DIR_MEM_TO_MEM the "peripheral" side is the source.
+ */
+typedef struct {
+    Dma_DirectionType Direction;        /**< Transfer direction */
+    Dma_ModeType Mode;                  /**< Normal or circular */
+    Dma_PriorityType Priority;          /**< Arbitration priority */
+    Dma_WidthType PeriphWidth;          /**< Item size on the peripheral (source) side */
+    Dma_WidthType MemWidth;             /**< Item size on the memory side */
+    uint8_t PeriphInc;                  /**< 1 = increment the peripheral (source) address */
+    uint8_t MemInc;                     /**< 1 = increment the memory address */
+    Dma_EventType Events;               /**< Events that raise an interrupt (0 = none) */
+    Dma_NotificationType Notification;  /**< Called with the occurred Events (NULL: none) */
+} Dma_ChannelConfigType;
+
+/**
+ * @brief Initializes the DMA driver: enables the DMA1 clock and frees all channels.
+ */
+void Dma_Init(void);
+
+/**
+ * @brief De-initializes the DMA driver: stops all channels and gates the DMA1 clock.
+ */
+void Dma_DeInit(void);
+
+/**
+ * @brief Claims a channel and programs its configuration.
+ * @param Channel In: channel wired to the peripheral (1..7) or DMA_CHANNEL_ANY.
+ *                Out: the allocated channel.
+ * @param Config Channel configuration (copied, may be a local variable).
+ * @return E_OK if the channel was free, E_NOT_OK if it is owned or arguments are invalid.
+ * @details DMA_CHANNEL_ANY takes a channel that is not reserved (Dma_ReserveChannel)
+ *          if one is free, else a free reserved one; it scans from channel 7 down,
+ *          so memory-to-memory work loses hardware arbitration against peripheral
+ *          channels of equal priority. Requesting a fixed channel reserves it.
+ */
+Std_ReturnType Dma_RequestChannel(Dma_ChannelType* Channel, const Dma_ChannelConfigType* Config);
+
+/**
+ * @brief Marks a channel as wired to a configured peripheral.
+ * @param Channel Channel (1..7) the peripheral requests later.
+ * @details Called from the Init of peripheral drivers for channels they only
+ *          request on demand, so DMA_CHANNEL_ANY requests keep off them
+ *          while other channels are free. Reservations survive Dma_Init and
+ *          may be made before it.
+ */
+void Dma_ReserveChannel(Dma_ChannelType Channel);
+
+/**
+ * @brief Stops a channel and returns it to the free pool.
+ * @param Channel Channel returned by Dma_RequestChannel.
+ */
+void Dma_ReleaseChannel(Dma_ChannelType Channel);
+
+/**
+ * @brief Starts a transfer on an owned channel.
+ * @param Channel Owned channel.
+ * @param SrcAddr Source address (peripheral register or memory).
+ * @param DstAddr Destination address (peripheral register or memory).
+ * @param Count Number of items (1..65535).
+ * @return E_OK if started, E_NOT_OK if the channel is not owned or Count is 0.
+ */
+Std_ReturnType Dma_Start(Dma_ChannelType Channel, uint32_t SrcAddr, uint32_t DstAddr, uint16_t Count);
+
+/**
+ * @brief Stops a transfer; the channel stays owned.
+ * @param Channel Owned channel.
+ */
+void Dma_Stop(Dma_ChannelType Channel);
+
+/**
+ * @brief Returns the number of items left (CNDTR); 0 when a normal transfer is done.
+ * @param Channel Owned channel.
+ */
+uint16_t Dma_GetRemaining(Dma_ChannelType Channel);
+
+/**
+ * @brief Returns TRUE while a normal-mode transfer is running (always TRUE for circular).
+ * @param Channel Owned channel.
+ */
+boolean Dma_IsBusy(Dma_ChannelType Channel);
+
+/**
+ * @brief Handles the interrupt of one DMA1 channel.
+ * @param Channel Channel number (1..7).
+ * @details Called from the DMA1 ISRs in Dma_Cfg.c. Runs from RAM in RAMFUNC=1 builds.
+ */
+RAMFUNC void Dma_IrqHandler(Dma_ChannelType Channel);
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Dma_GetVersionInfo(Std_VersionInfoType* versioninfo);
+
+#endif /* DMA_H */
@@ -0,0 +1,319 @@
+/*
+ * Gpt.c
+ * AUTOSAR GPT Driver implementation for STM32F103C8
+ */
+
+#include "Gpt.h"
+#include "Mcu.h"
+#include "Trace.h"
+#include <stddef.h>
+
+#define GPT_NOT_QUEUED      0xFFU       /* HeapPos of a channel that is not running */
+#define GPT_CC_HORIZON_US   0xFFFFU     /* CC1 can only reach deadlines within one counter period */
+
+/** Runtime data of a channel */
+typedef struct {
+    uint32_t Deadline;      /* Absolute Gpt_GetTimeUs of the next expiry; remaining time once stopped */
+    uint32_t Value;         /* Value of the last start (period of a continuous channel) */
+    uint8_t HeapPos;        /* Index in Gpt_Heap, GPT_NOT_QUEUED when not running */
+    uint8_t State;          /* Gpt_ChannelStateType */
+    uint8_t NotifyEnabled;
+} Gpt_ChannelInfoType;
+
+static TIM_TypeDef* const Gpt_Timers[3] = { TIM2, TIM3, TIM4 };
+static const IRQn_Type Gpt_Irqs[3] = { TIM2_IRQn, TIM3_IRQn, TIM4_IRQn };
+
+static const Gpt_ConfigType* Gpt_ConfigPtr = NULL_PTR;
+
+Gpt_TimebaseType Gpt_Timebase = { NULL_PTR, 0 };
+
+static Gpt_ChannelInfoType Gpt_Channels[GPT_MAX_CHANNELS];
+
+/* Min-heap of the running channels, earliest deadline at index 0 */
+static uint8_t Gpt_Heap[GPT_MAX_CHANNELS];
+static uint8_t Gpt_HeapSize = 0;
+
+/* Deadline a is earlier than b (modulo 2^32) */
+static __INLINE boolean Gpt_Before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static __INLINE void Gpt_HeapPlace(uint16_t Pos, uint8_t Channel) {
+    Gpt_Heap[Pos] = Channel;
+    Gpt_Channels[Channel].HeapPos = (uint8_t)Pos;
+}
+
+static void Gpt_SiftUp(uint16_t Pos) {
+    uint8_t ch = Gpt_Heap[Pos];
+    uint32_t deadline = Gpt_Channels[ch].Deadline;
+    while (Pos > 0U) {
+        uint16_t parent = (uint16_t)((Pos - 1U) / 2U);
+        if (!Gpt_Before(deadline, Gpt_Channels[Gpt_Heap[parent]].Deadline)) break;
+        Gpt_HeapPlace(Pos, Gpt_Heap[parent]);
+        Pos = parent;
+    }
+    Gpt_HeapPlace(Pos, ch);
+}
+
+static void Gpt_SiftDown(uint16_t Pos) {
+    uint8_t ch = Gpt_Heap[Pos];
+    uint32_t deadline = Gpt_Channels[ch].Deadline;
+    for (;;) {
+        uint16_t child = (uint16_t)(2U * Pos + 1U);
+        if (child >= Gpt_HeapSize) break;
+        if (child + 1U < Gpt_HeapSize &&
+            Gpt_Before(Gpt_Channels[Gpt_Heap[child + 1U]].Deadline, Gpt_Channels[Gpt_Heap[child]].Deadline)) {
+            child++;
+        }
+        if (!Gpt_Before(Gpt_Channels[Gpt_Heap[child]].Deadline, deadline)) break;
+        Gpt_HeapPlace(Pos, Gpt_Heap[child]);
+        Pos = child;
+    }
+    Gpt_HeapPlace(Pos, ch);
+}
+
+static void Gpt_HeapInsert(uint8_t Channel) {
+    Gpt_Heap[Gpt_HeapSize] = Channel;
+    Gpt_SiftUp(Gpt_HeapSize++);
+}
+
+static void Gpt_HeapRemove(uint8_t Channel) {
+    uint16_t pos = Gpt_Channels[Channel].HeapPos;
+    uint8_t last = Gpt_Heap[--Gpt_HeapSize];
+    Gpt_Channels[Channel].HeapPos = GPT_NOT_QUEUED;
+    if (pos == Gpt_HeapSize) return;
+    // The last entry fills the hole and moves up or down from there
+    Gpt_HeapPlace(pos, last);
+    Gpt_SiftUp(pos);
+    Gpt_SiftDown(Gpt_Channels[last].HeapPos);
+}
+
+/**
+ * @brief Programs CC1 for the deadline at the top of the heap (critical section held).
+ * @return FALSE if the deadline is already due: the caller has to expire it.
+ */
+static boolean Gpt_ArmCompare(uint32_t Deadline) {
+    int32_t left = (int32_t)(Deadline - Gpt_GetTimeUs());
+    if (left > (int32_t)GPT_CC_HORIZON_US) {
+        Gpt_Timebase.Timer->DIER &= (uint16_t)~TIM_DIER_CC1IE;     // The update interrupt re-arms in time
+        return TRUE;
+    }
+    if (left > 0) {
+        Gpt_Timebase.Timer->CCR1 = (uint16_t)Deadline;
+        Gpt_Timebase.Timer->SR = (uint16_t)~TIM_SR_CC1IF;
+        Gpt_Timebase.Timer->DIER |= TIM_DIER_CC1IE;
+        // The counter may have passed CCR1 while it was written
+        if ((int32_t)(Deadline - Gpt_GetTimeUs()) > 0) return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Expires the due channels and arms CC1 for the next deadline.
+ * @details One heap operation per critical section; notifications run with
+ *          interrupts enabled and may start/stop channels.
+ */
+static void Gpt_Service(void) {
+    for (;;) {
+        uint32_t primask = Compiler_EnterCritical();
+        if (Gpt_HeapSize == 0U) {
+            Gpt_Timebase.Timer->DIER &= (uint16_t)~TIM_DIER_CC1IE;
+            Compiler_ExitCritical(primask);
+            return;
+        }
+        uint8_t ch = Gpt_Heap[0];
+        Gpt_ChannelInfoType* info = &Gpt_Channels[ch];
+        if (Gpt_ArmCompare(info->Deadline)) {
+            Compiler_ExitCritical(primask);
+            return;
+        }
+
+        Gpt_HeapRemove(ch);
+        if (Gpt_ConfigPtr->Channels[ch].Mode == GPT_CH_MODE_CONTINUOUS) {
+            // Next period from the deadline, not from now: no drift. A channel a whole
+            // period behind restarts from now instead of firing back to back.
+            uint32_t now = Gpt_GetTimeUs();
+            info->Deadline += info->Value;
+            if (!Gpt_Before(now, info->Deadline)) {
+                info->Deadline = now + info->Value;
+            }
+            Gpt_HeapInsert(ch);
+        } else {
+            info->State = GPT_CH_EXPIRED;
+        }
+        Gpt_NotificationType notify = info->NotifyEnabled ? Gpt_ConfigPtr->Channels[ch].Notification : NULL_PTR;
+        Compiler_ExitCritical(primask);
+
+        if (notify != NULL_PTR) {
+            notify();
+        }
+    }
+}
+
+void Gpt_Init(const Gpt_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR || (ConfigPtr->Channels == NULL_PTR && ConfigPtr->numChannels > 0U) ||
+        ConfigPtr->numChannels > GPT_MAX_CHANNELS || ConfigPtr->HwTimer > GPT_HW_TIM4) {
+        return;
+    }
+    // Re-init after a clock switch: channels start over, the timebase goes on from here
+    Gpt_TimestampType now = Gpt_GetTimestamp();
+    Gpt_DeInit();
+
+    TIM_TypeDef* tim = Gpt_Timers[ConfigPtr->HwTimer];
+    (void)Mcu_EnablePeripheral((Mcu_PeripheralType)(MCU_PERIPH_TIM2 + ConfigPtr->HwTimer));
+
+    for (uint16_t i = 0; i < ConfigPtr->numChannels; i++) {
+        Gpt_Channels[i].Deadline = 0;
+        Gpt_Channels[i].Value = 0;
+        Gpt_Channels[i].HeapPos = GPT_NOT_QUEUED;
+        Gpt_Channels[i].State = GPT_CH_INITIALIZED;
+        Gpt_Channels[i].NotifyEnabled = 1;
+    }
+    Gpt_HeapSize = 0;
+    Gpt_Timebase.Overflows = (uint32_t)(now >> 16);
+
+    // Free-running 16-bit up-counter at 1 MHz; CC1 as frozen output compare (no pin)
+    tim->CR1 = 0;
+    tim->DIER = 0;
+    tim->CCER = 0;
+    tim->CCMR1 = 0;
+    tim->PSC = (uint16_t)(Mcu_GetClockFreq(MCU_CLK_TIMCLK1) / 1000000UL - 1U);
+    tim->ARR = 0xFFFF;
+    tim->EGR = TIM_EGR_UG;      // Load PSC now (clears CNT)
+    tim->CNT = (uint16_t)now;
+    tim->SR = 0;                // UG also set UIF: not an overflow
+
+    Gpt_ConfigPtr = ConfigPtr;
+    Gpt_Timebase.Timer = tim;
+
+    tim->DIER = TIM_DIER_UIE;
+    NVIC_SetPriority(Gpt_Irqs[ConfigPtr->HwTimer], ConfigPtr->IrqPriority);
+    NVIC_EnableIRQ(Gpt_Irqs[ConfigPtr->HwTimer]);
+    tim->CR1 = TIM_CR1_CEN;
+}
+
+void Gpt_DeInit(void) {
+    if (Gpt_Timebase.Timer == NULL_PTR) {
+        return;
+    }
+    IRQn_Type irq = Gpt_Irqs[Gpt_ConfigPtr->HwTimer];
+    NVIC_DisableIRQ(irq);
+    Gpt_Timebase.Timer->CR1 = 0;
+    Gpt_Timebase.Timer->DIER = 0;
+    Gpt_Timebase.Timer->SR = 0;
+    NVIC_ClearPendingIRQ(irq);
+    (void)Mcu_DisablePeripheral((Mcu_PeripheralType)(MCU_PERIPH_TIM2 + Gpt_ConfigPtr->HwTimer));
+
+    Gpt_HeapSize = 0;
+    Gpt_Timebase.Timer = NULL_PTR;
+    Gpt_ConfigPtr = NULL_PTR;
+}
+
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels ||
+        Value == 0U || Value > GPT_MAX_VALUE_US) {
+        return;
+    }
+    Gpt_ChannelInfoType* info = &Gpt_Channels[Channel];
+
+    uint32_t primask = Compiler_EnterCritical();
+    if (info->HeapPos != GPT_NOT_QUEUED) {
+        Gpt_HeapRemove(Channel);    // Restart
+    }
+    info->Value = Value;
+    info->Deadline = Gpt_GetTimeUs() + Value;
+    info->State = GPT_CH_RUNNING;
+    Gpt_HeapInsert(Channel);
+    // New earliest deadline: move CC1, or let the interrupt expire it if it is already due
+    if (Gpt_Heap[0] == Channel && !Gpt_ArmCompare(info->Deadline)) {
+        NVIC_SetPendingIRQ(Gpt_Irqs[Gpt_ConfigPtr->HwTimer]);
+    }
+    Compiler_ExitCritical(primask);
+}
+
+void Gpt_StopTimer(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return;
+    }
+    Gpt_ChannelInfoType* info = &Gpt_Channels[Channel];
+
+    uint32_t primask = Compiler_EnterCritical();
+    if (info->HeapPos != GPT_NOT_QUEUED) {
+        int32_t left = (int32_t)(info->Deadline - Gpt_GetTimeUs());
+        info->Deadline = (left > 0) ? (uint32_t)left : 0U;
+        info->State = GPT_CH_STOPPED;
+        Gpt_HeapRemove(Channel);    // CC1 may still fire once for it: Gpt_Service finds nothing due
+    }
+    Compiler_ExitCritical(primask);
+}
+
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return 0;
+    }
+    const Gpt_ChannelInfoType* info = &Gpt_Channels[Channel];
+    switch (info->State) {
+        case GPT_CH_RUNNING: {
+            int32_t left = (int32_t)(info->Deadline - Gpt_GetTimeUs());
+            return (left > 0) ? (uint32_t)left : 0U;
+        }
+        case GPT_CH_STOPPED:
+            return info->Deadline;
+        default:
+            return 0;
+    }
+}
+
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return 0;
+    }
+    const Gpt_ChannelInfoType* info = &Gpt_Channels[Channel];
+    if (info->State == GPT_CH_INITIALIZED) {
+        return 0;
+    }
+    return info->Value - Gpt_GetTimeRemaining(Channel);
+}
+
+Gpt_ChannelStateType Gpt_GetChannelState(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return GPT_CH_INITIALIZED;
+    }
+    return (Gpt_ChannelStateType)Gpt_Channels[Channel].State;
+}
+
+void Gpt_EnableNotification(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return;
+    }
+    Gpt_Channels[Channel].NotifyEnabled = 1;
+}
+
+void Gpt_DisableNotification(Gpt_ChannelType Channel) {
+    if (Gpt_Timebase.Timer == NULL_PTR || Channel >= Gpt_ConfigPtr->numChannels) {
+        return;
+    }
+    Gpt_Channels[Channel].NotifyEnabled = 0;
+}
+
+uint32_t Gpt_GetTimeUs(void) {
+    return (uint32_t)Gpt_GetTimestamp();
+}
+
+void Gpt_IrqHandler(void) {
+    if (Gpt_Timebase.Timer == NULL_PTR) {
+        return;
+    }
+    TRACE_ISR_ENTER();
+    // Count and clear together, so Gpt_GetTimestamp from a higher priority never sees neither
+    uint32_t primask = Compiler_EnterCritical();
+    uint16_t sr = Gpt_Timebase.Timer->SR;
+    Gpt_Timebase.Timer->SR = (uint16_t)~(sr & (TIM_SR_UIF | TIM_SR_CC1IF));
+    if (sr & TIM_SR_UIF) {
+        Gpt_Timebase.Overflows++;
+    }
+    Compiler_ExitCritical(primask);
+
+    Gpt_Service();
+    TRACE_ISR_EXIT(TRACE_ISR_GPT);
+}
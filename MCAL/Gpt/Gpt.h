@@ -0,0 +1,211 @@
+/**
+ * @file    Gpt.h
+ * @brief   AUTOSAR GPT Driver Header File for STM32F103C8 (software timers on one hardware timer)
+ * @version 1.0
+ * @date    2025
+ *
+ * One general purpose timer (TIM2..TIM4, whichever PWM/ICU leave free) runs
+ * as a free-running 16-bit counter at 1 MHz. Its update interrupt counts
+ * overflows, which extends the counter to the system timebase: the 64-bit
+ * microsecond timestamp of Gpt_GetTimestamp (48 significant bits, 8.9
+ * years), monotonic across Gpt_Init calls (clock switches). Drivers stamp
+ * their events with it (CAN RX, ADC DMA completion, PWM edges), so bus
+ * traffic and sensor samples can be put on one time axis. Unlike the DWT
+ * cycle counter, the timer keeps counting while the core sleeps in WFI.
+ *
+ * Logical channels (one-shot or continuous, up to GPT_MAX_CHANNELS) are
+ * multiplexed on that timer. Running channels sit in a binary min-heap
+ * ordered by absolute deadline; compare channel 1 is programmed to the
+ * earliest one. Start/stop cost O(log n), an expiry O(log n), and nothing
+ * runs between expiries except one update interrupt per 65.5 ms, so the
+ * CPU load does not grow with the number of armed timeouts.
+ *
+ * Notifications run in the timer interrupt, like the PWM/ICU ones. They may
+ * start or stop any channel, including their own.
+ */
+
+#ifndef GPT_H
+#define GPT_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+
+#define GPT_VENDOR_ID         1234
+#define GPT_MODULE_ID         100
+#define GPT_SW_MAJOR_VERSION  1
+#define GPT_SW_MINOR_VERSION  0
+#define GPT_SW_PATCH_VERSION  0
+
+/**
+ * Logical channels; heap positions are 8-bit with 0xFF as "not queued".
+ * Each one costs 13 bytes of RAM whether configured or not, so the default
+ * only covers the demos; build with -DGPT_MAX_CHANNELS=n (up to 255) for more.
+ */
+#ifndef GPT_MAX_CHANNELS
+#define GPT_MAX_CHANNELS      8U
+#endif
+
+#if GPT_MAX_CHANNELS > 255U
+#error "GPT_MAX_CHANNELS must not exceed 255"
+#endif
+
+/** Longest timeout in us: deadlines are compared modulo 2^32 */
+#define GPT_MAX_VALUE_US      0x7FFFFFFFUL
+
+/** Logical identifier of a GPT channel (index into Gpt_ConfigType.Channels) */
+typedef uint8_t Gpt_ChannelType;
+
+/** Time in microseconds */
+typedef uint32_t Gpt_ValueType;
+
+/** Timebase timestamp: microseconds since the first Gpt_Init, 0 = timebase not running */
+typedef uint64_t Gpt_TimestampType;
+
+/** Timebase state read by the inline Gpt_GetTimestamp; written by the driver only */
+typedef struct {
+    TIM_TypeDef* Timer;             /**< NULL_PTR while the driver is not initialized */
+    volatile uint32_t Overflows;    /**< Counter wraps, bits 16..47 of the timestamp */
+} Gpt_TimebaseType;
+
+extern Gpt_TimebaseType Gpt_Timebase;
+
+/** Hardware timer carrying the driver */
+typedef enum {
+    GPT_HW_TIM2 = 0x00,
+    GPT_HW_TIM3 = 0x01,
+    GPT_HW_TIM4 = 0x02
+} Gpt_HwTimerType;
+
+/** Behaviour of a channel at expiry */
+typedef enum {
+    GPT_CH_MODE_ONESHOT = 0x00,         /**< Stops at expiry (state GPT_CH_EXPIRED) */
+    GPT_CH_MODE_CONTINUOUS = 0x01       /**< Restarts with the same value, without drift */
+} Gpt_ChannelModeType;
+
+/** State of a channel */
+typedef enum {
+    GPT_CH_INITIALIZED = 0x00,          /**< Never started */
+    GPT_CH_RUNNING = 0x01,
+    GPT_CH_STOPPED = 0x02,              /**< Stopped by Gpt_StopTimer */
+    GPT_CH_EXPIRED = 0x03               /**< One-shot channel reached its target */
+} Gpt_ChannelStateType;
+
+/** Notification of a channel, called from the timer interrupt */
+typedef void (*Gpt_NotificationType)(void);
+
+/**
+ * @brief Configuration structure for a GPT channel
+ */
+typedef struct {
+    Gpt_ChannelModeType Mode;                   /**< One-shot or continuous */
+    Gpt_NotificationType Notification;          /**< Called at expiry (NULL_PTR: none) */
+} Gpt_ChannelConfigType;
+
+/**
+ * @brief Configuration structure for the GPT driver
+ */
+typedef struct {
+    Gpt_HwTimerType HwTimer;                    /**< Timer not used by PWM/ICU */
+    uint8_t IrqPriority;                        /**< NVIC priority of the timer interrupt */
+    const Gpt_ChannelConfigType* Channels;      /**< NULL_PTR with numChannels 0: timebase only */
+    uint8_t numChannels;
+} Gpt_ConfigType;
+
+/**
+ * @brief Starts the hardware timer at 1 MHz and resets all channels.
+ * @details The prescaler follows Mcu_GetClockFreq: call again after Mcu_InitClock.
+ *          Channels running at that point are stopped; the timebase continues
+ *          from its current value.
+ */
+void Gpt_Init(const Gpt_ConfigType* ConfigPtr);
+
+/**
+ * @brief Stops all channels and the hardware timer.
+ */
+void Gpt_DeInit(void);
+
+/**
+ * @brief Starts (or restarts) a channel.
+ * @param Channel Channel to start.
+ * @param Value Time to expiry in us, 1..GPT_MAX_VALUE_US; also the period of a continuous channel.
+ */
+void Gpt_StartTimer(Gpt_ChannelType Channel, Gpt_ValueType Value);
+
+/**
+ * @brief Stops a channel; its notification is not called any more.
+ */
+void Gpt_StopTimer(Gpt_ChannelType Channel);
+
+/**
+ * @brief Time since the channel was (re)started or last expired, in us.
+ * @details Frozen at the value reached when stopped; the target value once a
+ *          one-shot channel has expired; 0 before the first start.
+ */
+Gpt_ValueType Gpt_GetTimeElapsed(Gpt_ChannelType Channel);
+
+/**
+ * @brief Time until the next expiry of the channel, in us.
+ * @details Frozen when stopped; 0 once a one-shot channel has expired or before the first start.
+ */
+Gpt_ValueType Gpt_GetTimeRemaining(Gpt_ChannelType Channel);
+
+/**
+ * @brief Returns the state of a channel.
+ */
+Gpt_ChannelStateType Gpt_GetChannelState(Gpt_ChannelType Channel);
+
+/**
+ * @brief Enables the notification of a channel (default after Gpt_Init).
+ */
+void Gpt_EnableNotification(Gpt_ChannelType Channel);
+
+/**
+ * @brief Disables the notification of a channel; the channel keeps running.
+ */
+void Gpt_DisableNotification(Gpt_ChannelType Channel);
+
+/**
+ * @brief Free-running microsecond time: the low 32 bits of Gpt_GetTimestamp.
+ * @details Wraps after 71.6 minutes; differences modulo 2^32 stay valid across
+ *          the wrap. Safe from any context.
+ */
+uint32_t Gpt_GetTimeUs(void);
+
+/**
+ * @brief Reads the 64-bit timebase, lock-free, from any context.
+ * @details Overflow count, counter and pending update flag are read in a
+ *          retry loop instead of masking interrupts: the loop repeats only if
+ *          the timer interrupt counted a wrap in between. A wrap that is
+ *          pending but not counted yet (caller runs above the timer interrupt
+ *          priority) is added when the counter reads low. Callers must not
+ *          block the timer interrupt for more than 32 ms.
+ *          Inline so ISRs (also those in RAM) pay no call: two RAM and two
+ *          APB1 loads plus about ten instructions.
+ */
+static __INLINE Gpt_TimestampType Gpt_GetTimestamp(void) {
+    TIM_TypeDef* tim = Gpt_Timebase.Timer;
+    if (tim == NULL_PTR) {
+        return 0;
+    }
+    uint32_t overflows;
+    uint32_t count;
+    uint32_t sr;
+    do {
+        overflows = Gpt_Timebase.Overflows;
+        count = tim->CNT;
+        sr = tim->SR;
+    } while (overflows != Gpt_Timebase.Overflows);
+    uint64_t ts = ((uint64_t)overflows << 16) | count;
+    if ((sr & TIM_SR_UIF) && count < 0x8000U) {
+        ts += 0x10000U;
+    }
+    return ts;
+}
+
+/**
+ * @brief Timer interrupt: counts overflows and expires due channels.
+ * @details Called from the TIMx_IRQHandler of Gpt_ConfigType.HwTimer.
+ */
+void Gpt_IrqHandler(void);
+
+#endif /* GPT_H */
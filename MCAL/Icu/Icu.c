@@ -0,0 +1,493 @@
+/*
+ * Icu.c
+ * AUTOSAR ICU Driver implementation for STM32F103C8
+ */
+
+#include "Icu.h"
+#include "Mcu.h"
+#include "stm32f10x.h"
+#include <stddef.h>
+
+/**
+ * @brief DMA1 channel number (1..7) serving the CC1/CC2 request of each timer.
+ * @details Indexed by Timer * 2 + Slot (RM0008 DMA1 request mapping). 0 = no DMA request.
+ */
+static const Dma_ChannelType Icu_DmaChannelMap[4 * 2] = {
+    2, 3,   /* TIM1_CH1, TIM1_CH2 */
+    5, 7,   /* TIM2_CH1, TIM2_CH2 */
+    6, 0,   /* TIM3_CH1, TIM3_CH2 (no DMA request) */
+    1, 4    /* TIM4_CH1, TIM4_CH2 */
+};
+
+/** Runtime state of an ICU channel */
+typedef struct {
+    Icu_ValueType* BufferPtr;       /**< Timestamp buffer */
+    uint16_t BufferSize;            /**< Number of entries of BufferPtr */
+    Icu_IndexType LastIndex;        /**< Index seen by the last Icu_GetInputState */
+    boolean SignalLost;             /**< Overflow seen, no period capture since (signal measurement) */
+} Icu_ChannelStateType;
+
+static const Icu_ConfigType* Icu_CurrentConfigPtr = NULL_PTR;
+static Icu_ChannelStateType Icu_ChannelState[ICU_MAX_CHANNELS];
+
+/**
+ * @brief Returns the TIM peripheral associated with a given hardware channel.
+ * @param hwCh The hardware channel number (0-15).
+ * @return Pointer to the TIM peripheral.
+ */
+static TIM_TypeDef* Icu_GetTimer(uint8 hwCh) {
+    switch (hwCh / 4) {
+        case 0: return TIM1;
+        case 1: return TIM2;
+        case 2: return TIM3;
+        case 3: return TIM4;
+        default: return NULL_PTR;
+    }
+}
+
+/**
+ * @brief Prescaler for a counter tick of TickUs microseconds at the current clock setting.
+ * @param tim Timer of the channel; TIM1 is clocked from APB2, TIM2..4 from APB1.
+ * @param TickUs Tick length; clamped to what the 16-bit prescaler reaches.
+ */
+static uint16_t Icu_TickPrescaler(const TIM_TypeDef* tim, uint16_t TickUs) {
+    uint32_t timClk = Mcu_GetClockFreq((tim == TIM1) ? MCU_CLK_TIMCLK2 : MCU_CLK_TIMCLK1);
+    uint32_t div = (timClk / 1000000UL) * (TickUs ? TickUs : 1U);
+    return (uint16_t)((div > 0x10000UL) ? 0xFFFFU : div - 1U);
+}
+
+/**
+ * @brief Takes or drops one timer clock reference per usable channel (same filter as Icu_Init).
+ * @param ConfigPtr Configuration whose channels are counted.
+ * @param Enable TRUE: Mcu_EnablePeripheral, FALSE: Mcu_DisablePeripheral.
+ */
+static void Icu_ClockRefs(const Icu_ConfigType* ConfigPtr, boolean Enable) {
+    for (uint8 i = 0; i < ConfigPtr->numChannels; i++) {
+        uint8 hwCh = ConfigPtr->Channels[i].HwChannel;
+        if (Icu_GetTimer(hwCh) == NULL_PTR || (hwCh % 4) > 1) continue;
+        Mcu_PeripheralType periph = (Mcu_PeripheralType)(MCU_PERIPH_TIM1 + hwCh / 4);
+        (void)(Enable ? Mcu_EnablePeripheral(periph) : Mcu_DisablePeripheral(periph));
+    }
+}
+
+/**
+ * @brief Returns the capture register of CH1 (slot 0) or CH2 (slot 1).
+ */
+static volatile uint16_t* Icu_GetCcr(TIM_TypeDef* tim, uint8 slot) {
+    return (slot == 0) ? &tim->CCR1 : &tim->CCR2;
+}
+
+/**
+ * @brief Returns the configuration of a channel, NULL_PTR if the channel is invalid.
+ */
+static const Icu_ChannelConfigType* Icu_GetChannelConfig(Icu_ChannelType Channel) {
+    if (Icu_CurrentConfigPtr == NULL_PTR || Channel >= Icu_CurrentConfigPtr->numChannels) {
+        return NULL_PTR;
+    }
+    return &Icu_CurrentConfigPtr->Channels[Channel];
+}
+
+/**
+ * @brief Returns the DMA channel (1..7) serving the capture request of a hardware channel, 0 if none.
+ */
+static Dma_ChannelType Icu_GetDmaChannel(uint8 hwCh) {
+    if (hwCh >= 16 || (hwCh % 4) > 1) {
+        return 0;
+    }
+    return Icu_DmaChannelMap[(hwCh / 4) * 2 + (hwCh % 4)];
+}
+
+/**
+ * @brief Period capture flag (direct channel) of a signal measurement channel.
+ */
+static uint16_t Icu_GetPeriodFlag(uint8 slot) {
+    return (slot == 0) ? TIM_FLAG_CC1 : TIM_FLAG_CC2;
+}
+
+/**
+ * @brief Updates the signal-lost state of a signal measurement channel from the timer flags.
+ * @details An overflow (UIF) without a reset edge marks the signal as lost. The state is
+ *          kept per channel and UIF stays set, so every read API sees it; only a period
+ *          capture taken after the loss was recorded clears both again. A capture flagged
+ *          together with the first UIF may predate the overflow and is dropped.
+ * @return TRUE if a new period was captured since the last call.
+ */
+static boolean Icu_UpdateSignalState(Icu_ChannelType Channel, TIM_TypeDef* tim, uint8 slot) {
+    Icu_ChannelStateType* st = &Icu_ChannelState[Channel];
+    uint16_t ccFlag = Icu_GetPeriodFlag(slot);
+    uint16_t sr = tim->SR;
+
+    if ((sr & TIM_FLAG_Update) == 0) {
+        if ((sr & ccFlag) == 0) {
+            return FALSE;
+        }
+        st->SignalLost = FALSE;
+        return TRUE;
+    }
+    if (st->SignalLost && (sr & ccFlag)) {
+        // First start edge after the loss: the signal is back
+        tim->SR = (uint16_t)~TIM_FLAG_Update;
+        st->SignalLost = FALSE;
+        return TRUE;
+    }
+    if (!st->SignalLost) {
+        tim->SR = (uint16_t)~ccFlag;
+        st->SignalLost = TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Reads a coherent active time / period pair of a signal measurement channel.
+ */
+static void Icu_ReadCaptures(TIM_TypeDef* tim, uint8 slot, uint16_t* active, uint16_t* period) {
+    volatile uint16_t* periodReg = Icu_GetCcr(tim, slot);
+    volatile uint16_t* activeReg = Icu_GetCcr(tim, slot ^ 1);
+
+    // Re-read if a capture landed between the two register reads
+    do {
+        *active = *activeReg;
+        *period = *periodReg;
+    } while (*active != *activeReg);
+}
+
+/**
+ * @brief DMA notification of the timestamp channels: half/full buffer.
+ * @param Channel DMA channel, identifies the ICU channel that requested it.
+ * @param Events DMA_EVENT_HT and/or DMA_EVENT_TC.
+ */
+static void Icu_DmaNotification(Dma_ChannelType Channel, Dma_EventType Events) {
+    (void)Events;
+    if (Icu_CurrentConfigPtr == NULL_PTR) {
+        return;
+    }
+    for (uint8 i = 0; i < Icu_CurrentConfigPtr->numChannels; i++) {
+        const Icu_ChannelConfigType* cfg = &Icu_CurrentConfigPtr->Channels[i];
+        if (cfg->MeasurementMode == ICU_MODE_TIMESTAMP && Icu_GetDmaChannel(cfg->HwChannel) == Channel) {
+            if (cfg->TimestampNotification) {
+                cfg->TimestampNotification();
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Initializes the ICU driver with the given configuration.
+ * @param ConfigPtr Pointer to the configuration structure.
+ */
+void Icu_Init(const Icu_ConfigType* ConfigPtr) {
+    if (!ConfigPtr || !ConfigPtr->Channels || ConfigPtr->numChannels > ICU_MAX_CHANNELS) return;
+    // Timer clocks of the new configuration first, then those of a previous Icu_Init are dropped
+    Icu_ClockRefs(ConfigPtr, TRUE);
+    if (Icu_CurrentConfigPtr != NULL_PTR) {
+        Icu_ClockRefs(Icu_CurrentConfigPtr, FALSE);
+    }
+    Icu_CurrentConfigPtr = ConfigPtr;
+
+    for (uint8 i = 0; i < ConfigPtr->numChannels; i++) {
+        const Icu_ChannelConfigType* cfg = &ConfigPtr->Channels[i];
+        TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+        uint8 slot = cfg->HwChannel % 4;
+        if (!tim || slot > 1) continue; // Only TI1/TI2 can drive the slave reset
+
+        Icu_ChannelState[i].BufferPtr = NULL_PTR;
+        Icu_ChannelState[i].BufferSize = 0;
+        Icu_ChannelState[i].LastIndex = 0;
+        Icu_ChannelState[i].SignalLost = FALSE;
+        if (cfg->MeasurementMode == ICU_MODE_TIMESTAMP) {
+            Dma_ReserveChannel(Icu_GetDmaChannel(cfg->HwChannel)); // Keep DMA_CHANNEL_ANY requests off it
+        }
+
+        // 1) Timer clock is already referenced (Icu_ClockRefs)
+
+        // 2) Free-running 16-bit time-base
+        TIM_TimeBaseInitTypeDef tb = {0};
+        tb.TIM_Prescaler     = Icu_TickPrescaler(tim, cfg->TickUs);
+        tb.TIM_CounterMode   = TIM_CounterMode_Up;
+        tb.TIM_Period        = 0xFFFF;
+        tb.TIM_ClockDivision = TIM_CKD_DIV1;
+        TIM_TimeBaseInit(tim, &tb);
+
+        // 3) Input capture on the configured start edge
+        TIM_ICInitTypeDef ic;
+        TIM_ICStructInit(&ic);
+        ic.TIM_Channel     = (slot == 0) ? TIM_Channel_1 : TIM_Channel_2;
+        ic.TIM_ICPolarity  = (cfg->DefaultStartEdge == ICU_RISING_EDGE)
+                              ? TIM_ICPolarity_Rising
+                              : TIM_ICPolarity_Falling;
+        ic.TIM_ICSelection = TIM_ICSelection_DirectTI;
+        ic.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+        ic.TIM_ICFilter    = cfg->Filter;
+
+        if (cfg->MeasurementMode == ICU_MODE_SIGNAL_MEASUREMENT) {
+            // PWM-input: direct CCR = period, indirect CCR = active time.
+            // The start edge resets the counter, so no ISR computes differences.
+            TIM_PWMIConfig(tim, &ic);
+            TIM_SelectInputTrigger(tim, (slot == 0) ? TIM_TS_TI1FP1 : TIM_TS_TI2FP2);
+            TIM_SelectSlaveMode(tim, TIM_SlaveMode_Reset);
+            TIM_SelectMasterSlaveMode(tim, TIM_MasterSlaveMode_Enable);
+            // Only a counter overflow sets UIF: signals "no edge within 16 bits"
+            TIM_UpdateRequestConfig(tim, TIM_UpdateSource_Regular);
+        } else {
+            TIM_ICInit(tim, &ic);
+        }
+        TIM_ClearFlag(tim, 0xFFFF);
+    }
+}
+
+/**
+ * @brief De-initializes the ICU driver.
+ */
+void Icu_DeInit(void) {
+    if (Icu_CurrentConfigPtr == NULL_PTR) {
+        return; // No configuration to de-initialize
+    }
+
+    for (uint8 i = 0; i < Icu_CurrentConfigPtr->numChannels; i++) {
+        const Icu_ChannelConfigType* cfg = &Icu_CurrentConfigPtr->Channels[i];
+        TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+        if (!tim) continue;
+        if (cfg->MeasurementMode == ICU_MODE_TIMESTAMP) {
+            Icu_StopTimestamp(i);
+        }
+        TIM_Cmd(tim, DISABLE);
+        TIM_SelectSlaveMode(tim, 0);
+        TIM_CCxCmd(tim, TIM_Channel_1, TIM_CCx_Disable);
+        TIM_CCxCmd(tim, TIM_Channel_2, TIM_CCx_Disable);
+    }
+
+    Icu_ClockRefs(Icu_CurrentConfigPtr, FALSE);
+    Icu_CurrentConfigPtr = NULL_PTR; // Clear the configuration pointer
+}
+
+/**
+ * @brief Starts the signal measurement of a channel.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ */
+void Icu_StartSignalMeasurement(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || cfg->MeasurementMode != ICU_MODE_SIGNAL_MEASUREMENT) {
+        return; // Invalid configuration or channel
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+
+    Icu_ChannelState[Channel].SignalLost = FALSE;
+    TIM_ClearFlag(tim, 0xFFFF);
+    TIM_Cmd(tim, ENABLE);
+}
+
+/**
+ * @brief Stops the signal measurement of a channel.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ */
+void Icu_StopSignalMeasurement(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || cfg->MeasurementMode != ICU_MODE_SIGNAL_MEASUREMENT) {
+        return; // Invalid configuration or channel
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+
+    TIM_Cmd(tim, DISABLE);
+}
+
+/**
+ * @brief Reads the configured elapsed time (high, low or period time).
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ * @return Time in timer ticks, 0 from a counter overflow without start edge until the next period capture.
+ */
+Icu_ValueType Icu_GetTimeElapsed(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || cfg->MeasurementMode != ICU_MODE_SIGNAL_MEASUREMENT) {
+        return 0; // Invalid configuration or channel
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    uint8 slot = cfg->HwChannel % 4;
+
+    (void)Icu_UpdateSignalState(Channel, tim, slot);
+    if (Icu_ChannelState[Channel].SignalLost) {
+        return 0; // Counter overflowed without a reset edge: the captured values are stale
+    }
+
+    uint16_t active, period;
+    Icu_ReadCaptures(tim, slot, &active, &period);
+    switch (cfg->Property) {
+        case ICU_PERIOD_TIME:
+            return period;
+        case ICU_HIGH_TIME:
+        case ICU_LOW_TIME:
+            // Active time runs from the start edge: high time for a rising start edge
+            if ((cfg->Property == ICU_HIGH_TIME) == (cfg->DefaultStartEdge == ICU_RISING_EDGE)) {
+                return active;
+            }
+            return (Icu_ValueType)(period - active);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Reads a coherent active time / period pair.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ * @param DutyCycleValues Output; both values are 0 while the signal is lost (as Icu_GetTimeElapsed).
+ */
+void Icu_GetDutyCycleValues(Icu_ChannelType Channel, Icu_DutyCycleType* DutyCycleValues) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || DutyCycleValues == NULL_PTR || cfg->MeasurementMode != ICU_MODE_SIGNAL_MEASUREMENT) {
+        return; // Invalid configuration, channel or pointer
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    uint8 slot = cfg->HwChannel % 4;
+
+    (void)Icu_UpdateSignalState(Channel, tim, slot);
+    if (Icu_ChannelState[Channel].SignalLost) {
+        DutyCycleValues->ActiveTime = 0;
+        DutyCycleValues->PeriodTime = 0;
+        return;
+    }
+
+    uint16_t active, period;
+    Icu_ReadCaptures(tim, slot, &active, &period);
+    DutyCycleValues->ActiveTime = active;
+    DutyCycleValues->PeriodTime = period;
+}
+
+/**
+ * @brief Starts capturing timestamps into a circular buffer.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ * @param BufferPtr Buffer that receives the captured timer values.
+ * @param BufferSize Number of entries of BufferPtr.
+ * @param NotifyInterval 0: no notification, otherwise notify on half/full buffer.
+ */
+void Icu_StartTimestamp(Icu_ChannelType Channel, Icu_ValueType* BufferPtr, uint16_t BufferSize, uint16_t NotifyInterval) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || BufferPtr == NULL_PTR || BufferSize == 0 || cfg->MeasurementMode != ICU_MODE_TIMESTAMP) {
+        return; // Invalid configuration, channel or buffer
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    Dma_ChannelType dma = Icu_GetDmaChannel(cfg->HwChannel);
+    uint8 slot = cfg->HwChannel % 4;
+    if (tim == NULL_PTR || dma == 0) {
+        return; // Channel has no DMA request
+    }
+
+    // 1) Circular DMA: CCRx -> BufferPtr on every capture; optional half/full
+    //    buffer notification (2 interrupts per buffer, not per edge)
+    Dma_ChannelConfigType dcfg = {
+        .Direction    = DMA_DIR_PERIPH_TO_MEM,
+        .Mode         = DMA_MODE_CIRCULAR,
+        .Priority     = DMA_PRIORITY_HIGH,
+        .PeriphWidth  = DMA_WIDTH_16,
+        .MemWidth     = DMA_WIDTH_16,
+        .PeriphInc    = 0,
+        .MemInc       = 1,
+        .Events       = (NotifyInterval != 0 && cfg->TimestampNotification != NULL_PTR)
+                        ? (Dma_EventType)(DMA_EVENT_HT | DMA_EVENT_TC) : 0U,
+        .Notification = Icu_DmaNotification
+    };
+    if (Icu_ChannelState[Channel].BufferSize != 0) {
+        Icu_StopTimestamp(Channel); // Restart: give our channel back first
+    }
+    if (Dma_RequestChannel(&dma, &dcfg) != E_OK) {
+        return; // DMA channel owned by another driver
+    }
+
+    Icu_ChannelState[Channel].BufferPtr = BufferPtr;
+    Icu_ChannelState[Channel].BufferSize = BufferSize;
+    Icu_ChannelState[Channel].LastIndex = 0;
+    Dma_Start(dma, (uint32_t)Icu_GetCcr(tim, slot), (uint32_t)BufferPtr, BufferSize);
+
+    // 2) Link the capture event to DMA and start
+    TIM_DMACmd(tim, (slot == 0) ? TIM_DMA_CC1 : TIM_DMA_CC2, ENABLE);
+    TIM_Cmd(tim, ENABLE);
+}
+
+/**
+ * @brief Stops capturing timestamps.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ */
+void Icu_StopTimestamp(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || cfg->MeasurementMode != ICU_MODE_TIMESTAMP) {
+        return; // Invalid configuration or channel
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+    Dma_ChannelType dma = Icu_GetDmaChannel(cfg->HwChannel);
+    if (tim == NULL_PTR || dma == 0 || Icu_ChannelState[Channel].BufferSize == 0) {
+        return; // Invalid channel or not started
+    }
+
+    TIM_DMACmd(tim, (cfg->HwChannel % 4 == 0) ? TIM_DMA_CC1 : TIM_DMA_CC2, DISABLE);
+    Dma_ReleaseChannel(dma);
+    Icu_ChannelState[Channel].BufferSize = 0;
+    TIM_Cmd(tim, DISABLE);
+}
+
+/**
+ * @brief Returns the index of the next timestamp to be written.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ */
+Icu_IndexType Icu_GetTimestampIndex(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR || cfg->MeasurementMode != ICU_MODE_TIMESTAMP) {
+        return 0; // Invalid configuration or channel
+    }
+    const Icu_ChannelStateType* st = &Icu_ChannelState[Channel];
+    if (st->BufferSize == 0) {
+        return 0; // Not started
+    }
+
+    // CNDTR counts down and reloads in circular mode
+    uint16_t remaining = Dma_GetRemaining(Icu_GetDmaChannel(cfg->HwChannel));
+    return (Icu_IndexType)((remaining == 0) ? 0 : (st->BufferSize - remaining));
+}
+
+/**
+ * @brief Returns whether a new capture happened since the last call.
+ * @param Channel ICU channel.
+ */
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel) {
+    const Icu_ChannelConfigType* cfg = Icu_GetChannelConfig(Channel);
+    if (cfg == NULL_PTR) {
+        return ICU_IDLE; // Invalid configuration or channel
+    }
+    TIM_TypeDef* tim = Icu_GetTimer(cfg->HwChannel);
+
+    if (cfg->MeasurementMode == ICU_MODE_TIMESTAMP) {
+        Icu_IndexType idx = Icu_GetTimestampIndex(Channel);
+        if (idx == Icu_ChannelState[Channel].LastIndex) {
+            return ICU_IDLE;
+        }
+        Icu_ChannelState[Channel].LastIndex = idx;
+        return ICU_ACTIVE;
+    }
+
+    // Period capture flag of the direct channel; cleared here, not by an ISR
+    uint8 slot = cfg->HwChannel % 4;
+    if (!Icu_UpdateSignalState(Channel, tim, slot)) {
+        return ICU_IDLE;
+    }
+    tim->SR = (uint16_t)~Icu_GetPeriodFlag(slot);
+    return ICU_ACTIVE;
+}
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Icu_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return; // Invalid pointer
+    }
+
+    versioninfo->vendorID = ICU_VENDOR_ID;
+    versioninfo->moduleID = ICU_MODULE_ID;
+    versioninfo->sw_major_version = ICU_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = ICU_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = ICU_SW_PATCH_VERSION;
+}
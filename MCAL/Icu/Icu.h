@@ -0,0 +1,163 @@
+/**
+ * @file    Icu.h
+ * @brief   AUTOSAR ICU Driver Header File for STM32F103C8
+ * @version 1.0
+ * @date    2025
+ *
+ * Input capture on TIM1..TIM4 CH1/CH2. Signal measurement uses the timer
+ * PWM-input mode (CCx direct + CCy indirect, slave reset on the start edge),
+ * so period and active time are latched by hardware. Timestamps are moved
+ * by DMA from CCRx into a circular user buffer (channel requested from the
+ * DMA driver by Icu_StartTimestamp). No code runs per edge;
+ * results are read from the timer/DMA registers on request.
+ */
+
+#ifndef ICU_H
+#define ICU_H
+
+#define ICU_MAX_CHANNELS 8 // Maximum number of ICU channels supported
+
+#include "Std_Types.h"
+#include "stm32f10x_tim.h"
+#include "stm32f10x_rcc.h"
+#include "Dma.h"
+#include "misc.h"
+
+#define ICU_VENDOR_ID         1234
+#define ICU_MODULE_ID         122
+#define ICU_SW_MAJOR_VERSION  1
+#define ICU_SW_MINOR_VERSION  0
+#define ICU_SW_PATCH_VERSION  0
+
+/** Logical identifier of an ICU channel (index into Icu_ConfigType.Channels) */
+typedef uint8 Icu_ChannelType;
+
+/** Timer ticks of a measured time or a timestamp (16-bit timer) */
+typedef uint16_t Icu_ValueType;
+
+/** Index into a timestamp buffer */
+typedef uint16_t Icu_IndexType;
+
+/** Input state of an ICU channel */
+typedef enum {
+    ICU_ACTIVE = 0x00,                  /**< A new edge/period was captured since the last call */
+    ICU_IDLE = 0x01                     /**< Nothing captured since the last call */
+} Icu_InputStateType;
+
+/** Edge used to start a measurement or to take a timestamp */
+typedef enum {
+    ICU_RISING_EDGE = 0x00,
+    ICU_FALLING_EDGE = 0x01
+} Icu_ActivationType;
+
+/** Measurement mode of an ICU channel */
+typedef enum {
+    ICU_MODE_SIGNAL_MEASUREMENT = 0x01, /**< Period/high/low time and duty cycle (PWM-input mode) */
+    ICU_MODE_TIMESTAMP = 0x02           /**< Capture timestamps into a buffer by DMA */
+} Icu_MeasurementModeType;
+
+/** Property measured in signal measurement mode */
+typedef enum {
+    ICU_LOW_TIME = 0x00,
+    ICU_HIGH_TIME = 0x01,
+    ICU_PERIOD_TIME = 0x02,
+    ICU_DUTY_CYCLE = 0x03
+} Icu_SignalMeasurementPropertyType;
+
+/** Active time and period of one signal period */
+typedef struct {
+    Icu_ValueType ActiveTime;           /**< High time (or low time for falling start edge) */
+    Icu_ValueType PeriodTime;           /**< Period between two start edges */
+} Icu_DutyCycleType;
+
+/**
+ * @brief Configuration structure for an ICU channel
+ */
+typedef struct {
+    uint8 HwChannel;                                /**< Timer input, numbered like PWM channels: Timer = /4, CH1/CH2 = %4 (0 or 1) */
+    Icu_MeasurementModeType MeasurementMode;        /**< Signal measurement or timestamp */
+    Icu_SignalMeasurementPropertyType Property;     /**< Measured property (signal measurement) */
+    Icu_ActivationType DefaultStartEdge;            /**< Start edge of a period / timestamp edge */
+    uint16_t TickUs;                                /**< Counter tick in us; the prescaler follows the timer clock */
+    uint8 Filter;                                   /**< Input filter (ICxF, 0x0..0xF) */
+    void (*TimestampNotification)(void);            /**< Called on half/full timestamp buffer (NULL: none) */
+} Icu_ChannelConfigType;
+
+/**
+ * @brief This is the type of data structure containing the initialization data for the ICU driver
+ */
+typedef struct {
+    const Icu_ChannelConfigType* Channels;  /**< Pointer to the array of channel configurations */
+    uint8 numChannels;                      /**< Number of ICU channels configured */
+} Icu_ConfigType;
+
+/**
+ * @brief Initializes the ICU driver with the given configuration.
+ * @param ConfigPtr Pointer to the configuration structure.
+ */
+void Icu_Init(const Icu_ConfigType* ConfigPtr);
+
+/**
+ * @brief De-initializes the ICU driver.
+ */
+void Icu_DeInit(void);
+
+/**
+ * @brief Starts the signal measurement of a channel.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ */
+void Icu_StartSignalMeasurement(Icu_ChannelType Channel);
+
+/**
+ * @brief Stops the signal measurement of a channel.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ */
+void Icu_StopSignalMeasurement(Icu_ChannelType Channel);
+
+/**
+ * @brief Reads the configured elapsed time (high, low or period time).
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ * @return Time in timer ticks, 0 from a counter overflow without start edge until the next period capture.
+ */
+Icu_ValueType Icu_GetTimeElapsed(Icu_ChannelType Channel);
+
+/**
+ * @brief Reads a coherent active time / period pair.
+ * @param Channel ICU channel in ICU_MODE_SIGNAL_MEASUREMENT.
+ * @param DutyCycleValues Output; both values are 0 while the signal is lost (as Icu_GetTimeElapsed).
+ */
+void Icu_GetDutyCycleValues(Icu_ChannelType Channel, Icu_DutyCycleType* DutyCycleValues);
+
+/**
+ * @brief Starts capturing timestamps into a circular buffer.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ * @param BufferPtr Buffer that receives the captured timer values.
+ * @param BufferSize Number of entries of BufferPtr.
+ * @param NotifyInterval 0: no notification, otherwise notify on half/full buffer.
+ */
+void Icu_StartTimestamp(Icu_ChannelType Channel, Icu_ValueType* BufferPtr, uint16_t BufferSize, uint16_t NotifyInterval);
+
+/**
+ * @brief Stops capturing timestamps.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ */
+void Icu_StopTimestamp(Icu_ChannelType Channel);
+
+/**
+ * @brief Returns the index of the next timestamp to be written.
+ * @param Channel ICU channel in ICU_MODE_TIMESTAMP.
+ */
+Icu_IndexType Icu_GetTimestampIndex(Icu_ChannelType Channel);
+
+/**
+ * @brief Returns whether a new capture happened since the last call.
+ * @param Channel ICU channel.
+ */
+Icu_InputStateType Icu_GetInputState(Icu_ChannelType Channel);
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Icu_GetVersionInfo(Std_VersionInfoType* versioninfo);
+
+#endif /* ICU_H */
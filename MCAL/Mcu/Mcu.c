@@ -0,0 +1,257 @@
+/*
+ * Mcu.c
+ * MCU Driver implementation for STM32F103C8
+ */
+
+#include "Mcu.h"
+#include "stm32f10x_rcc.h"
+
+/* CFGR fields owned by a clock setting (SW/SWS and MCO are handled separately) */
+#define MCU_CFGR_MASK       (RCC_CFGR_PLLMULL | RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_HPRE | \
+                             RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2 | RCC_CFGR_ADCPRE | RCC_CFGR_USBPRE)
+/* Part that can be changed in place, without leaving the PLL */
+#define MCU_CFGR_LIVE_MASK  (RCC_CFGR_ADCPRE | RCC_CFGR_USBPRE)
+
+/* Polling limit for HSE start-up and PLL lock, as in system_stm32f10x.c */
+#define MCU_READY_TIMEOUT   HSE_STARTUP_TIMEOUT
+
+/** One entry of the clock setting table */
+typedef struct {
+    uint32_t Cfgr;          /* PLL source/multiplier, AHB/APB/ADC/USB prescalers */
+    uint8_t Latency;        /* Flash wait states */
+    uint8_t UsePll;         /* SYSCLK from PLL (HSE based) or from HSI */
+} Mcu_ClockSettingType;
+
+/* Indexed by Mcu_ClockType; ADCCLK stays at 12 MHz (4 MHz on HSI), below the 14 MHz limit */
+static const Mcu_ClockSettingType Mcu_ClockSettings[MCU_NUM_CLOCKS] = {
+    [MCU_CLOCK_72MHZ] = { RCC_CFGR_PLLSRC_HSE | RCC_CFGR_PLLMULL9 | RCC_CFGR_HPRE_DIV1 | RCC_CFGR_PPRE1_DIV2 |
+                          RCC_CFGR_PPRE2_DIV1 | RCC_CFGR_ADCPRE_DIV6, FLASH_ACR_LATENCY_2, 1 },
+    [MCU_CLOCK_48MHZ] = { RCC_CFGR_PLLSRC_HSE | RCC_CFGR_PLLMULL6 | RCC_CFGR_HPRE_DIV1 | RCC_CFGR_PPRE1_DIV2 |
+                          RCC_CFGR_PPRE2_DIV1 | RCC_CFGR_ADCPRE_DIV4 | RCC_CFGR_USBPRE, FLASH_ACR_LATENCY_1, 1 },
+    [MCU_CLOCK_24MHZ] = { RCC_CFGR_PLLSRC_HSE | RCC_CFGR_PLLMULL3 | RCC_CFGR_HPRE_DIV1 | RCC_CFGR_PPRE1_DIV1 |
+                          RCC_CFGR_PPRE2_DIV1 | RCC_CFGR_ADCPRE_DIV2, FLASH_ACR_LATENCY_0, 1 },
+    [MCU_CLOCK_8MHZ]  = { RCC_CFGR_HPRE_DIV1 | RCC_CFGR_PPRE1_DIV1 | RCC_CFGR_PPRE2_DIV1 |
+                          RCC_CFGR_ADCPRE_DIV2, FLASH_ACR_LATENCY_0, 0 },
+};
+
+/** Enable register and bit of each gated peripheral */
+typedef struct {
+    volatile uint32_t* Enr;
+    uint32_t Mask;
+} Mcu_PeriphClockType;
+
+static const Mcu_PeriphClockType Mcu_PeriphClocks[MCU_NUM_PERIPHS] = {
+    [MCU_PERIPH_DMA1]   = { &RCC->AHBENR,  RCC_AHBPeriph_DMA1 },
+    [MCU_PERIPH_GPIOA]  = { &RCC->APB2ENR, RCC_APB2Periph_GPIOA },
+    [MCU_PERIPH_GPIOB]  = { &RCC->APB2ENR, RCC_APB2Periph_GPIOB },
+    [MCU_PERIPH_GPIOC]  = { &RCC->APB2ENR, RCC_APB2Periph_GPIOC },
+    [MCU_PERIPH_GPIOD]  = { &RCC->APB2ENR, RCC_APB2Periph_GPIOD },
+    [MCU_PERIPH_GPIOE]  = { &RCC->APB2ENR, RCC_APB2Periph_GPIOE },
+    [MCU_PERIPH_AFIO]   = { &RCC->APB2ENR, RCC_APB2Periph_AFIO },
+    [MCU_PERIPH_ADC1]   = { &RCC->APB2ENR, RCC_APB2Periph_ADC1 },
+    [MCU_PERIPH_ADC2]   = { &RCC->APB2ENR, RCC_APB2Periph_ADC2 },
+    [MCU_PERIPH_TIM1]   = { &RCC->APB2ENR, RCC_APB2Periph_TIM1 },
+    [MCU_PERIPH_TIM2]   = { &RCC->APB1ENR, RCC_APB1Periph_TIM2 },
+    [MCU_PERIPH_TIM3]   = { &RCC->APB1ENR, RCC_APB1Periph_TIM3 },
+    [MCU_PERIPH_TIM4]   = { &RCC->APB1ENR, RCC_APB1Periph_TIM4 },
+    [MCU_PERIPH_USART1] = { &RCC->APB2ENR, RCC_APB2Periph_USART1 },
+    [MCU_PERIPH_USART2] = { &RCC->APB1ENR, RCC_APB1Periph_USART2 },
+    [MCU_PERIPH_USART3] = { &RCC->APB1ENR, RCC_APB1Periph_USART3 },
+    [MCU_PERIPH_SPI1]   = { &RCC->APB2ENR, RCC_APB2Periph_SPI1 },
+    [MCU_PERIPH_SPI2]   = { &RCC->APB1ENR, RCC_APB1Periph_SPI2 },
+    [MCU_PERIPH_I2C1]   = { &RCC->APB1ENR, RCC_APB1Periph_I2C1 },
+    [MCU_PERIPH_I2C2]   = { &RCC->APB1ENR, RCC_APB1Periph_I2C2 },
+    [MCU_PERIPH_CAN1]   = { &RCC->APB1ENR, RCC_APB1Periph_CAN1 },
+    [MCU_PERIPH_PWR]    = { &RCC->APB1ENR, RCC_APB1Periph_PWR },
+    [MCU_PERIPH_BKP]    = { &RCC->APB1ENR, RCC_APB1Periph_BKP },
+};
+
+/* Users per peripheral clock; zero-initialized, so drivers may gate clocks before Mcu_Init */
+static uint8_t Mcu_RefCount[MCU_NUM_PERIPHS];
+
+static const Mcu_ConfigType* Mcu_ConfigPtr = NULL_PTR;
+
+/* Setting the core runs at after the last Mcu_InitClock call; SystemInit (Reset_Handler) starts at 72 MHz */
+static Mcu_ClockType Mcu_ClockSetting = MCU_CLOCK_72MHZ;
+
+/* HPRE -> right shift of SYSCLK (/1 .. /512; /32 does not exist) */
+static const uint8_t Mcu_AhbShift[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9 };
+/* PPREx -> right shift of HCLK */
+static const uint8_t Mcu_ApbShift[8] = { 0, 0, 0, 0, 1, 2, 3, 4 };
+
+/**
+ * @brief Polls until (reg & Mask) == Value; returns FALSE on timeout.
+ */
+static boolean Mcu_WaitFor(volatile uint32_t* Reg, uint32_t Mask, uint32_t Value) {
+    uint32_t timeout = MCU_READY_TIMEOUT;
+    while ((*Reg & Mask) != Value) {
+        if (--timeout == 0U) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/**
+ * @brief Falls back to the HSI setting after a failed HSE/PLL start.
+ * @details Records MCU_CLOCK_8MHZ, so a wakeup from STOP restores HSI instead of
+ *          retrying the crystal that just failed.
+ */
+static Std_ReturnType Mcu_FallBackToHsi(void) {
+    RCC->CR &= ~(RCC_CR_PLLON | RCC_CR_HSEON);
+    RCC->CFGR = (RCC->CFGR & ~MCU_CFGR_MASK) | Mcu_ClockSettings[MCU_CLOCK_8MHZ].Cfgr;
+    SystemCoreClockUpdate();
+    Mcu_ClockSetting = MCU_CLOCK_8MHZ;
+    return E_NOT_OK;
+}
+
+void Mcu_Init(const Mcu_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR) return;
+    Mcu_ConfigPtr = ConfigPtr;
+
+    if (ConfigPtr->GateUnusedClocks) {
+        uint32_t primask = Compiler_EnterCritical();
+        for (uint8_t p = 0; p < MCU_NUM_PERIPHS; p++) {
+            if (Mcu_RefCount[p] == 0U) {
+                *Mcu_PeriphClocks[p].Enr &= ~Mcu_PeriphClocks[p].Mask;
+            }
+        }
+        Compiler_ExitCritical(primask);
+    }
+}
+
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting) {
+    if (ClockSetting >= MCU_NUM_CLOCKS) {
+        return E_NOT_OK;
+    }
+    const Mcu_ClockSettingType* s = &Mcu_ClockSettings[ClockSetting];
+    uint32_t sws = s->UsePll ? RCC_CFGR_SWS_PLL : RCC_CFGR_SWS_HSI;
+    uint32_t cfgr = RCC->CFGR;
+
+    // Already running this setting (e.g. SystemInit set up 72 MHz): only fix the ADC/USB prescalers
+    if ((cfgr & RCC_CFGR_SWS) == sws &&
+        ((cfgr ^ s->Cfgr) & (MCU_CFGR_MASK & ~MCU_CFGR_LIVE_MASK)) == 0U &&
+        (FLASH->ACR & FLASH_ACR_LATENCY) == s->Latency) {
+        RCC->CFGR = (cfgr & ~MCU_CFGR_LIVE_MASK) | (s->Cfgr & MCU_CFGR_LIVE_MASK);
+        SystemCoreClockUpdate();
+        Mcu_ClockSetting = ClockSetting;
+        return E_OK;
+    }
+
+    // 1) Run from HSI while the PLL and the prescalers change
+    RCC->CR |= RCC_CR_HSION;
+    (void)Mcu_WaitFor(&RCC->CR, RCC_CR_HSIRDY, RCC_CR_HSIRDY);
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_HSI;
+    (void)Mcu_WaitFor(&RCC->CFGR, RCC_CFGR_SWS, RCC_CFGR_SWS_HSI);
+    RCC->CR &= ~RCC_CR_PLLON;
+    (void)Mcu_WaitFor(&RCC->CR, RCC_CR_PLLRDY, 0U);
+
+    // 2) Wait states of the target (any value is safe at 8 MHz), prescalers, PLL factors
+    FLASH->ACR = FLASH_ACR_PRFTBE | s->Latency;
+    RCC->CFGR = (RCC->CFGR & ~MCU_CFGR_MASK) | s->Cfgr;
+
+    if (!s->UsePll) {
+        RCC->CR &= ~RCC_CR_HSEON;   // Nothing else needs the crystal
+        SystemCoreClockUpdate();
+        Mcu_ClockSetting = ClockSetting;
+        return E_OK;
+    }
+
+    // 3) HSE, PLL lock, switch
+    RCC->CR |= RCC_CR_HSEON;
+    if (!Mcu_WaitFor(&RCC->CR, RCC_CR_HSERDY, RCC_CR_HSERDY)) {
+        return Mcu_FallBackToHsi();
+    }
+    RCC->CR |= RCC_CR_PLLON;
+    if (!Mcu_WaitFor(&RCC->CR, RCC_CR_PLLRDY, RCC_CR_PLLRDY)) {
+        return Mcu_FallBackToHsi();
+    }
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_PLL;
+    (void)Mcu_WaitFor(&RCC->CFGR, RCC_CFGR_SWS, RCC_CFGR_SWS_PLL);
+
+    SystemCoreClockUpdate();
+    Mcu_ClockSetting = ClockSetting;
+    return E_OK;
+}
+
+Mcu_ClockType Mcu_GetClockSetting(void) {
+    return Mcu_ClockSetting;
+}
+
+Mcu_PllStatusType Mcu_GetPllStatus(void) {
+    if (!(RCC->CR & RCC_CR_PLLON)) {
+        return MCU_PLL_STATUS_UNDEFINED;
+    }
+    return (RCC->CR & RCC_CR_PLLRDY) ? MCU_PLL_LOCKED : MCU_PLL_UNLOCKED;
+}
+
+uint32_t Mcu_GetClockFreq(Mcu_ClockDomainType Domain) {
+    uint32_t cfgr = RCC->CFGR;
+    uint32_t sysclk;
+
+    switch (cfgr & RCC_CFGR_SWS) {
+        case RCC_CFGR_SWS_HSE:
+            sysclk = HSE_VALUE;
+            break;
+        case RCC_CFGR_SWS_PLL: {
+            uint32_t mul = ((cfgr & RCC_CFGR_PLLMULL) >> 18) + 2U;
+            if (mul > 16U) mul = 16U;
+            uint32_t in = (cfgr & RCC_CFGR_PLLSRC) ? ((cfgr & RCC_CFGR_PLLXTPRE) ? HSE_VALUE / 2U : HSE_VALUE)
+                                                   : HSI_VALUE / 2U;
+            sysclk = in * mul;
+            break;
+        }
+        default:
+            sysclk = HSI_VALUE;
+            break;
+    }
+
+    uint32_t hclk = sysclk >> Mcu_AhbShift[(cfgr & RCC_CFGR_HPRE) >> 4];
+    uint8_t apb1 = Mcu_ApbShift[(cfgr & RCC_CFGR_PPRE1) >> 8];
+    uint8_t apb2 = Mcu_ApbShift[(cfgr & RCC_CFGR_PPRE2) >> 11];
+
+    switch (Domain) {
+        case MCU_CLK_SYSCLK:  return sysclk;
+        case MCU_CLK_HCLK:    return hclk;
+        case MCU_CLK_PCLK1:   return hclk >> apb1;
+        case MCU_CLK_PCLK2:   return hclk >> apb2;
+        case MCU_CLK_TIMCLK1: return (hclk >> apb1) << (apb1 ? 1U : 0U);
+        case MCU_CLK_TIMCLK2: return (hclk >> apb2) << (apb2 ? 1U : 0U);
+        case MCU_CLK_ADCCLK:  return (hclk >> apb2) / (2U * (((cfgr & RCC_CFGR_ADCPRE) >> 14) + 1U));
+        default:              return 0U;
+    }
+}
+
+Std_ReturnType Mcu_EnablePeripheral(Mcu_PeripheralType Periph) {
+    if (Periph >= MCU_NUM_PERIPHS) {
+        return E_NOT_OK;
+    }
+    Std_ReturnType ret = E_OK;
+    uint32_t primask = Compiler_EnterCritical();
+    if (Mcu_RefCount[Periph] == 0xFFU) {
+        ret = E_NOT_OK;
+    } else if (Mcu_RefCount[Periph]++ == 0U) {
+        *Mcu_PeriphClocks[Periph].Enr |= Mcu_PeriphClocks[Periph].Mask;
+    }
+    Compiler_ExitCritical(primask);
+    return ret;
+}
+
+Std_ReturnType Mcu_DisablePeripheral(Mcu_PeripheralType Periph) {
+    if (Periph >= MCU_NUM_PERIPHS) {
+        return E_NOT_OK;
+    }
+    Std_ReturnType ret = E_OK;
+    uint32_t primask = Compiler_EnterCritical();
+    if (Mcu_RefCount[Periph] == 0U) {
+        ret = E_NOT_OK;     // Unbalanced: the clock is left as it is
+    } else if (--Mcu_RefCount[Periph] == 0U) {
+        *Mcu_PeriphClocks[Periph].Enr &= ~Mcu_PeriphClocks[Periph].Mask;
+    }
+    Compiler_ExitCritical(primask);
+    return ret;
+}
+
+uint8_t Mcu_GetPeripheralRefCount(Mcu_PeripheralType Periph) {
+    return (Periph < MCU_NUM_PERIPHS) ? Mcu_RefCount[Periph] : 0U;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file    Mcu.h
+ * @brief   MCU Driver Header File for STM32F103C8 (clock tree, peripheral clocks)
+ * @version 1.0
+ * @date    2025
+ *
+ * Owns the clock tree at runtime: Mcu_InitClock switches between the clock
+ * settings below (8 MHz HSE crystal of the Blue Pill) and keeps flash wait
+ * states, bus and ADC prescalers consistent with the selected SYSCLK.
+ * Drivers derive their timing from Mcu_GetClockFreq instead of assuming
+ * 72 MHz, so they come up right at any setting.
+ *
+ * Peripheral clocks are reference counted: every driver enables the clock
+ * of each peripheral it uses with Mcu_EnablePeripheral and releases it with
+ * Mcu_DisablePeripheral; the RCC enable bit follows "count > 0". Timers
+ * shared by PWM and ICU, or GPIO ports used by several drivers, stay on
+ * until their last user is gone.
+ *
+ * Drivers program their prescalers/baud rates at init: after a clock switch
+ * the application re-initializes the timing-dependent drivers (Pwm, Icu,
+ * Gpt, Uart, Can, Sched).
+ */
+
+#ifndef MCU_H
+#define MCU_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+
+#define MCU_VENDOR_ID         1234
+#define MCU_MODULE_ID         101
+#define MCU_SW_MAJOR_VERSION  1
+#define MCU_SW_MINOR_VERSION  0
+#define MCU_SW_PATCH_VERSION  0
+
+/** Clock settings for Mcu_InitClock */
+typedef enum {
+    MCU_CLOCK_72MHZ = 0,    /**< HSE x9 PLL; APB1 36 MHz, APB2 72 MHz, 2 flash wait states */
+    MCU_CLOCK_48MHZ,        /**< HSE x6 PLL; APB1 24 MHz, APB2 48 MHz, 1 wait state (USB capable) */
+    MCU_CLOCK_24MHZ,        /**< HSE x3 PLL; APB1/APB2 24 MHz, 0 wait states */
+    MCU_CLOCK_8MHZ,         /**< HSI, PLL and HSE off; APB1/APB2 8 MHz, 0 wait states */
+    MCU_NUM_CLOCKS
+} Mcu_ClockType;
+
+/** PLL state as returned by Mcu_GetPllStatus */
+typedef enum {
+    MCU_PLL_LOCKED = 0,
+    MCU_PLL_UNLOCKED,
+    MCU_PLL_STATUS_UNDEFINED
+} Mcu_PllStatusType;
+
+/** Clock domains for Mcu_GetClockFreq */
+typedef enum {
+    MCU_CLK_SYSCLK = 0,
+    MCU_CLK_HCLK,           /**< Core, AHB, DMA */
+    MCU_CLK_PCLK1,          /**< APB1: TIM2..4 registers, USART2/3, CAN, I2C, SPI2 */
+    MCU_CLK_PCLK2,          /**< APB2: GPIO, AFIO, ADC, TIM1, USART1, SPI1 */
+    MCU_CLK_TIMCLK1,        /**< TIM2..TIM4 counter clock: PCLK1, x2 when APB1 is divided */
+    MCU_CLK_TIMCLK2,        /**< TIM1 counter clock: PCLK2, x2 when APB2 is divided */
+    MCU_CLK_ADCCLK          /**< ADC conversion clock (max 14 MHz) */
+} Mcu_ClockDomainType;
+
+/** Peripherals with a gated clock; GPIOA..GPIOE are consecutive (GPIOA + port number) */
+typedef enum {
+    MCU_PERIPH_DMA1 = 0,
+    MCU_PERIPH_GPIOA,
+    MCU_PERIPH_GPIOB,
+    MCU_PERIPH_GPIOC,
+    MCU_PERIPH_GPIOD,
+    MCU_PERIPH_GPIOE,
+    MCU_PERIPH_AFIO,
+    MCU_PERIPH_ADC1,
+    MCU_PERIPH_ADC2,
+    MCU_PERIPH_TIM1,
+    MCU_PERIPH_TIM2,
+    MCU_PERIPH_TIM3,
+    MCU_PERIPH_TIM4,
+    MCU_PERIPH_USART1,
+    MCU_PERIPH_USART2,
+    MCU_PERIPH_USART3,
+    MCU_PERIPH_SPI1,
+    MCU_PERIPH_SPI2,
+    MCU_PERIPH_I2C1,
+    MCU_PERIPH_I2C2,
+    MCU_PERIPH_CAN1,
+    MCU_PERIPH_PWR,
+    MCU_PERIPH_BKP,
+    MCU_NUM_PERIPHS
+} Mcu_PeripheralType;
+
+/**
+ * @brief MCU driver configuration
+ */
+typedef struct {
+    Mcu_ClockType ClockSetting;         /**< Startup setting, for Mcu_InitClock(ConfigPtr->ClockSetting) */
+    boolean GateUnusedClocks;           /**< Mcu_Init switches off peripheral clocks nobody enabled */
+} Mcu_ConfigType;
+
+/**
+ * @brief Initializes the MCU driver.
+ * @details Call first in main, before the other drivers enable their clocks.
+ *          With GateUnusedClocks every peripheral clock without a user is
+ *          switched off (clocks left on by a bootloader or a debugger session).
+ */
+void Mcu_Init(const Mcu_ConfigType* ConfigPtr);
+
+/**
+ * @brief Switches SYSCLK to a clock setting.
+ * @details Runs on HSI during the switch; flash latency, AHB/APB/ADC
+ *          prescalers and SystemCoreClock follow the new setting.
+ *          Nothing is changed when the setting is already active.
+ * @return E_OK, or E_NOT_OK when the HSE or the PLL did not start (the core
+ *         then stays on the 8 MHz HSI).
+ */
+Std_ReturnType Mcu_InitClock(Mcu_ClockType ClockSetting);
+
+/**
+ * @brief Returns the setting the last Mcu_InitClock call left the core running at.
+ * @details MCU_CLOCK_72MHZ before the first call (set up by SystemInit), MCU_CLOCK_8MHZ
+ *          after a call that fell back to HSI.
+ *          Used to restore the clock tree after STOP mode, which falls back to HSI.
+ */
+Mcu_ClockType Mcu_GetClockSetting(void);
+
+/**
+ * @brief Returns whether the PLL is locked.
+ */
+Mcu_PllStatusType Mcu_GetPllStatus(void);
+
+/**
+ * @brief Returns the frequency of a clock domain in Hz, read from the RCC registers.
+ */
+uint32_t Mcu_GetClockFreq(Mcu_ClockDomainType Domain);
+
+/**
+ * @brief Takes a reference on a peripheral clock; the first one switches it on.
+ * @return E_OK, or E_NOT_OK for an invalid peripheral or a counter overflow.
+ */
+Std_ReturnType Mcu_EnablePeripheral(Mcu_PeripheralType Periph);
+
+/**
+ * @brief Drops a reference on a peripheral clock; the last one switches it off.
+ * @return E_OK, or E_NOT_OK for an invalid peripheral or an unbalanced call.
+ */
+Std_ReturnType Mcu_DisablePeripheral(Mcu_PeripheralType Periph);
+
+/**
+ * @brief Returns the number of users of a peripheral clock.
+ */
+uint8_t Mcu_GetPeripheralRefCount(Mcu_PeripheralType Periph);
+
+#endif /* MCU_H */
@@ -0,0 +1,409 @@
+/**********************************************************
+ * @file    Port.c
+ * @brief   Port Driver Source File (AUTOSAR Standard)
+ * @details This file implements the AUTOSAR standard APIs for the Port Driver,
+ *          designed for STM32F103 using SPL. The driver supports configuration,
+ *          mode switching, direction control, refreshing, and version retrieval
+ *          for ports and pins.
+ *
+ * @version 1.0
+ * @date    2024-06-19
+ * @author  HALA Academy
+ **********************************************************/
+
+/* ===============================
+ *           Includes
+ * =============================== */
+#include "Port.h"
+#include "Mcu.h"
+#include <stddef.h>
+
+
+/* ===============================
+ *     Static/Internal Variables
+ * =============================== */
+static uint8_t Port_Initialized = 0;  /* Status variable to check if Port is initialized */
+static const Port_ConfigType* Port_ConfigPtr = NULL;  /* Active (flash-resident) configuration */
+static uint32_t Port_Clocks = 0;  /* GPIO/AFIO clocks (APB2ENR bits) referenced through the Mcu driver */
+
+/* Runtime direction/mode of each configured pin; the configuration itself stays const */
+static Port_PinStateType Port_PinState[PORT_MAX_PINS];
+
+/* CRL/CRH image and nibble mask of the pins whose direction is not changeable,
+ * in their current mode (Port_SetPinMode keeps it up to date), and the BSRR
+ * pull selection of those that are pulled inputs */
+typedef struct {
+    uint32_t Crl;
+    uint32_t CrlMask;
+    uint32_t Crh;
+    uint32_t CrhMask;
+    uint32_t Bsrr;
+} Port_RefreshImageType;
+
+static Port_RefreshImageType Port_RefreshImage[PORT_NUM_PORTS];
+
+/* CRx nibble of every mode (nibble n = mode n) for the pin's current direction,
+ * built for ModeChangeable pins so Port_SetPinMode is a table lookup; bit n of
+ * Port_ModePullUp: mode n is an input pulled up (ODR set) rather than down, as
+ * Port_GetPinCnf chose it (a CAN RX input is pulled up whatever Pull says) */
+static uint32_t Port_ModeImage[PORT_MAX_PINS];
+static uint8_t Port_ModePullUp[PORT_MAX_PINS];
+
+/* ===============================
+ *      Internal Helper Function
+ * =============================== */
+
+/* CRL/CRH nibble of a pin: MODE[1:0] (0 = input, else output speed) | CNF[1:0] << 2 */
+#define PORT_CNF_IN_ANALOG      0x0U
+#define PORT_CNF_IN_FLOATING    0x4U
+#define PORT_CNF_IN_PULL        0x8U
+#define PORT_CNF_OUT_PP         0x0U
+#define PORT_CNF_OUT_OD         0x4U
+#define PORT_CNF_AF_PP          0x8U
+
+/* ODR action of a pin: input pull-up/down is selected by ODR, outputs start at Level */
+#define PORT_ODR_KEEP           0U
+#define PORT_ODR_SET            1U
+#define PORT_ODR_RESET          2U
+
+#define PORT_GPIO_BASE(PortNum) ((GPIO_TypeDef *)(GPIOA_BASE + ((uint32_t)(PortNum) * 0x400U)))
+
+/**********************************************************
+ * @brief Compute the CRx nibble and ODR action of a pin
+ * @param[in]  pinCfg    Pointer to pin configuration structure
+ * @param[in]  Mode      Functional mode (configured or runtime)
+ * @param[in]  Direction Direction (configured or runtime)
+ * @param[out] odr       PORT_ODR_KEEP/SET/RESET
+ * @return 4-bit CNF|MODE value, 0xFF for an unsupported mode
+ **********************************************************/
+static uint8_t Port_GetPinCnf(const Port_PinConfigType* pinCfg, Port_PinModeType Mode,
+                              Port_PinDirectionType Direction, uint8_t* odr) {
+    uint8_t speed;
+    uint8_t inPull;
+
+    switch (pinCfg->speed) {
+        case 10: speed = GPIO_Speed_10MHz; break;
+        case 50: speed = GPIO_Speed_50MHz; break;
+        default: speed = GPIO_Speed_2MHz;  break;
+    }
+
+    /* Input with pull: CNF=10, the direction of the pull comes from ODR */
+    if (pinCfg->Pull == PORT_PIN_PULL_UP) {
+        inPull = PORT_CNF_IN_PULL;
+        *odr = PORT_ODR_SET;
+    } else if (pinCfg->Pull == PORT_PIN_PULL_DOWN) {
+        inPull = PORT_CNF_IN_PULL;
+        *odr = PORT_ODR_RESET;
+    } else {
+        inPull = PORT_CNF_IN_FLOATING;
+        *odr = PORT_ODR_KEEP;
+    }
+
+    switch (Mode) {
+        case PORT_PIN_MODE_DIO:
+            if (Direction != PORT_PIN_OUT) return inPull;
+            *odr = (pinCfg->Level == PORT_PIN_LEVEL_HIGH) ? PORT_ODR_SET : PORT_ODR_RESET;
+            return (uint8_t)(speed | ((pinCfg->Pull == PORT_PIN_PULL_UP) ? PORT_CNF_OUT_PP : PORT_CNF_OUT_OD));
+
+        case PORT_PIN_MODE_ADC:
+            *odr = PORT_ODR_KEEP;
+            return PORT_CNF_IN_ANALOG;
+
+        case PORT_PIN_MODE_ICU:
+            /* Timer input capture reads the pin through the input path */
+            return inPull;
+
+        case PORT_PIN_MODE_SPI:
+            if (Direction != PORT_PIN_OUT) {
+                *odr = PORT_ODR_KEEP;
+                return PORT_CNF_IN_FLOATING;
+            }
+            break;
+
+        case PORT_PIN_MODE_CAN:
+            if (Direction != PORT_PIN_OUT) {
+                *odr = PORT_ODR_SET;    /* RX line typically pulled up */
+                return PORT_CNF_IN_PULL;
+            }
+            break;
+
+        case PORT_PIN_MODE_PWM:
+        case PORT_PIN_MODE_LIN:     /* LIN typically uses AF_PP for TX */
+            break;
+
+        default:
+            return 0xFF;  // Unsupported mode
+    }
+
+    /* Alternate function push-pull output */
+    if (Direction == PORT_PIN_OUT) {
+        *odr = (pinCfg->Level == PORT_PIN_LEVEL_HIGH) ? PORT_ODR_SET : PORT_ODR_RESET;
+    } else {
+        *odr = PORT_ODR_KEEP;
+    }
+    return (uint8_t)(speed | PORT_CNF_AF_PP);
+}
+
+/**********************************************************
+ * @brief Configure a GPIO pin with its runtime direction/mode
+ * @details Runtime path (direction/mode change): one BSRR store for the
+ *          level, one read-modify-write of the pin's CRL/CRH nibble.
+ * @param[in] pinCfg Pointer to pin configuration structure
+ * @param[in] state  Runtime direction/mode of the pin
+ **********************************************************/
+static void Port_ApplyPinConfig(const Port_PinConfigType* pinCfg, Port_PinStateType state) {
+    uint8_t odr;
+    uint8_t cnf;
+
+    if (pinCfg->PortNum >= PORT_NUM_PORTS || pinCfg->PinNum > 15) return;
+    cnf = Port_GetPinCnf(pinCfg, state.Mode, (Port_PinDirectionType)state.Direction, &odr);
+    if (cnf == 0xFF) return;
+
+    GPIO_TypeDef* port = PORT_GPIO_BASE(pinCfg->PortNum);
+    uint32_t pinMask = PORT_GET_PIN_MASK(pinCfg->PinNum);
+    volatile uint32_t* cr = (pinCfg->PinNum < 8) ? &port->CRL : &port->CRH;
+    uint32_t shift = (uint32_t)(pinCfg->PinNum & 7U) * 4U;
+
+    if (odr == PORT_ODR_SET) port->BSRR = pinMask;
+    else if (odr == PORT_ODR_RESET) port->BSRR = pinMask << 16;
+    *cr = (*cr & ~(0xFUL << shift)) | ((uint32_t)cnf << shift);
+}
+
+/**********************************************************
+ * @brief Take or drop the clock references of a set of ports
+ * @param[in] Clocks APB2ENR bits (GPIOx, AFIO)
+ * @param[in] Enable TRUE: Mcu_EnablePeripheral, FALSE: Mcu_DisablePeripheral
+ **********************************************************/
+static void Port_ClockRefs(uint32_t Clocks, boolean Enable) {
+    for (uint8_t port = 0; port < PORT_NUM_PORTS; port++) {
+        if (Clocks & (RCC_APB2Periph_GPIOA << port)) {
+            Mcu_PeripheralType periph = (Mcu_PeripheralType)(MCU_PERIPH_GPIOA + port);
+            (void)(Enable ? Mcu_EnablePeripheral(periph) : Mcu_DisablePeripheral(periph));
+        }
+    }
+    if (Clocks & RCC_APB2Periph_AFIO) {
+        (void)(Enable ? Mcu_EnablePeripheral(MCU_PERIPH_AFIO) : Mcu_DisablePeripheral(MCU_PERIPH_AFIO));
+    }
+}
+
+/**********************************************************
+ * @brief Precompute the CRx nibble of every mode of a pin
+ * @param[in] Pin Pin index; uses its current runtime direction
+ **********************************************************/
+static void Port_BuildModeImage(Port_PinType Pin) {
+    const Port_PinConfigType* pinCfg = &Port_ConfigPtr->PinConfigs[Pin];
+    Port_PinDirectionType direction = (Port_PinDirectionType)Port_PinState[Pin].Direction;
+    uint32_t image = 0;
+    uint8_t pullUp = 0;
+    uint8_t odr;
+
+    for (uint8_t mode = 0; mode < PORT_NUM_MODES; mode++) {
+        image |= (uint32_t)Port_GetPinCnf(pinCfg, mode, direction, &odr) << (mode * 4U);
+        if (odr == PORT_ODR_SET) pullUp |= (uint8_t)(1U << mode);
+    }
+    Port_ModeImage[Pin] = image;
+    Port_ModePullUp[Pin] = pullUp;
+}
+
+/**********************************************************
+ * @brief Store the CRx nibble and pull selection of a pin in the refresh image
+ * @param[in] pinCfg Pin whose direction is not changeable
+ * @param[in] cnf    Current CNF|MODE nibble of the pin
+ * @param[in] odr    PORT_ODR_SET/RESET selects the pull of a pulled input
+ **********************************************************/
+static void Port_SetRefreshNibble(const Port_PinConfigType* pinCfg, uint32_t cnf, uint8_t odr) {
+    Port_RefreshImageType* refresh = &Port_RefreshImage[pinCfg->PortNum];
+    uint8_t pin = pinCfg->PinNum;
+    uint32_t shift = (uint32_t)(pin & 7U) * 4U;
+    uint32_t nibble = 0xFUL << shift;
+
+    if (pin < 8) {
+        refresh->Crl = (refresh->Crl & ~nibble) | (cnf << shift);
+        refresh->CrlMask |= nibble;
+    } else {
+        refresh->Crh = (refresh->Crh & ~nibble) | (cnf << shift);
+        refresh->CrhMask |= nibble;
+    }
+    /* Output levels belong to Dio; only the pull of an input is refreshed */
+    refresh->Bsrr &= ~((1UL << pin) | (1UL << (pin + 16)));
+    if (cnf == PORT_CNF_IN_PULL) {
+        refresh->Bsrr |= (odr == PORT_ODR_RESET) ? (1UL << (pin + 16)) : (1UL << pin);
+    }
+}
+
+/* ===============================
+ *     Function Definitions
+ * =============================== */
+
+/**********************************************************
+ * @brief Initialize all Ports/Pins based on configuration
+ * @details The configuration table is folded into one CRL/CRH/BSRR image
+ *          per port first. The clocks of the used ports are then referenced
+ *          through the Mcu driver and every used port is committed with at most three
+ *          stores (BSRR before CRx so outputs come up at their level).
+ *          Registers are only read back when a port is partially configured.
+ * @param[in] ConfigPtr Pointer to Port configuration
+ **********************************************************/
+void Port_Init(const Port_ConfigType* ConfigPtr) {
+    uint32_t crl[PORT_NUM_PORTS] = {0}, crlMask[PORT_NUM_PORTS] = {0};
+    uint32_t crh[PORT_NUM_PORTS] = {0}, crhMask[PORT_NUM_PORTS] = {0};
+    uint32_t bsrr[PORT_NUM_PORTS] = {0};
+    uint32_t clocks = 0;
+    uint32_t lastRemap = 0;
+
+    if (ConfigPtr == NULL || ConfigPtr->PinCount > PORT_MAX_PINS) return;
+
+    for (uint8_t port = 0; port < PORT_NUM_PORTS; port++) {
+        Port_RefreshImage[port] = (Port_RefreshImageType){0};
+    }
+
+    for (uint16_t i = 0; i < ConfigPtr->PinCount; i++) {
+        const Port_PinConfigType* pinCfg = &ConfigPtr->PinConfigs[i];
+        uint8_t port = pinCfg->PortNum;
+        uint8_t pin = pinCfg->PinNum;
+        uint8_t odr;
+        uint8_t cnf;
+
+        Port_PinState[i].Direction = (uint8_t)pinCfg->Direction;
+        Port_PinState[i].Mode = pinCfg->Mode;
+
+        if (port >= PORT_NUM_PORTS || pin > 15) continue;
+        cnf = Port_GetPinCnf(pinCfg, pinCfg->Mode, pinCfg->Direction, &odr);
+        if (cnf == 0xFF) continue;
+
+        uint32_t shift = (uint32_t)(pin & 7U) * 4U;
+        uint32_t nibble = 0xFUL << shift;
+        if (pin < 8) {
+            crl[port] = (crl[port] & ~nibble) | ((uint32_t)cnf << shift);
+            crlMask[port] |= nibble;
+        } else {
+            crh[port] = (crh[port] & ~nibble) | ((uint32_t)cnf << shift);
+            crhMask[port] |= nibble;
+        }
+        if (!pinCfg->DirectionChangeable) Port_SetRefreshNibble(pinCfg, cnf, odr);
+
+        /* Later entries for the same pin win, as with per-pin configuration */
+        bsrr[port] &= ~((1UL << pin) | (1UL << (pin + 16)));
+        if (odr == PORT_ODR_SET) bsrr[port] |= 1UL << pin;
+        else if (odr == PORT_ODR_RESET) bsrr[port] |= 1UL << (pin + 16);
+
+        clocks |= RCC_APB2Periph_GPIOA << port;
+        if (pinCfg->Remap != 0) clocks |= RCC_APB2Periph_AFIO;
+    }
+
+    /* New clock references first, then those of a previous Port_Init are dropped,
+     * so a port used by both configurations is never switched off */
+    Port_ClockRefs(clocks, TRUE);
+    Port_ClockRefs(Port_Clocks, FALSE);
+    Port_Clocks = clocks;
+
+    /* AFIO remaps before the pins switch to their alternate function;
+     * pins of one peripheral share a remap, so consecutive repeats are skipped */
+    for (uint16_t i = 0; i < ConfigPtr->PinCount; i++) {
+        uint32_t remap = ConfigPtr->PinConfigs[i].Remap;
+        if (remap != 0 && remap != lastRemap) {
+            GPIO_PinRemapConfig(remap, ENABLE);
+            lastRemap = remap;
+        }
+    }
+
+    for (uint8_t port = 0; port < PORT_NUM_PORTS; port++) {
+        if (!(clocks & (RCC_APB2Periph_GPIOA << port))) continue;
+        GPIO_TypeDef* gpio = PORT_GPIO_BASE(port);
+
+        if (bsrr[port]) gpio->BSRR = bsrr[port];
+        if (crlMask[port] == 0xFFFFFFFFUL) gpio->CRL = crl[port];
+        else if (crlMask[port]) gpio->CRL = (gpio->CRL & ~crlMask[port]) | crl[port];
+        if (crhMask[port] == 0xFFFFFFFFUL) gpio->CRH = crh[port];
+        else if (crhMask[port]) gpio->CRH = (gpio->CRH & ~crhMask[port]) | crh[port];
+    }
+    Port_ConfigPtr = ConfigPtr;
+    for (uint16_t i = 0; i < ConfigPtr->PinCount; i++) {
+        if (ConfigPtr->PinConfigs[i].ModeChangeable) Port_BuildModeImage((Port_PinType)i);
+    }
+    Port_Initialized = 1;
+}
+
+/**********************************************************
+ * @brief Change the direction of a Port pin (if runtime allowed)
+ * @details
+ * This function will change the pin direction (IN/OUT), if allowed in config.
+ * @param[in] Pin Pin number (0..n-1)
+ * @param[in] Direction Desired direction
+ **********************************************************/
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction) {
+    if (!Port_Initialized) return;
+    if (Pin >= Port_ConfigPtr->PinCount) return;
+    if (!Port_ConfigPtr->PinConfigs[Pin].DirectionChangeable) return;
+
+    Port_PinState[Pin].Direction = (uint8_t)Direction;
+    Port_ApplyPinConfig(&Port_ConfigPtr->PinConfigs[Pin], Port_PinState[Pin]);
+    if (Port_ConfigPtr->PinConfigs[Pin].ModeChangeable) Port_BuildModeImage(Pin);
+}
+
+/**********************************************************
+ * @brief Refresh the direction of pins that are not runtime-changeable
+ * @details Only pins configured with DirectionChangeable = 0 are refreshed,
+ *          in the mode they currently have (Port_SetPinMode updates the
+ *          image). Their CRL/CRH nibbles are collected per port, so this is
+ *          one masked read-modify-write per used register, plus one BSRR
+ *          store for the pull selection of pulled inputs.
+ **********************************************************/
+void Port_RefreshPortDirection(void) {
+    if (!Port_Initialized) return;
+    for (uint8_t port = 0; port < PORT_NUM_PORTS; port++) {
+        const Port_RefreshImageType* refresh = &Port_RefreshImage[port];
+        GPIO_TypeDef* gpio = PORT_GPIO_BASE(port);
+
+        if (refresh->Bsrr) gpio->BSRR = refresh->Bsrr;
+        if (refresh->CrlMask) gpio->CRL = (gpio->CRL & ~refresh->CrlMask) | refresh->Crl;
+        if (refresh->CrhMask) gpio->CRH = (gpio->CRH & ~refresh->CrhMask) | refresh->Crh;
+    }
+}
+
+/**********************************************************
+ * @brief Retrieve version information of the Port Driver
+ * @param[out] versioninfo Pointer to Std_VersionInfoType structure to receive version info
+ **********************************************************/
+void Port_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL) return;
+    versioninfo->vendorID = PORT_VENDOR_ID;
+    versioninfo->moduleID = PORT_MODULE_ID;
+    versioninfo->sw_major_version = PORT_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = PORT_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = PORT_SW_PATCH_VERSION;
+}
+
+/**********************************************************
+ * @brief Change the functional mode of a pin (if runtime allowed)
+ * @details Table lookup of the precomputed nibble and one CRL/CRH
+ *          read-modify-write; the output level is left in ODR, so a switch
+ *          to DIO output drives the level last written by Dio. Only a
+ *          switch to a pulled input also stores BSRR to select the pull.
+ *          AFIO remaps are static and applied once by Port_Init.
+ * @param[in] Pin Pin number
+ * @param[in] Mode Functional mode to switch to
+ **********************************************************/
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode) {
+    if (!Port_Initialized) return;
+    if (Pin >= Port_ConfigPtr->PinCount) return;
+    if ((uint8_t)Mode >= PORT_NUM_MODES) return;
+
+    const Port_PinConfigType* pinCfg = &Port_ConfigPtr->PinConfigs[Pin];
+    if (!pinCfg->ModeChangeable) return;
+
+    GPIO_TypeDef* port = PORT_GPIO_BASE(pinCfg->PortNum);
+    volatile uint32_t* cr = (pinCfg->PinNum < 8) ? &port->CRL : &port->CRH;
+    uint32_t shift = (uint32_t)(pinCfg->PinNum & 7U) * 4U;
+    uint32_t cnf = (Port_ModeImage[Pin] >> ((uint32_t)Mode * 4U)) & 0xFU;
+
+    uint8_t odr = ((Port_ModePullUp[Pin] >> (uint32_t)Mode) & 1U) ? PORT_ODR_SET : PORT_ODR_RESET;
+
+    if (cnf == PORT_CNF_IN_PULL) {
+        uint32_t pinMask = PORT_GET_PIN_MASK(pinCfg->PinNum);
+        port->BSRR = (odr == PORT_ODR_RESET) ? (pinMask << 16) : pinMask;
+    }
+    *cr = (*cr & ~(0xFUL << shift)) | (cnf << shift);
+    Port_PinState[Pin].Mode = (uint8_t)Mode;
+    if (!pinCfg->DirectionChangeable) Port_SetRefreshNibble(pinCfg, cnf, odr);
+}
@@ -17,7 +17,8 @@
 #include "stm32f10x_gpio.h"    /* STM32F103 standard peripheral library */
 #include "stm32f10x_rcc.h"     /* STM32F103 RCC definitions */
 
-#define PIN_COUNT 40 /* Total number of GPIO pins (A0..A15, B0..B15, C0..C15, D0..D15) */
+#define PORT_NUM_PORTS  4U  /* GPIOA..GPIOD */
+#define PORT_MAX_PINS   64U /* Maximum number of configured pins (A0..A15, B0..B15, C0..C15, D0..D15) */
 
 /**********************************************************
  * Definitions of PortId values for GPIO ports
@@ -50,6 +51,8 @@
 #define PORT_PIN_MODE_SPI       3
 #define PORT_PIN_MODE_CAN       4
 #define PORT_PIN_MODE_LIN       5
+#define PORT_PIN_MODE_ICU       6
+#define PORT_NUM_MODES          7   /* Number of modes above (CRx nibble table size) */
 
 #define PORT_PIN_PULL_NONE      0
 #define PORT_PIN_PULL_UP        1
@@ -64,7 +67,7 @@
 
 /**
  * @typedef Port_PinType
- * @brief   Identifier type for a Port pin (0..47: A0..A15, B0..B15, C0..C15)
+ * @brief   Identifier type for a Port pin (index into Port_ConfigType.PinConfigs)
  */
 typedef uint8 Port_PinType;
 
@@ -97,6 +100,7 @@ typedef struct {
     uint8 Level;                        /**< Initial level if output */
     uint8 Pull;                         /**< Pull type: none, up, down */
     uint8 ModeChangeable;               /**< 1=allow mode change at runtime */
+    uint32_t Remap;                     /**< AFIO remap (GPIO_Remap_xxx, e.g. GPIO_Remap1_CAN1 for CAN on PB8/PB9), 0 = none */
 } Port_PinConfigType;
 
 /**
@@ -108,10 +112,14 @@ typedef struct {
     uint16 PinCount;                      /**< Number of configured pins */
 } Port_ConfigType;
 
-/**********************************************************
- * Array to save each GPIO pin configuration
- **********************************************************/
-extern Port_PinConfigType PortCfg_Pins[PIN_COUNT];
+/**
+ * @struct Port_PinStateType
+ * @brief  Runtime direction/mode of a pin (the configuration stays const in flash)
+ */
+typedef struct {
+    uint8_t Direction : 1;              /**< Port_PinDirectionType */
+    uint8_t Mode      : 4;              /**< Port_PinModeType */
+} Port_PinStateType;
 
 /**********************************************************
  * Macro definitions for version, vendor, module ID used in VersionInfo
@@ -157,5 +165,4 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
  */
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 
-void Port_ApplyPinConfig(const Port_PinConfigType* pinCfg);
 #endif /* PORT_H */
@@ -0,0 +1,693 @@
+/*
+ * Pwm.c
+ * AUTOSAR ADC Driver implementation for STM32F103C8
+ */
+
+#include "Pwm.h"
+#include "Port.h"
+#include "Mcu.h"
+#include "Trace.h"
+#include "stm32f10x.h"
+#include <stddef.h>
+
+const Pwm_ConfigType* Pwm_CurrentConfigPtr = NULL_PTR;
+
+/* Timer peripherals indexed by Channel / PWM_CHANNELS_PER_TIMER */
+static TIM_TypeDef* const Pwm_Timers[PWM_NUM_TIMERS] = { TIM1, TIM2, TIM3, TIM4 };
+
+/* DMA1 channel (1..7) serving the update request of TIM1..TIM4 (RM0008 DMA1 request mapping) */
+static const uint8_t Pwm_UpdateDmaNum[PWM_NUM_TIMERS] = { 5, 2, 3, 7 };
+
+/* Logical channel currently streaming on each timer, 0xFF = none */
+static uint8_t Pwm_WaveformChannel[PWM_NUM_TIMERS] = { 0xFF, 0xFF, 0xFF, 0xFF };
+
+/* ISR jump tables, one per timer */
+static Pwm_TimerIsrTableType Pwm_IsrTable[PWM_NUM_TIMERS];
+
+/* Timebase stamp of the last edge interrupt of each timer, 0 = none yet */
+static volatile Gpt_TimestampType Pwm_EdgeTimestamp[PWM_NUM_TIMERS];
+
+/**
+ * @brief Clears the ISR jump tables of all timers.
+ */
+static void Pwm_ClearIsrTables(void) {
+    for (uint8 t = 0; t < PWM_NUM_TIMERS; t++) {
+        Pwm_TimerIsrTableType* tbl = &Pwm_IsrTable[t];
+        for (uint8 s = 0; s < PWM_CHANNELS_PER_TIMER; s++) {
+            tbl->UpdateCb[s] = NULL_PTR;
+            tbl->CcCb[s] = NULL_PTR;
+        }
+        tbl->UpdateMask = 0;
+        tbl->CcMask = 0;
+    }
+}
+
+/**
+ * @brief Takes or drops one timer clock reference per configured channel.
+ * @param ConfigPtr Configuration whose channels are counted.
+ * @param Enable TRUE: Mcu_EnablePeripheral, FALSE: Mcu_DisablePeripheral.
+ */
+static void Pwm_ClockRefs(const Pwm_ConfigType* ConfigPtr, boolean Enable) {
+    for (uint8 i = 0; i < ConfigPtr->numChannels; i++) {
+        uint8_t t = ConfigPtr->Channels[i].Channel / PWM_CHANNELS_PER_TIMER;
+        if (t >= PWM_NUM_TIMERS) continue;
+        Mcu_PeripheralType periph = (Mcu_PeripheralType)(MCU_PERIPH_TIM1 + t);
+        (void)(Enable ? Mcu_EnablePeripheral(periph) : Mcu_DisablePeripheral(periph));
+    }
+}
+
+/**
+ * @brief Prescaler for a 1 us counter tick (Pwm_PeriodType unit) at the current clock setting.
+ * @param tim Timer of the channel; TIM1 is clocked from APB2, TIM2..4 from APB1.
+ */
+static uint16_t Pwm_UsPrescaler(const TIM_TypeDef* tim) {
+    uint32_t timClk = Mcu_GetClockFreq((tim == TIM1) ? MCU_CLK_TIMCLK2 : MCU_CLK_TIMCLK1);
+    return (uint16_t)(timClk / 1000000UL - 1U);
+}
+
+/**
+ * @brief Returns the TIM peripheral associated with a given PWM channel.
+ * @param ch The PWM channel number (0-15).
+ * @return Pointer to the TIM peripheral.
+ */
+TIM_TypeDef* GetChannelTIM(Pwm_ChannelType ch) {
+    switch (ch / 4) {
+        case 0: return TIM1;  // 0–3
+        case 1: return TIM2;  // 4–7
+        case 2: return TIM3;  // 8–11
+        case 3: return TIM4;  // 12–15
+        default: return NULL_PTR;
+    }
+}
+
+/**
+ * @brief Initializes the PWM driver with the given configuration.
+ * @param ConfigPtr Pointer to the configuration structure.
+ */
+void Pwm_Init(const Pwm_ConfigType* ConfigPtr) {
+    if (!ConfigPtr || !ConfigPtr->Channels) return;
+    // Timer clocks of the new configuration first, then those of a previous Pwm_Init are dropped
+    Pwm_ClockRefs(ConfigPtr, TRUE);
+    if (Pwm_CurrentConfigPtr != NULL_PTR) {
+        Pwm_ClockRefs(Pwm_CurrentConfigPtr, FALSE);
+    }
+    Pwm_CurrentConfigPtr = ConfigPtr;
+    Pwm_ClearIsrTables();
+    for (uint8 t = 0; t < PWM_NUM_TIMERS; t++) {
+        Pwm_WaveformChannel[t] = 0xFF;
+    }
+
+    for (uint8 i = 0; i < ConfigPtr->numChannels; i++) {
+        const Pwm_ChannelConfigType* cfg = &ConfigPtr->Channels[i];
+        TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+        if (!tim) continue;
+
+        // 1) Timer clock is already referenced (Pwm_ClockRefs); waveform channels keep DMA_CHANNEL_ANY requests off TIMx_UP
+        if (cfg->WaveformHalfCb || cfg->WaveformCompleteCb) {
+            Dma_ReserveChannel(Pwm_UpdateDmaNum[cfg->Channel / PWM_CHANNELS_PER_TIMER]);
+        }
+
+        // 2) Time-base: zero-init then set fields; 1 us tick at any clock setting
+        TIM_TimeBaseInitTypeDef tb = {0};
+        tb.TIM_Prescaler     = Pwm_UsPrescaler(tim);
+        tb.TIM_CounterMode   = TIM_CounterMode_Up;
+        tb.TIM_Period        = (uint16)(cfg->defaultPeriode - 1);
+        tb.TIM_ClockDivision = TIM_CKD_DIV1;
+        TIM_TimeBaseInit(tim, &tb);
+        TIM_ARRPreloadConfig(tim, ENABLE);
+
+        // 3) Output-compare: zero-init, then set to your compareValue
+        TIM_OCInitTypeDef oc = {0};
+        oc.TIM_OCMode        = TIM_OCMode_PWM1;
+        oc.TIM_OutputState   = TIM_OutputState_Enable;
+        oc.TIM_Pulse         = cfg->compareValue;               // use compareValue here!
+        oc.TIM_OCPolarity    = (cfg->polarity == PWM_HIGH)
+                                ? TIM_OCPolarity_High
+                                : TIM_OCPolarity_Low;
+
+        switch (cfg->Channel % 4) {
+            case 0: TIM_OC1Init(tim, &oc); TIM_OC1PreloadConfig(tim, TIM_OCPreload_Enable); break;
+            case 1: TIM_OC2Init(tim, &oc); TIM_OC2PreloadConfig(tim, TIM_OCPreload_Enable); break;
+            case 2: TIM_OC3Init(tim, &oc); TIM_OC3PreloadConfig(tim, TIM_OCPreload_Enable); break;
+            case 3: TIM_OC4Init(tim, &oc); TIM_OC4PreloadConfig(tim, TIM_OCPreload_Enable); break;
+        }
+
+        // 4) Force an update so ARR/CCR preload registers are loaded immediately
+        TIM_GenerateEvent(tim, TIM_EventSource_Update);
+
+        // 5) Start timer
+        TIM_Cmd(tim, ENABLE);
+    }
+}
+
+/**
+ * @brief De-initializes the PWM driver.
+ */
+void Pwm_DeInit(void) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR) {
+        return; // No configuration to de-initialize
+    }
+
+    for (uint8 i = 0; i < Pwm_CurrentConfigPtr->numChannels; i++) {
+        const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[i];
+        TIM_TypeDef* tim = GetChannelTIM(channelConfig->Channel);
+        if (tim == NULL_PTR) continue;
+        Pwm_DisableNotification(i);
+        Pwm_StopWaveform(i);
+        TIM_Cmd(tim, DISABLE); // Disable the TIM peripheral
+
+        // Re-apply that “disabled” configuration to whichever channel it was
+        TIM_OCInitTypeDef ocInit;
+        TIM_OCStructInit(&ocInit);
+        switch (channelConfig->Channel % 4) {
+            case 0: 
+                TIM_OC1Init(tim, &ocInit);
+                break;
+            case 1: 
+                TIM_OC2Init(tim, &ocInit);
+                break;
+            case 2: 
+                TIM_OC3Init(tim, &ocInit);
+                break;
+            case 3: 
+                TIM_OC4Init(tim, &ocInit);
+                break;
+            default:
+                break; // Invalid channel
+        }
+
+        // Reset the TIM peripheral
+        if (tim == TIM1) {
+            TIM_CtrlPWMOutputs(TIM1, DISABLE); // De-initialize the TIM peripheral
+        }
+    }
+
+    Pwm_ClearIsrTables();
+    Pwm_ClockRefs(Pwm_CurrentConfigPtr, FALSE); // Timer clocks stop once ICU no longer uses them either
+    Pwm_CurrentConfigPtr = NULL_PTR; // Clear the configuration pointer
+}
+
+/**
+ * @brief Sets the duty cycle for a specific PWM channel.
+ * @param ChannelNumber The PWM channel to set the duty cycle for.
+ * @param DutyCycle The duty cycle value to set (0-100%).
+ */
+void Pwm_SetDutyCycle(Pwm_ChannelType idx, uint16 DutyPercent) {
+    if (!Pwm_CurrentConfigPtr || idx >= Pwm_CurrentConfigPtr->numChannels) return;
+    if (DutyPercent > 100) DutyPercent = 100;
+
+    const Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[idx];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+    if (!tim) return;
+
+    // Map 0→MIN, 100→MAX
+    uint32_t pulse = SERVO_MIN_PULSE_US
+                   + ((uint32_t)(SERVO_MAX_PULSE_US - SERVO_MIN_PULSE_US)
+                      * DutyPercent) / 100;
+
+    switch (cfg->Channel % 4) {
+        case 0: TIM_SetCompare1(tim, pulse); break;
+        case 1: TIM_SetCompare2(tim, pulse); break;
+        case 2: TIM_SetCompare3(tim, pulse); break;
+        case 3: TIM_SetCompare4(tim, pulse); break;
+    }
+}
+
+/**
+ * @brief Sets the period and duty for a specific PWM channel.
+ * @param ChannelNumber The PWM channel to set the period for.
+ * @param Period The period value to set, in us (same unit as defaultPeriode).
+ * @param DutyCycle The duty cycle value to set (0-100%).
+ */
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels || Pwm_CurrentConfigPtr->Channels[ChannelNumber].classType == PWM_FIXED_PERIOD) {
+        return; // Invalid configuration or channel
+    }
+
+    const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(channelConfig->Channel);
+    
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+
+    // Update the period
+    TIM_TimeBaseInitTypeDef TIM_InitStruct;
+    TIM_InitStruct.TIM_Prescaler = Pwm_UsPrescaler(tim);
+    TIM_InitStruct.TIM_Period = Period - 1;
+    TIM_InitStruct.TIM_ClockDivision = TIM_CKD_DIV1;
+    TIM_InitStruct.TIM_CounterMode = TIM_CounterMode_Up;
+
+    TIM_TimeBaseInit(tim, &TIM_InitStruct);
+
+    // Update the duty cycle
+    uint16 compareValue = (DutyCycle * Period) >> 15;
+    
+    switch (channelConfig->Channel % 4) {
+        case 0: 
+            TIM_SetCompare1(tim, compareValue);
+            break;
+        case 1: 
+            TIM_SetCompare2(tim, compareValue);
+            break;
+        case 2: 
+            TIM_SetCompare3(tim, compareValue);
+            break;
+        case 3: 
+            TIM_SetCompare4(tim, compareValue);
+            break;
+        default:
+            break; // Invalid channel
+    }
+}
+
+/**
+ * @brief Service sets the PWM output to the configured Idle state
+ * @param ChannelNumber The PWM channel to start.
+ */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return; // Invalid configuration or channel
+    }
+    const Pwm_ChannelConfigType* channelConfig = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(channelConfig->Channel);
+
+    
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+    Pwm_ChannelType channel = channelConfig->Channel;
+    if (channelConfig->idleState == PWM_HIGH) {
+       switch (channel){
+            case 0: 
+                Dio_WriteChannel(8, STD_HIGH);
+                break;
+            case 1:
+                Dio_WriteChannel(0, STD_HIGH);
+                break;
+            case 2:
+                Dio_WriteChannel(6, STD_HIGH);
+                break;
+            case 3:
+                Dio_WriteChannel(22, STD_HIGH);
+                break;
+            case 4:
+                Dio_WriteChannel(9, STD_HIGH);
+                break;
+            case 5: 
+                Dio_WriteChannel(1, STD_HIGH);
+                break;
+            case 6:
+                Dio_WriteChannel(7, STD_HIGH);
+                break;
+            case 7:
+                Dio_WriteChannel(23, STD_HIGH);
+                break;
+            case 8:
+                Dio_WriteChannel(10, STD_HIGH);
+                break;
+            case 9: 
+                Dio_WriteChannel(2, STD_HIGH);
+                break;
+            case 10:
+                Dio_WriteChannel(16, STD_HIGH);
+                break;
+            case 11:
+                Dio_WriteChannel(24, STD_HIGH);
+                break;
+            case 12:
+                Dio_WriteChannel(11, STD_HIGH);
+                break;
+            case 13: 
+                Dio_WriteChannel(3, STD_HIGH);
+                break;
+            case 14:
+                Dio_WriteChannel(17, STD_HIGH);
+                break;
+            case 15:
+                Dio_WriteChannel(25, STD_HIGH);
+                break;
+            default:
+                break; // Invalid channel            
+       } 
+    } else {
+        switch (channel) {
+            case 0: 
+                Dio_WriteChannel(8, STD_LOW);
+                break;
+            case 1:
+                Dio_WriteChannel(0, STD_LOW);
+                break;
+            case 2:
+                Dio_WriteChannel(6, STD_LOW);
+                break;
+            case 3:
+                Dio_WriteChannel(22, STD_LOW);
+                break;
+            case 4:
+                Dio_WriteChannel(9, STD_LOW);
+                break;
+            case 5: 
+                Dio_WriteChannel(1, STD_LOW);
+                break;
+            case 6:
+                Dio_WriteChannel(7, STD_LOW);
+                break;
+            case 7:
+                Dio_WriteChannel(23, STD_LOW);
+                break;
+            case 8:
+                Dio_WriteChannel(10, STD_LOW);
+                break;
+            case 9: 
+                Dio_WriteChannel(2, STD_LOW);
+                break;
+            case 10:
+                Dio_WriteChannel(16, STD_LOW);
+                break;
+            case 11:
+                Dio_WriteChannel(24, STD_LOW);
+                break;
+            case 12:
+                Dio_WriteChannel(11, STD_LOW);
+                break;
+            case 13: 
+                Dio_WriteChannel(3, STD_LOW);
+                break;
+            case 14:
+                Dio_WriteChannel(17, STD_LOW);
+                break;
+            case 15:
+                Dio_WriteChannel(25, STD_LOW);
+                break;
+            default:
+                break; // Invalid channel            
+        }
+    }
+}
+
+/**
+ * @brief Service to read the internal state of the PWM output signal.
+ * @param ChannelNumber The PWM channel to start.
+ * @return The current output state of the PWM channel.
+ */
+Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber) {
+    const Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+
+    uint16_t isOutputEnabled = 0;
+    switch (cfg->Channel % 4) {
+        case 0: 
+            isOutputEnabled = (tim->CCER & TIM_CCER_CC1E);
+            break;
+        case 1: 
+            isOutputEnabled = (tim->CCER & TIM_CCER_CC2E);
+            break;  
+        case 2: 
+            isOutputEnabled = (tim->CCER & TIM_CCER_CC3E);
+            break;
+        case 3: 
+            isOutputEnabled = (tim->CCER & TIM_CCER_CC4E);
+            break;
+        default:
+            break; // Invalid channel
+    }
+    return (isOutputEnabled) ? PWM_HIGH : PWM_LOW;
+}
+
+/**
+ * @brief Service to disable the PWM signal edge notification
+ * @param ChannelNumber The PWM channel to disable notification for.
+ */
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return; // Invalid configuration or channel
+    }
+
+    Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+
+    Pwm_TimerIsrTableType* tbl = &Pwm_IsrTable[cfg->Channel / PWM_CHANNELS_PER_TIMER];
+    uint8 slot = cfg->Channel % PWM_CHANNELS_PER_TIMER;
+    uint8_t slotBit = (uint8_t)(1U << slot);
+
+    // Mask the interrupt sources first, then drop the jump table entries
+    TIM_ITConfig(tim, (uint16_t)(TIM_IT_CC1 << slot), DISABLE);
+    if ((tbl->UpdateMask & (uint8_t)~slotBit) == 0) {
+        TIM_ITConfig(tim, TIM_IT_Update, DISABLE); // No other slot needs the update edge
+    }
+    tbl->UpdateMask &= (uint8_t)~slotBit;
+    tbl->CcMask     &= (uint8_t)~slotBit;
+    tbl->UpdateCb[slot] = NULL_PTR;
+    tbl->CcCb[slot]     = NULL_PTR;
+
+    cfg->NotificationEnable = PWM_NOTIFICATION_OFF;
+}
+
+/**
+ * @brief Service to enable the PWM signal edge notification
+ * @param ChannelNumber The PWM channel to enable notification for.
+ * @param Notification The type of edge notification to enable.
+ */
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return; // Invalid configuration or channel
+    }
+
+    Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+    if (tim == NULL_PTR) {
+        return; // Invalid channel
+    }
+
+    // Start from a clean slot so a narrower edge selection really drops the other edge
+    Pwm_DisableNotification(ChannelNumber);
+
+    Pwm_TimerIsrTableType* tbl = &Pwm_IsrTable[cfg->Channel / PWM_CHANNELS_PER_TIMER];
+    uint8 slot = cfg->Channel % PWM_CHANNELS_PER_TIMER;
+    uint8_t slotBit = (uint8_t)(1U << slot);
+    uint16_t cc_flag = (uint16_t)(TIM_IT_CC1 << slot);
+
+    Pwm_NotificationCbType risingCb  = cfg->RisingEdgeCb  ? cfg->RisingEdgeCb  : cfg->NotificationCb;
+    Pwm_NotificationCbType fallingCb = cfg->FallingEdgeCb ? cfg->FallingEdgeCb : cfg->NotificationCb;
+
+    // PWM mode 1 (up-counting): output becomes active at the update event and
+    // inactive at the CCx match. Active is high for PWM_HIGH polarity.
+    Pwm_EdgeNotificationType updateEdge = (cfg->polarity == PWM_HIGH) ? PWM_RISING_EDGE : PWM_FALLING_EDGE;
+    Pwm_NotificationCbType updateCb = (cfg->polarity == PWM_HIGH) ? risingCb : fallingCb;
+    Pwm_NotificationCbType ccCb     = (cfg->polarity == PWM_HIGH) ? fallingCb : risingCb;
+
+    cfg->NotificationEnable = PWM_NOTIFICATION_ON; // Enable notification
+
+    if ((Notification & updateEdge) && updateCb) {
+        if (tbl->UpdateMask == 0) {
+            TIM_ClearITPendingBit(tim, TIM_IT_Update); // Drop a stale flag before unmasking
+        }
+        tbl->UpdateCb[slot] = updateCb;
+        tbl->UpdateMask |= slotBit;
+        TIM_ITConfig(tim, TIM_IT_Update, ENABLE);
+    }
+    if ((Notification & ~updateEdge & PWM_BOTH_EDGES) && ccCb) {
+        TIM_ClearITPendingBit(tim, cc_flag);
+        tbl->CcCb[slot] = ccCb;
+        tbl->CcMask |= slotBit;
+        TIM_ITConfig(tim, cc_flag, ENABLE);
+    }
+
+    // Enable the TIM interrupt in NVIC (TIM1 has split update/compare vectors)
+    NVIC_InitTypeDef n;
+    n.NVIC_IRQChannelPreemptionPriority = 1;
+    n.NVIC_IRQChannelSubPriority = 0;
+    n.NVIC_IRQChannelCmd = ENABLE;
+    if (tim == TIM1) {
+        n.NVIC_IRQChannel = TIM1_UP_IRQn;
+        NVIC_Init(&n);
+        n.NVIC_IRQChannel = TIM1_CC_IRQn;
+        NVIC_Init(&n);
+    } else {
+        n.NVIC_IRQChannel = (tim == TIM2) ? TIM2_IRQn :
+                            (tim == TIM3) ? TIM3_IRQn : TIM4_IRQn;
+        NVIC_Init(&n);
+    }
+}
+
+/**
+ * @brief Returns the time of the last edge interrupt of the channel's timer.
+ * @param ChannelNumber The PWM channel.
+ * @return Gpt_GetTimestamp taken at the start of Pwm_IrqDispatch (us), 0 if none yet.
+ */
+Gpt_TimestampType Pwm_GetEdgeTimestamp(Pwm_ChannelType ChannelNumber) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return 0;
+    }
+    uint8_t t = Pwm_CurrentConfigPtr->Channels[ChannelNumber].Channel / PWM_CHANNELS_PER_TIMER;
+    if (t >= PWM_NUM_TIMERS) {
+        return 0;
+    }
+    Gpt_TimestampType ts;
+    do {
+        ts = Pwm_EdgeTimestamp[t];
+    } while (ts != Pwm_EdgeTimestamp[t]);       // Two words: re-read if an edge interrupt wrote in between
+    return ts;
+}
+
+/**
+ * @brief Dispatches the pending interrupt sources of one timer.
+ * @param TimerIdx Timer index (0 = TIM1 .. 3 = TIM4).
+ * @param SourceMask Sources this vector is responsible for (PWM_IRQ_SRC_*).
+ */
+RAMFUNC void Pwm_IrqDispatch(uint8_t TimerIdx, uint16_t SourceMask) {
+    TRACE_ISR_ENTER();
+    Gpt_TimestampType now = Gpt_GetTimestamp();     // Before the SR read: closest to the edge
+    TIM_TypeDef* tim = Pwm_Timers[TimerIdx];
+    const Pwm_TimerIsrTableType* tbl = &Pwm_IsrTable[TimerIdx];
+
+    // One SR read: only sources that are both pending and enabled
+    uint32_t pending = tim->SR & tim->DIER & SourceMask;
+    tim->SR = (uint16_t)~pending; // rc_w0: clears exactly the handled flags
+    if (pending) {
+        Pwm_EdgeTimestamp[TimerIdx] = now;      // Read by the callbacks below via Pwm_GetEdgeTimestamp
+    }
+    TRACE_EMIT(TRACE_EV_PWM_EDGE, TimerIdx, pending);
+
+    if (pending & TIM_IT_Update) {
+        uint32_t slots = tbl->UpdateMask;
+        while (slots) {
+            uint32_t s = (uint32_t)__builtin_ctz(slots);
+            tbl->UpdateCb[s]();
+            slots &= slots - 1U;
+        }
+    }
+
+    // CC1IF..CC4IF are SR bits 1..4, i.e. slot = bit - 1
+    uint32_t ccPending = (pending >> 1) & tbl->CcMask;
+    while (ccPending) {
+        uint32_t s = (uint32_t)__builtin_ctz(ccPending);
+        tbl->CcCb[s]();
+        ccPending &= ccPending - 1U;
+    }
+    TRACE_ISR_EXIT(TRACE_ISR_TIM(TimerIdx));
+}
+
+/**
+ * @brief DMA notification of the waveform channels: half/complete buffer.
+ * @param Channel DMA channel, identifies the timer via Pwm_UpdateDmaNum.
+ * @param Events DMA_EVENT_HT and/or DMA_EVENT_TC.
+ */
+static void Pwm_WaveformDmaNotification(Dma_ChannelType Channel, Dma_EventType Events) {
+    uint8 timerIdx = 0;
+    while (timerIdx < PWM_NUM_TIMERS && Pwm_UpdateDmaNum[timerIdx] != Channel) {
+        timerIdx++;
+    }
+    if (timerIdx == PWM_NUM_TIMERS || Pwm_CurrentConfigPtr == NULL_PTR) {
+        return;
+    }
+
+    uint8_t ch = Pwm_WaveformChannel[timerIdx];
+    if (ch == 0xFF) {
+        return;
+    }
+    const Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ch];
+    if ((Events & DMA_EVENT_HT) && cfg->WaveformHalfCb) {
+        cfg->WaveformHalfCb();
+    }
+    if ((Events & DMA_EVENT_TC) && cfg->WaveformCompleteCb) {
+        cfg->WaveformCompleteCb();
+    }
+}
+
+/**
+ * @brief Plays a buffer of compare values into one or more CCR registers by DMA.
+ * @param ChannelNumber First PWM channel; its CC slot is the first register of the burst.
+ * @param NumCcr Number of consecutive CCR registers of the same timer updated per period (1-4).
+ * @param Buffer Interleaved compare values, NumCcr per sample.
+ * @param NumSamples Number of samples (periods) in Buffer.
+ * @param Mode One-shot or circular repeat.
+ * @return E_OK if playback started, E_NOT_OK on invalid arguments or if the DMA channel is owned elsewhere.
+ */
+Std_ReturnType Pwm_StartWaveform(Pwm_ChannelType ChannelNumber, uint8_t NumCcr, const uint16_t* Buffer, uint16_t NumSamples, Pwm_WaveformModeType Mode) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return E_NOT_OK; // Invalid configuration or channel
+    }
+    const Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+    uint8 timerIdx = cfg->Channel / PWM_CHANNELS_PER_TIMER;
+    uint8 slot = cfg->Channel % PWM_CHANNELS_PER_TIMER;
+
+    if (tim == NULL_PTR || Buffer == NULL_PTR || NumSamples == 0 ||
+        NumCcr == 0 || (slot + NumCcr) > PWM_CHANNELS_PER_TIMER ||
+        ((uint32_t)NumSamples * NumCcr) > 0xFFFFU) {
+        return E_NOT_OK; // Burst must stay within CCR1..CCR4, CNDTR is 16-bit
+    }
+
+    // Restart on the same timer: give the channel back first
+    if (Pwm_WaveformChannel[timerIdx] != 0xFF) {
+        Pwm_StopWaveform(Pwm_WaveformChannel[timerIdx]);
+    }
+
+    // 1) Claim the DMA channel wired to TIMx_UP; half/complete events only if the channel has callbacks
+    Dma_ChannelConfigType dcfg = {
+        .Direction    = DMA_DIR_MEM_TO_PERIPH,
+        .Mode         = (Mode == PWM_WAVEFORM_CIRCULAR) ? DMA_MODE_CIRCULAR : DMA_MODE_NORMAL,
+        .Priority     = DMA_PRIORITY_HIGH,
+        .PeriphWidth  = DMA_WIDTH_16,
+        .MemWidth     = DMA_WIDTH_16,
+        .PeriphInc    = 0,
+        .MemInc       = 1,
+        .Events       = (Dma_EventType)((cfg->WaveformHalfCb ? DMA_EVENT_HT : 0U) |
+                                        (cfg->WaveformCompleteCb ? DMA_EVENT_TC : 0U)),
+        .Notification = Pwm_WaveformDmaNotification
+    };
+    Dma_ChannelType dma = Pwm_UpdateDmaNum[timerIdx];
+    if (Dma_RequestChannel(&dma, &dcfg) != E_OK) {
+        return E_NOT_OK; // DMA channel owned by another driver
+    }
+    Pwm_WaveformChannel[timerIdx] = ChannelNumber;
+
+    // 2) Burst: every update request writes NumCcr halfwords to CCRslot.. via DMAR
+    TIM_DMACmd(tim, TIM_DMA_Update, DISABLE);
+    TIM_DMAConfig(tim, (uint16_t)(TIM_DMABase_CCR1 + slot), (uint16_t)((NumCcr - 1U) << 8));
+
+    // 3) Start: buffer -> TIMx_DMAR; CCR preload makes each burst take effect at the next period
+    Dma_Start(dma, (uint32_t)Buffer, (uint32_t)&tim->DMAR, (uint16_t)(NumSamples * NumCcr));
+    TIM_DMACmd(tim, TIM_DMA_Update, ENABLE);
+    return E_OK;
+}
+
+/**
+ * @brief Stops a DMA waveform; the CCR registers keep their last values.
+ * @param ChannelNumber The PWM channel passed to Pwm_StartWaveform.
+ */
+void Pwm_StopWaveform(Pwm_ChannelType ChannelNumber) {
+    if (Pwm_CurrentConfigPtr == NULL_PTR || ChannelNumber >= Pwm_CurrentConfigPtr->numChannels) {
+        return; // Invalid configuration or channel
+    }
+    const Pwm_ChannelConfigType* cfg = &Pwm_CurrentConfigPtr->Channels[ChannelNumber];
+    TIM_TypeDef* tim = GetChannelTIM(cfg->Channel);
+    uint8 timerIdx = cfg->Channel / PWM_CHANNELS_PER_TIMER;
+    if (tim == NULL_PTR || Pwm_WaveformChannel[timerIdx] != ChannelNumber) {
+        return; // Not streaming
+    }
+
+    TIM_DMACmd(tim, TIM_DMA_Update, DISABLE);
+    Dma_ReleaseChannel(Pwm_UpdateDmaNum[timerIdx]);
+    Pwm_WaveformChannel[timerIdx] = 0xFF;
+}
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Pwm_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return; // Invalid pointer
+    }
+
+    versioninfo->vendorID = PWM_VENDOR_ID;
+    versioninfo->moduleID = PWM_MODULE_ID;
+    versioninfo->sw_major_version = PWM_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = PWM_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = PWM_SW_PATCH_VERSION;
+}
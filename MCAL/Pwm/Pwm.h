@@ -9,11 +9,14 @@
 #define PWM_H
 
 #define MAX_PWM_CHANNELS 16 // Maximum number of PWM channels supported
+#define PWM_NUM_TIMERS          4   // TIM1..TIM4
+#define PWM_CHANNELS_PER_TIMER  4   // CC1..CC4 per timer
 
 #include "Std_Types.h"
 #include "stm32f10x_tim.h"
 #include "stm32f10x_rcc.h"
-#include "stm32f10x_dma.h"
+#include "Dma.h"
+#include "Gpt.h"
 #include "stm32f10x_gpio.h"
 #include "Port.h"
 #include "Dio.h"
@@ -57,11 +60,20 @@ typedef enum {
     PWM_FIXED_PERIOD = 0x01,            /**< The PWM channel has a fixed period. Only the duty cycle can be changed. */
 } Pwm_ChannelClassType;
 
+/** Repeat mode of a DMA waveform */
+typedef enum {
+    PWM_WAVEFORM_ONESHOT = 0x00,        /**< Play the buffer once, then keep the last compare values */
+    PWM_WAVEFORM_CIRCULAR = 0x01,       /**< Restart from the first sample after the last one */
+} Pwm_WaveformModeType;
+
 typedef enum {
     PWM_NOTIFICATION_OFF = 0x00, /**< No notification */
     PWM_NOTIFICATION_ON = 0x01, /**< Notification enabled */
 } Pwm_NotificationType;
 
+/** Callback type of a PWM edge notification */
+typedef void (*Pwm_NotificationCbType)(void);
+
 /** 
  * @brief Configuration structure for a PWM channel
  */
@@ -74,6 +86,10 @@ typedef struct {
     Pwm_OutputStateType idleState;          /**< Idle state of the PWM channel output */
     Pwm_NotificationType NotificationEnable;/**< Enable notification for the PWM channel */
     void (*NotificationCb)(void);           /**< Callback to the notification function */
+    Pwm_NotificationCbType RisingEdgeCb;    /**< Optional rising edge callback (NULL: use NotificationCb) */
+    Pwm_NotificationCbType FallingEdgeCb;   /**< Optional falling edge callback (NULL: use NotificationCb) */
+    Pwm_NotificationCbType WaveformHalfCb;  /**< Waveform playback passed half of the buffer (NULL: none) */
+    Pwm_NotificationCbType WaveformCompleteCb; /**< Waveform playback reached the end of the buffer (NULL: none) */
 } Pwm_ChannelConfigType;
 
 
@@ -85,9 +101,36 @@ typedef struct {
     uint8 numChannels;                          /**< Number of PWM channels configured */
 } Pwm_ConfigType;
 
+/**
+ * @brief ISR jump table of one timer
+ * @details Filled by Pwm_EnableNotification/Pwm_DisableNotification, so the
+ *          timer ISR only indexes this table with the pending SR bits.
+ */
+typedef struct {
+    Pwm_NotificationCbType UpdateCb[PWM_CHANNELS_PER_TIMER]; /**< Edge at period start (update event), per CC slot */
+    Pwm_NotificationCbType CcCb[PWM_CHANNELS_PER_TIMER];     /**< Edge at compare match (CCx event), per CC slot */
+    uint8_t UpdateMask;                                      /**< CC slots with an update edge callback */
+    uint8_t CcMask;                                          /**< CC slots with a compare edge callback */
+} Pwm_TimerIsrTableType;
+
+/** Interrupt sources handled by Pwm_IrqDispatch (same bit layout as TIMx_SR/DIER) */
+#define PWM_IRQ_SRC_UPDATE  ((uint16_t)TIM_IT_Update)
+#define PWM_IRQ_SRC_CC      ((uint16_t)(TIM_IT_CC1 | TIM_IT_CC2 | TIM_IT_CC3 | TIM_IT_CC4))
+#define PWM_IRQ_SRC_ALL     ((uint16_t)(PWM_IRQ_SRC_UPDATE | PWM_IRQ_SRC_CC))
+
 extern const Pwm_ConfigType* Pwm_CurrentConfigPtr;
 TIM_TypeDef* GetChannelTIM(Pwm_ChannelType ch);
 
+/**
+ * @brief Dispatches the pending interrupt sources of one timer.
+ * @param TimerIdx Timer index (0 = TIM1 .. 3 = TIM4).
+ * @param SourceMask Sources this vector is responsible for (PWM_IRQ_SRC_*).
+ * @details Called from the timer ISRs in Pwm_Cfg.c. Reads SR once, clears only
+ *          what it handles and calls the jump table entries of the pending slots.
+ *          Runs from RAM in RAMFUNC=1 builds.
+ */
+RAMFUNC void Pwm_IrqDispatch(uint8_t TimerIdx, uint16_t SourceMask);
+
 /**
  * @brief Initializes the PWM driver with the given configuration.
  * @param ConfigPtr Pointer to the configuration structure.
@@ -126,6 +169,13 @@ void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
  */
 Pwm_OutputStateType Pwm_GetOutputState(Pwm_ChannelType ChannelNumber);
 
+/**
+ * @brief Time of the last edge interrupt of the channel's timer (timebase us, 0 = none yet).
+ * @param ChannelNumber The PWM channel.
+ * @details Called from an edge notification it returns the time of that edge.
+ */
+Gpt_TimestampType Pwm_GetEdgeTimestamp(Pwm_ChannelType ChannelNumber);
+
 /**
  * @brief Service to disable the PWM signal edge notification
  * @param ChannelNumber The PWM channel to disable notification for.
@@ -139,6 +189,27 @@ void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber);
  */
 void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification);
 
+/**
+ * @brief Plays a buffer of compare values into one or more CCR registers by DMA.
+ * @param ChannelNumber First PWM channel; its CC slot is the first register of the burst.
+ * @param NumCcr Number of consecutive CCR registers of the same timer updated per period (1-4).
+ * @param Buffer Interleaved compare values, NumCcr per sample (must stay valid while playing).
+ * @param NumSamples Number of samples (periods) in Buffer.
+ * @param Mode One-shot or circular repeat.
+ * @return E_OK if playback started, E_NOT_OK on invalid arguments or if the DMA channel is owned elsewhere.
+ * @details Each update event triggers a TIMx_DMAR burst of NumCcr transfers, so the
+ *          CPU is not involved per sample. Half/complete callbacks of ChannelNumber
+ *          are called from the DMA interrupt. The DMA channel is requested from the
+ *          DMA driver (Dma_Init must have run) and released by Pwm_StopWaveform.
+ */
+Std_ReturnType Pwm_StartWaveform(Pwm_ChannelType ChannelNumber, uint8_t NumCcr, const uint16_t* Buffer, uint16_t NumSamples, Pwm_WaveformModeType Mode);
+
+/**
+ * @brief Stops a DMA waveform; the CCR registers keep their last values.
+ * @param ChannelNumber The PWM channel passed to Pwm_StartWaveform.
+ */
+void Pwm_StopWaveform(Pwm_ChannelType ChannelNumber);
+
 /**
  * @brief Service returns the version information of this module.
  */
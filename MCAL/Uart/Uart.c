@@ -0,0 +1,216 @@
+/*
+ * Uart.c
+ * USART1 transmit driver implementation for STM32F103C8
+ */
+
+#include "Uart.h"
+#include "Mcu.h"
+#include <stddef.h>
+
+#define UART_TX_MASK   ((uint16_t)(UART_TX_BUFFER_SIZE - 1U))
+
+#if (UART_TX_BUFFER_SIZE & (UART_TX_BUFFER_SIZE - 1U)) != 0 || UART_TX_BUFFER_SIZE > 32768U
+#error "UART_TX_BUFFER_SIZE must be a power of two not larger than 32768"
+#endif
+
+static uint8_t Uart_TxBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint16_t Uart_TxHead = 0;       /* Free-running; end of the published bytes */
+static volatile uint16_t Uart_TxReserve = 0;    /* Free-running; end of the space handed to writers */
+static volatile uint16_t Uart_TxTail = 0;       /* Free-running; written by the DMA notification only */
+static volatile uint16_t Uart_TxInFlight = 0;   /* Bytes of the running DMA transfer, 0 = idle */
+static volatile uint8_t Uart_Writers = 0;       /* Uart_Write calls between reservation and publication */
+static volatile uint32_t Uart_Dropped = 0;
+static uint8_t Uart_Initialized = 0;
+
+static const char Uart_HexDigits[16] = "0123456789ABCDEF";
+
+/**
+ * @brief Starts DMA on the next contiguous chunk of the ring if the channel is idle.
+ * @details Runs with interrupts masked or from the DMA notification.
+ */
+static void Uart_StartTx(void) {
+    uint16_t tail = Uart_TxTail;
+    uint16_t used = (uint16_t)(Uart_TxHead - tail);
+    if (Uart_TxInFlight != 0U || used == 0U) {
+        return;
+    }
+    uint16_t idx = tail & UART_TX_MASK;
+    uint16_t chunk = (uint16_t)(UART_TX_BUFFER_SIZE - idx);    // Up to the end of the ring
+    if (chunk > used) {
+        chunk = used;
+    }
+    Uart_TxInFlight = chunk;
+    Dma_Start(UART_TX_DMA_CHANNEL, (uint32_t)&Uart_TxBuffer[idx], (uint32_t)&USART1->DR, chunk);
+}
+
+/* DMA1 Channel4 transfer complete (or error): free the chunk and send the next one */
+static void Uart_TxDmaNotification(Dma_ChannelType Channel, Dma_EventType Events) {
+    (void)Channel;
+    (void)Events;   // On a transfer error the chunk is lost, the ring keeps going
+    Uart_TxTail = (uint16_t)(Uart_TxTail + Uart_TxInFlight);
+    Uart_TxInFlight = 0;
+    Uart_StartTx();
+}
+
+Std_ReturnType Uart_Init(const Uart_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR) {
+        return E_NOT_OK;
+    }
+
+    Dma_ChannelConfigType dcfg = {
+        .Direction    = DMA_DIR_MEM_TO_PERIPH,
+        .Mode         = DMA_MODE_NORMAL,
+        .Priority     = DMA_PRIORITY_LOW,
+        .PeriphWidth  = DMA_WIDTH_8,
+        .MemWidth     = DMA_WIDTH_8,
+        .PeriphInc    = 0,
+        .MemInc       = 1,
+        .Events       = (Dma_EventType)(DMA_EVENT_TC | DMA_EVENT_TE),
+        .Notification = Uart_TxDmaNotification
+    };
+    if (Uart_Initialized) {
+        // Re-init after a clock switch: the channel and the clock reference are kept,
+        // the chunk in flight is dropped with the rest of the ring
+        Dma_Stop(UART_TX_DMA_CHANNEL);
+    } else {
+        Dma_ChannelType ch = UART_TX_DMA_CHANNEL;
+        if (Dma_RequestChannel(&ch, &dcfg) != E_OK) {
+            return E_NOT_OK;
+        }
+        (void)Mcu_EnablePeripheral(MCU_PERIPH_USART1);
+    }
+
+    // 8N1, 16x oversampling: BRR = PCLK2 / baud (mantissa.fraction in 1/16)
+    uint32_t pclk2 = Mcu_GetClockFreq(MCU_CLK_PCLK2);
+    USART1->CR1 = 0;
+    USART1->CR2 = 0;
+    USART1->CR3 = USART_CR3_DMAT;      // TXE raises the DMA request
+    USART1->BRR = (uint16_t)((pclk2 + ConfigPtr->BaudRate / 2U) / ConfigPtr->BaudRate);
+    USART1->CR1 = USART_CR1_UE | USART_CR1_TE | USART_CR1_RE;
+
+    Uart_TxHead = 0;
+    Uart_TxReserve = 0;
+    Uart_TxTail = 0;
+    Uart_TxInFlight = 0;
+    Uart_Writers = 0;
+    Uart_Dropped = 0;
+    Uart_Initialized = 1;
+    return E_OK;
+}
+
+void Uart_DeInit(void) {
+    if (!Uart_Initialized) {
+        return;
+    }
+    Uart_Initialized = 0;
+    Dma_ReleaseChannel(UART_TX_DMA_CHANNEL);
+    USART1->CR3 = 0;
+    USART1->CR1 = 0;
+    (void)Mcu_DisablePeripheral(MCU_PERIPH_USART1);
+}
+
+uint16_t Uart_Write(const uint8_t* Data, uint16_t Length) {
+    if (!Uart_Initialized || Data == NULL_PTR || Length == 0U) {
+        return 0;
+    }
+
+    // 1) Reserve the space; the copy itself runs with interrupts enabled
+    uint32_t primask = Compiler_EnterCritical();
+    uint16_t head = Uart_TxReserve;
+    uint16_t space = (uint16_t)(UART_TX_BUFFER_SIZE - (uint16_t)(head - Uart_TxTail));
+    if (Length > space) {
+        Uart_Dropped++;
+        Compiler_ExitCritical(primask);
+        return 0; // Whole message dropped, never a truncated line
+    }
+    Uart_TxReserve = (uint16_t)(head + Length);
+    Uart_Writers++;
+    Compiler_ExitCritical(primask);
+
+    // 2) Copy in at most two pieces around the end of the ring
+    uint16_t idx = head & UART_TX_MASK;
+    uint16_t first = (uint16_t)(UART_TX_BUFFER_SIZE - idx);
+    if (first > Length) {
+        first = Length;
+    }
+    for (uint16_t i = 0; i < first; i++) {
+        Uart_TxBuffer[idx + i] = Data[i];
+    }
+    for (uint16_t i = first; i < Length; i++) {
+        Uart_TxBuffer[i - first] = Data[i];
+    }
+
+    // 3) Publish: writers that preempted another one finish first and leave it to
+    //    the interrupted writer, whose copy lies before theirs in the ring
+    primask = Compiler_EnterCritical();
+    if (--Uart_Writers == 0U) {
+        Uart_TxHead = Uart_TxReserve;
+        Uart_StartTx();
+    }
+    Compiler_ExitCritical(primask);
+    return Length;
+}
+
+uint16_t Uart_GetFree(void) {
+    return (uint16_t)(UART_TX_BUFFER_SIZE - (uint16_t)(Uart_TxReserve - Uart_TxTail));
+}
+
+uint32_t Uart_GetDropped(void) {
+    return Uart_Dropped;
+}
+
+void Uart_Flush(void) {
+    if (!Uart_Initialized) {
+        return;
+    }
+    while (Uart_TxTail != Uart_TxHead) { }
+    while (!(USART1->SR & USART_SR_TC)) { }
+}
+
+char* Uart_FmtStr(char* Dst, const char* Str) {
+    while (*Str) {
+        *Dst++ = *Str++;
+    }
+    return Dst;
+}
+
+char* Uart_FmtHex8(char* Dst, uint8_t Value) {
+    Dst[0] = Uart_HexDigits[Value >> 4];
+    Dst[1] = Uart_HexDigits[Value & 0x0FU];
+    return Dst + 2;
+}
+
+char* Uart_FmtHex16(char* Dst, uint16_t Value) {
+    Dst = Uart_FmtHex8(Dst, (uint8_t)(Value >> 8));
+    return Uart_FmtHex8(Dst, (uint8_t)Value);
+}
+
+char* Uart_FmtHex32(char* Dst, uint32_t Value) {
+    Dst = Uart_FmtHex16(Dst, (uint16_t)(Value >> 16));
+    return Uart_FmtHex16(Dst, (uint16_t)Value);
+}
+
+char* Uart_FmtDec(char* Dst, uint32_t Value) {
+    char tmp[10];
+    uint8_t n = 0;
+    do {
+        tmp[n++] = (char)('0' + (Value % 10U));     // UDIV: a few cycles per digit on the M3
+        Value /= 10U;
+    } while (Value != 0U);
+    while (n) {
+        *Dst++ = tmp[--n];
+    }
+    return Dst;
+}
+
+void Uart_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return; // Invalid pointer
+    }
+
+    versioninfo->vendorID = UART_VENDOR_ID;
+    versioninfo->moduleID = UART_MODULE_ID;
+    versioninfo->sw_major_version = UART_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = UART_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = UART_SW_PATCH_VERSION;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file    Uart.h
+ * @brief   USART1 transmit driver (DMA-drained ring buffer) for STM32F103C8
+ * @version 1.0
+ * @date    2025
+ *
+ * Uart_Write copies a complete message into a RAM ring and returns; DMA1
+ * Channel4 (USART1_TX request) drains the ring in the background, one
+ * contiguous chunk per transfer, restarted from its transfer-complete
+ * notification. Writers never wait for the line: a message that does not
+ * fit is dropped whole and counted. The cost of a write is the copy of the
+ * message, so logging from an ISR is bounded.
+ *
+ * Writers in any interrupt context share the ring: a short PRIMASK section
+ * reserves the space of a message, the copy runs with interrupts enabled and
+ * a second short section publishes the head. The last writer to finish
+ * publishes for all, so a message written by an ISR that preempted another
+ * writer goes out after that writer's message, never interleaved with it.
+ * The tail is only written by the DMA notification.
+ *
+ * The Uart_Fmt* helpers append text to a caller buffer so a line can be
+ * assembled on the stack and handed to Uart_Write in one call.
+ */
+
+#ifndef UART_H
+#define UART_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+#include "stm32f10x_rcc.h"
+#include "Dma.h"
+
+#define UART_VENDOR_ID         1234
+#define UART_MODULE_ID         254
+#define UART_SW_MAJOR_VERSION  1
+#define UART_SW_MINOR_VERSION  0
+#define UART_SW_PATCH_VERSION  0
+
+/** Transmit ring size in bytes; must be a power of two (at most 32768) */
+#ifndef UART_TX_BUFFER_SIZE
+#define UART_TX_BUFFER_SIZE    512U
+#endif
+
+#define UART_TX_DMA_CHANNEL    4U   /* DMA1 request mapping: USART1_TX */
+
+/**
+ * @brief Configuration of the UART driver
+ * @details TX/RX pins are configured by the application (PA9 AF push-pull, PA10 input).
+ */
+typedef struct {
+    uint32_t BaudRate;      /**< e.g. 115200 (8N1) */
+} Uart_ConfigType;
+
+/**
+ * @brief Initializes USART1 for 8N1 and claims DMA1 Channel4 for transmission.
+ * @details Called again after a clock switch, it recomputes the baud rate from the new PCLK2
+ *          and keeps the channel; queued output is discarded.
+ * @param ConfigPtr Pointer to the configuration structure.
+ * @return E_OK, or E_NOT_OK if the channel is owned by another driver (Dma_Init must run first).
+ */
+Std_ReturnType Uart_Init(const Uart_ConfigType* ConfigPtr);
+
+/**
+ * @brief Stops transmission, releases the DMA channel and disables USART1.
+ */
+void Uart_DeInit(void);
+
+/**
+ * @brief Queues a message for transmission.
+ * @param Data Bytes to send.
+ * @param Length Number of bytes.
+ * @return Length if queued, 0 if the message did not fit and was dropped.
+ * @details Callable from any context; never waits for the line.
+ */
+uint16_t Uart_Write(const uint8_t* Data, uint16_t Length);
+
+/**
+ * @brief Returns the number of bytes Uart_Write can take right now.
+ * @details Lets a writer size a batch instead of having it dropped.
+ */
+uint16_t Uart_GetFree(void);
+
+/**
+ * @brief Returns the number of messages dropped because the ring was full.
+ */
+uint32_t Uart_GetDropped(void);
+
+/**
+ * @brief Waits until every queued byte has left the shift register.
+ * @details For use before reset or low-power entry; do not call with interrupts masked.
+ */
+void Uart_Flush(void);
+
+/**
+ * @brief Appends a NUL-terminated string (without the NUL).
+ * @return Pointer behind the last written character.
+ */
+char* Uart_FmtStr(char* Dst, const char* Str);
+
+/**
+ * @brief Appends 2 upper-case hex digits.
+ * @return Pointer behind the last written character.
+ */
+char* Uart_FmtHex8(char* Dst, uint8_t Value);
+
+/**
+ * @brief Appends 4 upper-case hex digits.
+ * @return Pointer behind the last written character.
+ */
+char* Uart_FmtHex16(char* Dst, uint16_t Value);
+
+/**
+ * @brief Appends 8 upper-case hex digits.
+ * @return Pointer behind the last written character.
+ */
+char* Uart_FmtHex32(char* Dst, uint32_t Value);
+
+/**
+ * @brief Appends an unsigned decimal number without leading zeros (at most 10 digits).
+ * @return Pointer behind the last written character.
+ */
+char* Uart_FmtDec(char* Dst, uint32_t Value);
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Uart_GetVersionInfo(Std_VersionInfoType* versioninfo);
+
+#endif /* UART_H */
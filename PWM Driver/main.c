@@ -7,7 +7,7 @@
 #include "Pwm.h"
 
 /* Port (PA0) */
-Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
+Port_PinConfigType PortCfg_Pins[] = {
     {
       .PortNum           = PORT_ID_A,
       .PinNum            = 0,
@@ -34,7 +34,7 @@ Pwm_ChannelConfigType Pwm_Channels[] = {
       .compareValue   = SERVO_CENTER_PULSE_US,
       .polarity       = PWM_HIGH,
       .idleState      = PWM_HIGH,
-      .Notification   = NULL
+      .NotificationCb = NULL
     }
 };
 const Pwm_ConfigType PwmCfg = {
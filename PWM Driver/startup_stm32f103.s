@@ -77,7 +77,7 @@ Default_Handler:
     .weak   Reset_Handler
     .type   Reset_Handler, %function
 Reset_Handler:
-    /* 1/ Copy .data từ Flash sang RAM */
+    /* 1/ Copy .data (kể cả code .ramfunc) từ Flash sang RAM */
     LDR   R0, =_sidata      /* _sidata = địa chỉ đầu của vùng gốc .data trong Flash */
     LDR   R1, =_sdata       /* _sdata = địa chỉ đầu vùng .data trong RAM */
     LDR   R2, =_edata       /* _edata = địa chỉ kết thúc vùng .data trong RAM */
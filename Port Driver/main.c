@@ -26,7 +26,7 @@ void delay_ms(TIM_TypeDef *TIM_Struct,uint16_t time){
 }
 
 
-Port_PinConfigType PortCfg_Pins[PIN_COUNT] = {
+Port_PinConfigType PortCfg_Pins[] = {
 	{
 	.PinNum = 13,				// Pin 45 corresponds to PC13
 	.Mode = PORT_PIN_MODE_DIO,
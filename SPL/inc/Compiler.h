@@ -0,0 +1,69 @@
+#ifndef COMPILER_H
+#define COMPILER_H
+
+#include <stdint.h>
+
+/* ===========================================================================================
+ * Code Placement
+ * =========================================================================================== */
+/*********************************************************************************************
+ * @brief        Execute a function from RAM
+ * @details      At 72 MHz the flash needs 2 wait states; RAMFUNC moves a time-critical
+ *               function (ISR hot path) to the .ramfunc section, which the linker script
+ *               places in RAM and the startup code copies from flash together with .data.
+ *               - noinline: the body must stay in its own section, not be inlined into
+ *                 a caller in flash
+ *               - long_call: RAM (0x20000000) is out of BL range from flash (0x08000000);
+ *                 callers that see the declaration load the address instead of needing
+ *                 a linker veneer
+ *               Calls from a RAM function to flash functions go through linker veneers.
+ *               Build with RAMFUNC_ENABLE=1 (make RAMFUNC=1); otherwise RAMFUNC is empty
+ *               and everything stays in flash, so both builds can be timed and the
+ *               RAM cost compared in the map report.
+ *********************************************************************************************/
+
+#ifndef RAMFUNC_ENABLE
+    #define RAMFUNC_ENABLE                      0
+#endif
+
+#if RAMFUNC_ENABLE
+    #define RAMFUNC                             __attribute__((section(".ramfunc"), noinline, long_call))
+#else
+    #define RAMFUNC
+#endif
+
+/* ===========================================================================================
+ * Critical Sections
+ * =========================================================================================== */
+/*********************************************************************************************
+ * @brief        Mask interrupts and return the previous PRIMASK
+ * @details      Compiler_ExitCritical restores the saved mask instead of unmasking, so a
+ *               critical section nests inside another one or inside code already running
+ *               with PRIMASK set. PRIMASK is read directly: the bundled CMSIS only declares
+ *               __get_PRIMASK for GCC, and this header is included before the device header.
+ *               Host builds (Host/) run interrupts between calls, never in the middle of
+ *               one, so both functions are empty there.
+ *********************************************************************************************/
+
+static inline uint32_t Compiler_EnterCritical(void) {
+    uint32_t primask = 0U;
+#if defined(__arm__)
+    __asm volatile ("MRS %0, primask" : "=r" (primask));
+    __asm volatile ("cpsid i" : : : "memory");
+#endif
+    return primask;
+}
+
+/*********************************************************************************************
+ * @brief        Restore the PRIMASK returned by Compiler_EnterCritical
+ *********************************************************************************************/
+
+static inline void Compiler_ExitCritical(uint32_t primask) {
+#if defined(__arm__)
+    __asm volatile ("MSR primask, %0" : : "r" (primask) : "memory");
+#else
+    (void)primask;
+#endif
+}
+
+#endif /* COMPILER_H */
@@ -0,0 +1,39 @@
+#ifndef DWT_H
+#define DWT_H
+
+/* ===========================================================================================
+ * Includes
+ * =========================================================================================== */
+#include "stm32f10x.h"
+
+/* ===========================================================================================
+ * DWT Cycle Counter
+ * =========================================================================================== */
+/*********************************************************************************************
+ * @brief        Cortex-M3 DWT cycle counter registers
+ * @details      The bundled CMSIS (core_cm3.h V1.30) has no DWT definitions, so the
+ *               registers used for CYCCNT are declared here once for the drivers (Trace,
+ *               Sched, Boot) and the benchmarks. DEMCR is spelled out too (CoreDebug->DEMCR
+ *               in CMSIS) so host builds of Trace.h need no core header.
+ *               CYCCNT counts core clock cycles and wraps after 2^32 (59.6 s at 72 MHz).
+ *               It stops while the core sleeps (WFI/WFE, STOP), so it times code that runs,
+ *               not wall-clock time; use Gpt_GetTimestamp for that.
+ *********************************************************************************************/
+
+#define DWT_CTRL                            (*(volatile uint32_t *)0xE0001000U)
+#define DWT_CYCCNT                          (*(volatile uint32_t *)0xE0001004U)
+#define DWT_CTRL_CYCCNTENA                  (1UL << 0)
+
+#define DEMCR                               (*(volatile uint32_t *)0xE000EDFCU)
+#define DEMCR_TRCENA                        (1UL << 24)
+
+/*********************************************************************************************
+ * @brief        Enable the trace block and start CYCCNT (the count is not reset)
+ *********************************************************************************************/
+
+static inline void Dwt_StartCycleCounter(void) {
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+#endif /* DWT_H */
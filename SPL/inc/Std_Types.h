@@ -5,6 +5,7 @@
  * Includes
  * =========================================================================================== */
 #include <stdint.h>
+#include "Compiler.h"
 
 /* ===========================================================================================
  * Software version number definitions
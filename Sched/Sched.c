@@ -0,0 +1,470 @@
+/*
+ * Sched.c
+ * Cooperative time-triggered scheduler implementation
+ */
+
+#include "Sched.h"
+#include "Trace.h"
+#include "Mcu.h"
+#include "Dwt.h"
+
+static const Sched_ConfigType* Sched_ConfigPtr = NULL_PTR;
+static volatile uint32_t Sched_TickCount = 0;
+static volatile uint32_t Sched_Ready = 0;           /* Bit i: task i released, not yet run */
+static uint8_t Sched_Started = 0;
+static uint16_t Sched_Offset[SCHED_MAX_TASKS];
+static uint16_t Sched_Countdown[SCHED_MAX_TASKS];   /* Ticks until the next release */
+static Sched_TaskStatsType Sched_Stats[SCHED_MAX_TASKS];
+static uint32_t Sched_CyclesPerTick = 0;
+
+/* Idle */
+static uint32_t Sched_SleptMs = 0;
+static volatile uint8_t Sched_StopInhibit = 0;
+static uint8_t Sched_RtcReady = 0;                 /* LSE and RTC running: STOP mode can be woken */
+static uint8_t Sched_RtcClocksHeld = 0;            /* PWR/BKP clocks referenced (Sched_Init may run again after a clock switch) */
+static uint32_t Sched_RtcRemainder = 0;             /* Sub-ms RTC time carried between STOP periods (ms * 1024 units) */
+
+/* CPU load: task cycles over SCHED_LOAD_WINDOW_MS (measured in ticks: CYCCNT stops in STOP) */
+static uint32_t Sched_BusyCycles = 0;
+static uint32_t Sched_WindowTick = 0;
+static uint16_t Sched_Load = 0;
+
+static boolean Sched_RtcInit(void);
+
+static uint32_t Sched_Gcd(uint32_t a, uint32_t b) {
+    while (b != 0U) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/**
+ * @brief Gives every SCHED_OFFSET_AUTO task the offset with the lowest peak load.
+ * @details The load of a tick is the WCET sum of the tasks already placed that
+ *          are released on it, evaluated over one hyperperiod. Fixed offsets are
+ *          placed first, auto tasks in table order.
+ */
+static void Sched_PlaceOffsets(const Sched_ConfigType* cfg) {
+    uint32_t hyper = 1;
+    uint32_t placed = 0;
+
+    for (uint8_t i = 0; i < cfg->NumTasks; i++) {
+        uint32_t p = cfg->Tasks[i].PeriodMs;
+        hyper = (hyper / Sched_Gcd(hyper, p)) * p;
+        if (hyper > SCHED_MAX_HYPERPERIOD) {
+            hyper = SCHED_MAX_HYPERPERIOD;  // Approximation for unusual period sets
+        }
+        if (cfg->Tasks[i].OffsetMs != SCHED_OFFSET_AUTO) {
+            Sched_Offset[i] = cfg->Tasks[i].OffsetMs;
+            placed |= 1UL << i;
+        }
+    }
+
+    for (uint8_t i = 0; i < cfg->NumTasks; i++) {
+        if (placed & (1UL << i)) continue;
+        uint16_t period = cfg->Tasks[i].PeriodMs;
+        uint16_t best = 0;
+        uint32_t bestPeak = 0xFFFFFFFFUL;
+
+        for (uint16_t o = 0; o < period && bestPeak != 0U; o++) {
+            uint32_t peak = 0;
+            for (uint32_t t = o; t < hyper; t += period) {
+                uint32_t load = 0;
+                for (uint8_t j = 0; j < cfg->NumTasks; j++) {
+                    if ((placed & (1UL << j)) && (t % cfg->Tasks[j].PeriodMs) == Sched_Offset[j]) {
+                        load += cfg->Tasks[j].WcetCycles ? cfg->Tasks[j].WcetCycles : 1U;
+                    }
+                }
+                if (load > peak) peak = load;
+            }
+            if (peak < bestPeak) {
+                bestPeak = peak;
+                best = o;
+            }
+        }
+        Sched_Offset[i] = best;
+        placed |= 1UL << i;
+    }
+}
+
+Std_ReturnType Sched_Init(const Sched_ConfigType* ConfigPtr) {
+    if (ConfigPtr == NULL_PTR || ConfigPtr->Tasks == NULL_PTR || ConfigPtr->NumTasks > SCHED_MAX_TASKS) {
+        return E_NOT_OK;
+    }
+    for (uint8_t i = 0; i < ConfigPtr->NumTasks; i++) {
+        const Sched_TaskConfigType* t = &ConfigPtr->Tasks[i];
+        if (t->Task == NULL_PTR || t->PeriodMs == 0U ||
+            (t->OffsetMs != SCHED_OFFSET_AUTO && t->OffsetMs >= t->PeriodMs)) {
+            return E_NOT_OK;
+        }
+    }
+
+    Sched_Started = 0;
+    Sched_Ready = 0;
+    Sched_ConfigPtr = ConfigPtr;
+    Sched_PlaceOffsets(ConfigPtr);
+    for (uint8_t i = 0; i < ConfigPtr->NumTasks; i++) {
+        Sched_Stats[i] = (Sched_TaskStatsType){ 0 };
+        Sched_Stats[i].OffsetMs = Sched_Offset[i];
+    }
+
+    Dwt_StartCycleCounter();
+    Sched_SleptMs = 0;
+    Sched_RtcReady = 0;
+    if (ConfigPtr->IdleMode == SCHED_IDLE_STOP) {
+        Sched_RtcReady = Sched_RtcInit();
+    }
+    Sched_CyclesPerTick = SystemCoreClock / SCHED_TICK_HZ;
+    SysTick_Config(Sched_CyclesPerTick);   // Lowest priority: never delays driver ISRs
+    return E_OK;
+}
+
+void Sched_Start(void) {
+    if (Sched_ConfigPtr == NULL_PTR) {
+        return;
+    }
+    uint32_t primask = Compiler_EnterCritical();
+    for (uint8_t i = 0; i < Sched_ConfigPtr->NumTasks; i++) {
+        Sched_Countdown[i] = (uint16_t)(Sched_Offset[i] + 1U);  // Offset 0: first tick
+    }
+    Sched_Ready = 0;
+    Sched_WindowTick = Sched_TickCount;
+    Sched_BusyCycles = 0;
+    Sched_Started = 1;
+    Compiler_ExitCritical(primask);
+}
+
+void Sched_Tick(void) {
+    Sched_TickCount++;
+    if (!Sched_Started) {
+        return;
+    }
+
+    const Sched_TaskConfigType* tasks = Sched_ConfigPtr->Tasks;
+    uint32_t ready = Sched_Ready;
+    for (uint8_t i = 0; i < Sched_ConfigPtr->NumTasks; i++) {
+        if (--Sched_Countdown[i] == 0U) {
+            Sched_Countdown[i] = tasks[i].PeriodMs;
+            if (ready & (1UL << i)) {
+                Sched_Stats[i].Overruns++;  // Previous release still pending: this one is lost
+            }
+            ready |= 1UL << i;
+        }
+    }
+    Sched_Ready = ready;
+}
+
+/* Closes the load window once SCHED_LOAD_WINDOW_MS have passed */
+static void Sched_UpdateLoad(void) {
+    uint32_t now = Sched_TickCount;
+    uint32_t ticks = now - Sched_WindowTick;
+    if (ticks < SCHED_LOAD_WINDOW_MS) {
+        return;
+    }
+    uint32_t per_mille = (ticks * (Sched_CyclesPerTick / 100U)) / 10U;
+    Sched_Load = (uint16_t)(per_mille ? (Sched_BusyCycles / per_mille) : 0U);
+    Sched_BusyCycles = 0;
+    Sched_WindowTick = now;
+}
+
+/**
+ * @brief Adds ticks that passed without SysTick interrupts.
+ * @details Runs with interrupts masked; Ticks is below every countdown, so no release is skipped.
+ */
+static void Sched_Advance(uint32_t Ticks) {
+    Sched_TickCount += Ticks;
+    Sched_SleptMs += Ticks;
+    for (uint8_t i = 0; i < Sched_ConfigPtr->NumTasks; i++) {
+        Sched_Countdown[i] = (uint16_t)(Sched_Countdown[i] - Ticks);
+    }
+}
+
+/* Ticks until the next release (1 = at the next tick boundary) */
+static uint32_t Sched_NextRelease(void) {
+    uint32_t next = 0xFFFFU;
+    for (uint8_t i = 0; i < Sched_ConfigPtr->NumTasks; i++) {
+        if (Sched_Countdown[i] < next) next = Sched_Countdown[i];
+    }
+    return next;
+}
+
+/**
+ * @brief WFI with SysTick stretched over Skip tick periods.
+ * @details Interrupts are masked: a wakeup interrupt runs after the time base is corrected.
+ */
+static void Sched_SleepTickless(uint32_t Skip) {
+    uint32_t cpt = Sched_CyclesPerTick;
+    uint32_t maxSkip = (SysTick_LOAD_RELOAD_Msk / cpt) - 1U;   // 24-bit counter: ~232 ms at 72 MHz
+    if (Skip > maxSkip) Skip = maxSkip;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t cur = SysTick->VAL;    // Cycles to the next tick boundary
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) || cur == 0U) {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;  // Tick already due: plain sleep
+        __WFI();
+        return;
+    }
+
+    // Boundaries at cur, cur + cpt, ... ; stop at the one that releases a task
+    uint32_t total = cur + Skip * cpt;
+    SysTick->LOAD = total - 1U;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __WFI();
+    uint32_t ctrl = SysTick->CTRL;  // Reading clears COUNTFLAG
+    SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+    uint32_t toNext;
+    if (ctrl & SysTick_CTRL_COUNTFLAG_Msk) {
+        Sched_Advance(Skip);        // The pending SysTick counts the last boundary
+        toNext = cpt;
+    } else {
+        // Woken early: count the boundaries passed, keep the tick phase
+        uint32_t left = SysTick->VAL;
+        uint32_t elapsed = total - left;
+        Sched_Advance((elapsed >= cur) ? 1U + (elapsed - cur) / cpt : 0U);
+        toNext = left % cpt;
+        if (toNext == 0U) toNext = cpt;
+    }
+    SysTick->LOAD = toNext - 1U;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    SysTick->LOAD = cpt - 1U;       // Used from the next reload on
+}
+
+/* Start of an LSE/RTC wait exceeded SCHED_LSE_TIMEOUT_MS (DWT: SysTick is not running during these waits) */
+static boolean Sched_LseTimedOut(uint32_t Start) {
+    return (DWT_CYCCNT - Start) > (SystemCoreClock / 1000U) * SCHED_LSE_TIMEOUT_MS;
+}
+
+/**
+ * @brief Backup domain: LSE -> RTC at SCHED_RTC_HZ, alarm on EXTI line 17 (rising).
+ * @return FALSE if the LSE or the RTC did not respond in time; the alarm is then not enabled.
+ * @details All waits depend on the LSE: RSF and RTOFF follow the RTC clock, also when the
+ *          RTC was already enabled by a previous run.
+ */
+static boolean Sched_RtcInit(void) {
+    uint32_t start = DWT_CYCCNT;
+    if (!Sched_RtcClocksHeld) {
+        (void)Mcu_EnablePeripheral(MCU_PERIPH_PWR);
+        (void)Mcu_EnablePeripheral(MCU_PERIPH_BKP);
+        Sched_RtcClocksHeld = 1;
+    }
+    PWR->CR |= PWR_CR_DBP;
+    if (!(RCC->BDCR & RCC_BDCR_RTCEN)) {
+        RCC->BDCR |= RCC_BDCR_LSEON;
+        while (!(RCC->BDCR & RCC_BDCR_LSERDY)) {
+            if (Sched_LseTimedOut(start)) {
+                RCC->BDCR &= ~RCC_BDCR_LSEON;   // No crystal: do not leave the driver running
+                return FALSE;
+            }
+        }
+        RCC->BDCR |= RCC_BDCR_RTCSEL_LSE | RCC_BDCR_RTCEN;
+    }
+    RTC->CRL &= (uint16_t)~RTC_CRL_RSF;
+    while (!(RTC->CRL & RTC_CRL_RSF)) {
+        if (Sched_LseTimedOut(start)) {
+            return FALSE;
+        }
+    }
+
+    while (!(RTC->CRL & RTC_CRL_RTOFF)) {
+        if (Sched_LseTimedOut(start)) {
+            return FALSE;
+        }
+    }
+    RTC->CRL |= RTC_CRL_CNF;
+    RTC->PRLH = 0;
+    RTC->PRLL = (uint16_t)(32768U / SCHED_RTC_HZ - 1U);
+    RTC->CRL &= (uint16_t)~RTC_CRL_CNF;
+    while (!(RTC->CRL & RTC_CRL_RTOFF)) {
+        if (Sched_LseTimedOut(start)) {
+            return FALSE;
+        }
+    }
+
+    RTC->CRH |= RTC_CRH_ALRIE;
+    EXTI->IMR |= EXTI_IMR_MR17;
+    EXTI->RTSR |= EXTI_RTSR_TR17;
+    NVIC_EnableIRQ(RTCAlarm_IRQn);
+    Sched_RtcRemainder = 0;
+    return TRUE;
+}
+
+static uint32_t Sched_RtcGetCounter(void) {
+    uint16_t high;
+    uint16_t low;
+    do {
+        high = RTC->CNTH;
+        low = RTC->CNTL;
+    } while (high != RTC->CNTH);    // CNTL carried into CNTH between the reads
+    return ((uint32_t)high << 16) | low;
+}
+
+/**
+ * @brief STOP mode for Skip ticks, woken by the RTC alarm or any EXTI line.
+ * @return FALSE if the RTC stopped responding before the alarm was set; nothing was slept.
+ * @details The clock tree falls back to HSI on wakeup; Mcu_InitClock restores the
+ *          active clock setting (HSE/PLL, wait states, prescalers). The RTC waits are
+ *          bounded like in Sched_RtcInit; on a timeout STOP mode is not used again.
+ */
+static boolean Sched_SleepStop(uint32_t Skip) {
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uint32_t wait = DWT_CYCCNT;
+    uint32_t start = Sched_RtcGetCounter();
+    uint32_t alarm = (Skip * SCHED_RTC_HZ) / SCHED_TICK_HZ;     // Rounds down: wakes early, never late
+
+    while (!(RTC->CRL & RTC_CRL_RTOFF)) {
+        if (Sched_LseTimedOut(wait)) {
+            Sched_RtcReady = 0;
+            SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+            return FALSE;
+        }
+    }
+    RTC->CRL |= RTC_CRL_CNF;
+    RTC->ALRH = (uint16_t)((start + alarm) >> 16);
+    RTC->ALRL = (uint16_t)(start + alarm);
+    RTC->CRL &= (uint16_t)~RTC_CRL_CNF;
+    while (!(RTC->CRL & RTC_CRL_RTOFF)) {
+        if (Sched_LseTimedOut(wait)) {
+            Sched_RtcReady = 0;     // The alarm may not be written: do not sleep on it
+            SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+            return FALSE;
+        }
+    }
+
+    PWR->CR &= ~PWR_CR_PDDS;                // STOP, not STANDBY
+    PWR->CR |= PWR_CR_LPDS | PWR_CR_CWUF;   // Regulator in low-power mode
+    SCB->SCR |= SCB_SCR_SLEEPDEEP;
+    __WFI();
+    SCB->SCR &= ~SCB_SCR_SLEEPDEEP;
+    (void)Mcu_InitClock(Mcu_GetClockSetting());
+
+    // The RTC APB interface was stopped: resynchronise before reading CNT
+    wait = DWT_CYCCNT;
+    RTC->CRL &= (uint16_t)~RTC_CRL_RSF;
+    uint32_t ms = Skip;     // RTC lost: count the whole period, tasks run early rather than late
+    while (!(RTC->CRL & RTC_CRL_RSF)) {
+        if (Sched_LseTimedOut(wait)) {
+            Sched_RtcReady = 0;
+            break;
+        }
+    }
+    if (Sched_RtcReady) {
+        uint32_t now = Sched_RtcGetCounter();
+
+        // RTC ticks -> ms, carrying the fraction so repeated STOP periods do not drift
+        uint32_t scaled = (now - start) * SCHED_TICK_HZ + Sched_RtcRemainder;
+        ms = scaled / SCHED_RTC_HZ;
+        Sched_RtcRemainder = scaled % SCHED_RTC_HZ;
+        if (ms > Skip) ms = Skip;
+    }
+    Sched_Advance(ms);
+
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    return TRUE;
+}
+
+/* Nothing ready, interrupts masked: sleep as configured until the next release */
+static void Sched_Idle(void) {
+    uint32_t next = Sched_NextRelease();
+    Sched_IdleModeType mode = Sched_ConfigPtr->IdleMode;
+    if (mode == SCHED_IDLE_WFI || next <= 1U) {
+        __WFI();
+        return;
+    }
+    if (mode == SCHED_IDLE_STOP && Sched_RtcReady && Sched_StopInhibit == 0U && next - 1U >= SCHED_STOP_MIN_MS &&
+        Sched_SleepStop(next - 1U)) {
+        return;
+    }
+    Sched_SleepTickless(next - 1U);
+}
+
+void Sched_Run(void) {
+    if (Sched_ConfigPtr == NULL_PTR) {
+        return;
+    }
+    const Sched_TaskConfigType* tasks = Sched_ConfigPtr->Tasks;
+
+    for (;;) {
+        // Pick the first ready task; checking and sleeping with PRIMASK set
+        // means a release between the two still ends the WFI
+        __disable_irq();
+        uint32_t ready = Sched_Ready;
+        if (ready == 0U) {
+            Sched_Idle();
+            __enable_irq();
+            Sched_UpdateLoad();
+            continue;
+        }
+        uint8_t i = (uint8_t)__builtin_ctz(ready);
+        Sched_Ready = ready & ~(1UL << i);
+        __enable_irq();
+
+        uint32_t start = DWT_CYCCNT;
+        tasks[i].Task();
+        uint32_t cycles = DWT_CYCCNT - start;
+
+        Sched_TaskStatsType* st = &Sched_Stats[i];
+        st->Activations++;
+        st->LastCycles = cycles;
+        if (cycles > st->MaxCycles) st->MaxCycles = cycles;
+        if (tasks[i].WcetCycles != 0U && cycles > tasks[i].WcetCycles) st->BudgetExceeded++;
+        Sched_BusyCycles += cycles;
+        TRACE_EMIT(TRACE_EV_TASK, i, cycles);
+    }
+}
+
+uint32_t Sched_GetTick(void) {
+    return Sched_TickCount;
+}
+
+uint32_t Sched_GetSleptMs(void) {
+    return Sched_SleptMs;
+}
+
+void Sched_InhibitStop(void) {
+    uint32_t primask = Compiler_EnterCritical();
+    Sched_StopInhibit++;
+    Compiler_ExitCritical(primask);
+}
+
+void Sched_AllowStop(void) {
+    uint32_t primask = Compiler_EnterCritical();
+    if (Sched_StopInhibit) Sched_StopInhibit--;
+    Compiler_ExitCritical(primask);
+}
+
+void Sched_RtcAlarmIrqHandler(void) {
+    RTC->CRL &= (uint16_t)~RTC_CRL_ALRF;
+    EXTI->PR = EXTI_PR_PR17;
+}
+
+Std_ReturnType Sched_GetTaskStats(Sched_TaskType Task, Sched_TaskStatsType* Stats) {
+    if (Sched_ConfigPtr == NULL_PTR || Task >= Sched_ConfigPtr->NumTasks || Stats == NULL_PTR) {
+        return E_NOT_OK;
+    }
+    uint32_t primask = Compiler_EnterCritical();    // Overruns is written by the tick
+    *Stats = Sched_Stats[Task];
+    Compiler_ExitCritical(primask);
+    return E_OK;
+}
+
+uint16_t Sched_GetCpuLoad(void) {
+    return Sched_Load;
+}
+
+void Sched_GetVersionInfo(Std_VersionInfoType* versioninfo) {
+    if (versioninfo == NULL_PTR) {
+        return; // Invalid pointer
+    }
+
+    versioninfo->vendorID = SCHED_VENDOR_ID;
+    versioninfo->moduleID = SCHED_MODULE_ID;
+    versioninfo->sw_major_version = SCHED_SW_MAJOR_VERSION;
+    versioninfo->sw_minor_version = SCHED_SW_MINOR_VERSION;
+    versioninfo->sw_patch_version = SCHED_SW_PATCH_VERSION;
+}
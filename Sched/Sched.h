@@ -0,0 +1,162 @@
+/**
+ * @file    Sched.h
+ * @brief   Cooperative time-triggered scheduler driven by SysTick
+ * @version 1.0
+ * @date    2025
+ *
+ * Runs periodic *_MainFunction style tasks from a configuration table.
+ * SysTick (1 ms) only releases tasks: a countdown per task, a bit in the
+ * ready mask. Sched_Run dispatches the ready tasks in table order (first
+ * entry = highest priority) to completion, in thread mode, so tasks need no
+ * locking against each other.
+ *
+ * Offsets spread tasks of the same period over different ticks; with
+ * SCHED_OFFSET_AUTO Sched_Init places the task on the offset whose ticks
+ * carry the least WCET of the tasks placed before it.
+ *
+ * Each task is timed with the DWT cycle counter: last/max execution time,
+ * WCET budget violations, and overruns (released again while still
+ * pending, i.e. an activation was lost).
+ *
+ * Idle: with nothing ready the scheduler sleeps until the next release.
+ * SCHED_IDLE_TICKLESS stretches one SysTick period over all the ticks with
+ * no release and sleeps in WFI; any interrupt still wakes the core and the
+ * ticks actually slept are added to the time base. SCHED_IDLE_STOP enters
+ * STOP mode (clocks off, RTC alarm from LSE as wakeup) for gaps of at least
+ * SCHED_STOP_MIN_MS while no Sched_InhibitStop is active; only EXTI lines
+ * (RTC alarm, pins set up as EXTI, e.g. CAN RX) wake it. Running timers,
+ * ADC, DMA or UART transfers stop in STOP, so the application brackets
+ * such activity with Sched_InhibitStop / Sched_AllowStop.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "Std_Types.h"
+#include "stm32f10x.h"
+
+#define SCHED_VENDOR_ID         1234
+#define SCHED_MODULE_ID         253
+#define SCHED_SW_MAJOR_VERSION  1
+#define SCHED_SW_MINOR_VERSION  0
+#define SCHED_SW_PATCH_VERSION  0
+
+#define SCHED_MAX_TASKS         16U     /* Ready mask is one word */
+#define SCHED_TICK_HZ           1000U   /* SysTick rate: 1 ms */
+#define SCHED_OFFSET_AUTO       0xFFFFU /* Sched_Init chooses the offset */
+#define SCHED_MAX_HYPERPERIOD   1000U   /* Auto offsets look at most this many ticks ahead */
+#define SCHED_LOAD_WINDOW_MS    100U    /* CPU load averaging window */
+#define SCHED_STOP_MIN_MS       10U     /* Shorter gaps use tickless WFI (STOP exit + PLL relock cost) */
+#define SCHED_RTC_HZ            1024U   /* RTC counter rate in STOP mode: LSE / 32 */
+#define SCHED_LSE_TIMEOUT_MS    3000U   /* LSE start-up limit (crystal: typically 1..2 s) */
+
+/** What the scheduler does when no task is ready */
+typedef enum {
+    SCHED_IDLE_WFI = 0x00,          /**< Sleep until the next interrupt; SysTick keeps ticking every ms */
+    SCHED_IDLE_TICKLESS = 0x01,     /**< WFI with SysTick reprogrammed to the next release */
+    SCHED_IDLE_STOP = 0x02          /**< STOP mode with RTC alarm wakeup for long gaps, tickless otherwise */
+} Sched_IdleModeType;
+
+/** Index of a task in Sched_ConfigType.Tasks */
+typedef uint8_t Sched_TaskType;
+
+/**
+ * @brief One periodic task
+ */
+typedef struct {
+    void (*Task)(void);         /**< Main function */
+    uint16_t PeriodMs;          /**< 1, 5, 10, 100 ... */
+    uint16_t OffsetMs;          /**< First release after Sched_Start (< PeriodMs) or SCHED_OFFSET_AUTO */
+    uint32_t WcetCycles;        /**< Budget in core cycles (0: not monitored); weight for auto offsets */
+} Sched_TaskConfigType;
+
+/**
+ * @brief Scheduler configuration
+ */
+typedef struct {
+    const Sched_TaskConfigType* Tasks;
+    uint8_t NumTasks;
+    Sched_IdleModeType IdleMode;    /**< Idle strategy */
+} Sched_ConfigType;
+
+/**
+ * @brief Monitoring data of one task
+ */
+typedef struct {
+    uint32_t Activations;       /**< Completed runs */
+    uint32_t Overruns;          /**< Releases lost because the previous one had not run yet */
+    uint32_t BudgetExceeded;    /**< Runs longer than WcetCycles */
+    uint32_t LastCycles;        /**< Execution time of the last run */
+    uint32_t MaxCycles;         /**< Longest run seen */
+    uint16_t OffsetMs;          /**< Offset in use (after auto placement) */
+} Sched_TaskStatsType;
+
+/**
+ * @brief Checks the table, places auto offsets and starts SysTick at 1 ms.
+ * @param ConfigPtr Task table.
+ * @return E_OK, or E_NOT_OK if the table is invalid (too many tasks, period 0, offset >= period).
+ * @details Time (Sched_GetTick) runs from here on; tasks are released only after Sched_Start.
+ *          SCHED_IDLE_STOP starts the LSE and the RTC (backup domain) here. If the LSE or
+ *          the RTC does not come up within SCHED_LSE_TIMEOUT_MS (crystal missing or broken),
+ *          STOP mode is never entered and idle falls back to tickless WFI; an RTC wait that
+ *          times out later in idle has the same effect.
+ */
+Std_ReturnType Sched_Init(const Sched_ConfigType* ConfigPtr);
+
+/**
+ * @brief Releases the tasks, counting offsets from the next tick.
+ */
+void Sched_Start(void);
+
+/**
+ * @brief Dispatches ready tasks forever; never returns.
+ */
+void Sched_Run(void);
+
+/**
+ * @brief Advances time and releases due tasks; called by SysTick_Handler.
+ */
+void Sched_Tick(void);
+
+/**
+ * @brief Returns milliseconds since Sched_Init (wraps after 49 days).
+ */
+uint32_t Sched_GetTick(void);
+
+/**
+ * @brief Returns the milliseconds spent in tickless or STOP sleep since Sched_Init.
+ */
+uint32_t Sched_GetSleptMs(void);
+
+/**
+ * @brief Forbids STOP mode (nested calls are counted); tickless WFI is still used.
+ */
+void Sched_InhibitStop(void);
+
+/**
+ * @brief Releases one Sched_InhibitStop.
+ */
+void Sched_AllowStop(void);
+
+/**
+ * @brief Clears the RTC alarm; called by RTCAlarm_IRQHandler.
+ */
+void Sched_RtcAlarmIrqHandler(void);
+
+/**
+ * @brief Copies the monitoring data of a task.
+ * @return E_OK, or E_NOT_OK for an invalid task or NULL pointer.
+ */
+Std_ReturnType Sched_GetTaskStats(Sched_TaskType Task, Sched_TaskStatsType* Stats);
+
+/**
+ * @brief Returns the share of time spent in tasks over the last window, in permille.
+ */
+uint16_t Sched_GetCpuLoad(void);
+
+/**
+ * @brief Service returns the version information of this module.
+ */
+void Sched_GetVersionInfo(Std_VersionInfoType* versioninfo);
+
+#endif /* SCHED_H */
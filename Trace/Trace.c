@@ -0,0 +1,66 @@
+/*
+ * Trace.c
+ * Binary event trace implementation
+ */
+
+#include "Trace.h"
+#include "Uart.h"
+#include "Gpt.h"
+
+#define TRACE_MASK      ((uint16_t)(TRACE_NUM_RECORDS - 1U))
+
+#if (TRACE_NUM_RECORDS & (TRACE_NUM_RECORDS - 1U)) != 0
+#error "TRACE_NUM_RECORDS must be a power of two"
+#endif
+
+static Trace_RecordType Trace_Buffer[TRACE_NUM_RECORDS];
+static volatile uint16_t Trace_Head = 0;    /* Written by Trace_Emit only */
+static volatile uint16_t Trace_Tail = 0;    /* Written by Trace_MainFunction only */
+static uint16_t Trace_Seq = 0;
+
+void Trace_Init(void) {
+    Dwt_StartCycleCounter();    // ISR execution times
+
+    Trace_Head = 0;
+    Trace_Tail = 0;
+    Trace_Seq = 0;
+    Trace_Emit(TRACE_EV_START, SystemCoreClock, TRACE_FORMAT_VERSION);
+}
+
+void Trace_Emit(uint8_t Event, uint32_t Data0, uint32_t Data1) {
+    uint32_t primask = Compiler_EnterCritical();
+    uint16_t seq = Trace_Seq++;
+    uint16_t head = Trace_Head;
+    if ((uint16_t)(head - Trace_Tail) < TRACE_NUM_RECORDS) {
+        Trace_RecordType* rec = &Trace_Buffer[head & TRACE_MASK];
+        // The timestamp is taken inside the section so Seq and Time agree
+        rec->Sync = TRACE_SYNC;
+        rec->Event = Event;
+        rec->Seq = seq;
+        rec->Time = (uint32_t)Gpt_GetTimestamp();
+        rec->Data0 = Data0;
+        rec->Data1 = Data1;
+        Trace_Head = (uint16_t)(head + 1U);
+    }
+    Compiler_ExitCritical(primask);
+}
+
+void Trace_MainFunction(void) {
+    uint16_t tail = Trace_Tail;
+    uint16_t avail = (uint16_t)(Trace_Head - tail);
+    while (avail) {
+        // Contiguous records up to the end of the ring, as many as the UART takes
+        uint16_t idx = tail & TRACE_MASK;
+        uint16_t n = (uint16_t)(TRACE_NUM_RECORDS - idx);
+        uint16_t room = (uint16_t)(Uart_GetFree() / sizeof(Trace_RecordType));
+        if (n > avail) n = avail;
+        if (n > room) n = room;
+        if (n == 0U) {
+            break; // UART ring full: records stay here and go out next call
+        }
+        Uart_Write((const uint8_t*)&Trace_Buffer[idx], (uint16_t)(n * sizeof(Trace_RecordType)));
+        tail = (uint16_t)(tail + n);
+        avail = (uint16_t)(avail - n);
+        Trace_Tail = tail;
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * @file    Trace.h
+ * @brief   Binary event trace: fixed-size records streamed over the UART
+ * @version 1.0
+ * @date    2025
+ *
+ * Drivers emit 16-byte records (sequence number, Gpt microsecond timestamp,
+ * event ID, two payload words) into a RAM ring with TRACE_EMIT; emitting
+ * is a handful of word stores under a short PRIMASK section. The ring is
+ * handed to Uart_Write from Trace_MainFunction and decoded on the host by
+ * Trace/host/trace_decode (CSV or Chrome trace JSON).
+ *
+ * Wire format (little endian), one Trace_RecordType per record:
+ *   byte 0     TRACE_SYNC (0xA5), used by the decoder to find record boundaries
+ *   byte 1     event ID (TRACE_EV_*)
+ *   byte 2..3  sequence number, +1 per emitted record; a gap means records were lost
+ *   byte 4..7  low 32 bits of Gpt_GetTimestamp at emission (microseconds, wraps)
+ *   byte 8..15 Data0, Data1 (meaning depends on the event)
+ * The timestamp comes from the Gpt timebase, not from DWT CYCCNT: CYCCNT stops
+ * while the core sleeps in WFI (CAN demo idle loop, Sched tickless idle), which
+ * would compress every idle gap to nothing. Records emitted before Gpt_Init
+ * carry 0. Execution times (task and ISR records) are still CYCCNT cycles;
+ * Trace_Init emits TRACE_EV_START with the core clock so the host can convert
+ * them to microseconds.
+ *
+ * ISR hot paths are timed with TRACE_ISR_ENTER / TRACE_ISR_EXIT: one
+ * TRACE_EV_ISR record per interrupt with its execution cycles, e.g. to compare
+ * a flash build against RAMFUNC=1 (make report CYCLES=trace.csv).
+ *
+ * Build with TRACE_ENABLE=1 (make trace) to compile the hooks in; otherwise
+ * TRACE_EMIT and the ISR hooks expand to nothing.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "stm32f10x.h"
+#include "Dwt.h"
+
+#ifndef TRACE_ENABLE
+#define TRACE_ENABLE            0
+#endif
+
+/** Records held on target until Trace_MainFunction sends them; power of two */
+#ifndef TRACE_NUM_RECORDS
+#define TRACE_NUM_RECORDS       64U
+#endif
+
+#define TRACE_SYNC              0xA5U
+#define TRACE_FORMAT_VERSION    2U     /* 1: Time in CYCCNT cycles, 2: in Gpt microseconds */
+
+/** Event IDs; 0x80..0xFF are free for the application */
+#define TRACE_EV_START          0x01U   /**< Data0 = core clock [Hz], Data1 = TRACE_FORMAT_VERSION */
+#define TRACE_EV_CAN_RX         0x10U   /**< Data0 = CAN ID, Data1 = DLC | data[0..2] << 8 */
+#define TRACE_EV_CAN_TX         0x11U   /**< Data0 = CAN ID, Data1 = DLC | mailbox << 8 (4: none free) */
+#define TRACE_EV_ADC_DONE       0x20U   /**< Data0 = group / ADC instance, Data1 = first result */
+#define TRACE_EV_PWM_EDGE       0x30U   /**< Data0 = timer index (0 = TIM1), Data1 = handled SR flags */
+#define TRACE_EV_TASK           0x40U   /**< Scheduler task ended: Data0 = task index, Data1 = execution cycles */
+#define TRACE_EV_ISR            0x50U   /**< ISR ended: Data0 = TRACE_ISR_*, Data1 = execution cycles */
+#define TRACE_EV_USER           0x80U
+
+/** ISR IDs of TRACE_EV_ISR */
+#define TRACE_ISR_CAN_RX0       0U      /**< USB_LP_CAN1_RX0_IRQHandler */
+#define TRACE_ISR_ADC           1U      /**< ADC1_2_IRQHandler */
+#define TRACE_ISR_DMA(Ch)       (1U + (Ch))     /**< Dma_IrqHandler, DMA1 channel 1..7 -> 2..8 */
+#define TRACE_ISR_TIM(Idx)      (9U + (Idx))    /**< Pwm_IrqDispatch, timer index 0..3 (TIM1..TIM4) -> 9..12 */
+#define TRACE_ISR_GPT           13U     /**< Gpt_IrqHandler */
+#define TRACE_ISR_CAN_TX        14U     /**< USB_HP_CAN1_TX_IRQHandler */
+
+/** One record as stored and sent */
+typedef struct {
+    uint8_t Sync;           /**< TRACE_SYNC */
+    uint8_t Event;          /**< TRACE_EV_* */
+    uint16_t Seq;           /**< Sequence number */
+    uint32_t Time;          /**< Gpt timebase [us], low 32 bits */
+    uint32_t Data0;
+    uint32_t Data1;
+} Trace_RecordType;
+
+/**
+ * @brief Starts the cycle counter, empties the ring and emits TRACE_EV_START.
+ * @details Uart_Init must have run; the records are sent through Uart_Write.
+ *          Call it after Gpt_Init so the first records are timestamped.
+ */
+void Trace_Init(void);
+
+/**
+ * @brief Appends a record; callable from any context.
+ * @details When the ring is full the record is dropped, its sequence number
+ *          is still consumed so the host sees the gap.
+ */
+void Trace_Emit(uint8_t Event, uint32_t Data0, uint32_t Data1);
+
+/**
+ * @brief Moves as many whole records as the UART ring can take.
+ * @details Call periodically (tick or idle loop) from a single context.
+ */
+void Trace_MainFunction(void);
+
+#if TRACE_ENABLE
+#define TRACE_EMIT(Event, Data0, Data1)  Trace_Emit((uint8_t)(Event), (uint32_t)(Data0), (uint32_t)(Data1))
+/* First statement of the ISR body: declares the start timestamp */
+#define TRACE_ISR_ENTER()                uint32_t traceIsrStart = DWT_CYCCNT
+/* Last statement: the record itself is not part of the measured time */
+#define TRACE_ISR_EXIT(Isr)              Trace_Emit(TRACE_EV_ISR, (uint32_t)(Isr), DWT_CYCCNT - traceIsrStart)
+#else
+#define TRACE_EMIT(Event, Data0, Data1)  ((void)0)
+#define TRACE_ISR_ENTER()                ((void)0)
+#define TRACE_ISR_EXIT(Isr)              ((void)0)
+#endif
+
+#endif /* TRACE_H */
@@ -0,0 +1,303 @@
+/*
+ * trace_decode.c
+ * Host decoder for the binary trace stream of Trace.c (Linux, C99)
+ *
+ * Build:  make trace_decode   (or: gcc -O2 -o trace_decode trace_decode.c)
+ * Use:    stty -F /dev/ttyUSB0 115200 raw -echo
+ *         ./trace_decode -f json /dev/ttyUSB0 > trace.json   (open in chrome://tracing or Perfetto)
+ *         ./trace_decode -f csv capture.bin > trace.csv
+ *
+ * Input is the raw byte stream; reading stops at end of file or on Ctrl-C
+ * (the JSON is still closed properly). Record layout and event IDs must
+ * match Trace.h.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_SYNC          0xA5U
+#define TRACE_RECORD_SIZE   16U
+#define TRACE_DEFAULT_HZ    72000000UL  /* Until a TRACE_EV_START record is seen */
+
+#define TRACE_EV_START      0x01U
+#define TRACE_EV_CAN_RX     0x10U
+#define TRACE_EV_CAN_TX     0x11U
+#define TRACE_EV_ADC_DONE   0x20U
+#define TRACE_EV_PWM_EDGE   0x30U
+#define TRACE_EV_TASK       0x40U
+#define TRACE_EV_ISR        0x50U
+#define TRACE_EV_USER       0x80U
+
+typedef enum { FMT_CSV, FMT_JSON } OutFormat;
+
+typedef struct {
+    uint8_t event;
+    uint16_t seq;
+    uint32_t time;
+    uint32_t data0;
+    uint32_t data1;
+} Record;
+
+typedef struct {
+    OutFormat fmt;
+    int haveSeq;
+    uint16_t lastSeq;
+    int haveTime;
+    uint32_t lastTime;
+    double us;              /* Unwrapped record time [us] */
+    double ticksPerUs;      /* Record time: Gpt microseconds (format 2) or CYCCNT (format 1) */
+    double cyclesPerUs;     /* Task / ISR execution times */
+    unsigned long records;
+    unsigned long lost;
+    unsigned long skipped;  /* Bytes dropped while searching for a record start */
+} Decoder;
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void onSignal(int sig) {
+    (void)sig;
+    stopRequested = 1;
+}
+
+static uint32_t rd32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static const char* eventName(uint8_t ev) {
+    switch (ev) {
+        case TRACE_EV_START:    return "START";
+        case TRACE_EV_CAN_RX:   return "CAN_RX";
+        case TRACE_EV_CAN_TX:   return "CAN_TX";
+        case TRACE_EV_ADC_DONE: return "ADC_DONE";
+        case TRACE_EV_PWM_EDGE: return "PWM_EDGE";
+        case TRACE_EV_TASK:     return "TASK";
+        case TRACE_EV_ISR:      return "ISR";
+        default:                return (ev >= TRACE_EV_USER) ? "USER" : "UNKNOWN";
+    }
+}
+
+/* Chrome trace lane: one per source so CAN, ADC and each timer line up */
+static int eventLane(const Record* r) {
+    switch (r->event) {
+        case TRACE_EV_CAN_RX:
+        case TRACE_EV_CAN_TX:   return 1;
+        case TRACE_EV_ADC_DONE: return 2;
+        case TRACE_EV_PWM_EDGE: return 10 + (int)(r->data0 & 0x0F);    /* TIM1..TIM4 */
+        case TRACE_EV_TASK:     return 20 + (int)(r->data0 & 0x0F);    /* One lane per task */
+        case TRACE_EV_ISR:      return 30 + (int)(r->data0 & 0x0F);    /* One lane per ISR ID */
+        default:                return 0;
+    }
+}
+
+static void emitJsonHeader(void) {
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    static const struct { int tid; const char* name; } lanes[] = {
+        { 0, "system" }, { 1, "CAN" }, { 2, "ADC" },
+        { 10, "TIM1" }, { 11, "TIM2" }, { 12, "TIM3" }, { 13, "TIM4" },
+        { 20, "task 0" }, { 21, "task 1" }, { 22, "task 2" }, { 23, "task 3" },
+        { 30, "ISR CAN RX0" }, { 31, "ISR ADC" },
+        { 32, "ISR DMA ch1" }, { 33, "ISR DMA ch2" }, { 34, "ISR DMA ch3" }, { 35, "ISR DMA ch4" },
+        { 36, "ISR DMA ch5" }, { 37, "ISR DMA ch6" }, { 38, "ISR DMA ch7" },
+        { 39, "ISR TIM1" }, { 40, "ISR TIM2" }, { 41, "ISR TIM3" }, { 42, "ISR TIM4" },
+        { 43, "ISR GPT" }, { 44, "ISR CAN TX" }
+    };
+    for (size_t i = 0; i < sizeof(lanes) / sizeof(lanes[0]); i++) {
+        printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+               i ? ",\n" : "", lanes[i].tid, lanes[i].name);
+    }
+}
+
+static void emitJsonArgs(const Record* r) {
+    switch (r->event) {
+        case TRACE_EV_START:
+            printf("{\"clock_hz\":%u,\"version\":%u}", r->data0, r->data1);
+            break;
+        case TRACE_EV_CAN_RX:
+            printf("{\"id\":\"0x%03X\",\"dlc\":%u,\"data\":\"%02X %02X %02X\"}", r->data0,
+                   r->data1 & 0xFFU, (r->data1 >> 8) & 0xFFU, (r->data1 >> 16) & 0xFFU, r->data1 >> 24);
+            break;
+        case TRACE_EV_CAN_TX:
+            printf("{\"id\":\"0x%03X\",\"dlc\":%u,\"mailbox\":%u}", r->data0, r->data1 & 0xFFU, (r->data1 >> 8) & 0xFFU);
+            break;
+        case TRACE_EV_ADC_DONE:
+            printf("{\"group\":%u,\"value\":%u}", r->data0, r->data1);
+            break;
+        case TRACE_EV_PWM_EDGE:
+            printf("{\"timer\":%u,\"sr\":\"0x%04X\"}", r->data0, r->data1);
+            break;
+        case TRACE_EV_TASK:
+            printf("{\"task\":%u,\"cycles\":%u}", r->data0, r->data1);
+            break;
+        case TRACE_EV_ISR:
+            printf("{\"isr\":%u,\"cycles\":%u}", r->data0, r->data1);
+            break;
+        default:
+            printf("{\"event\":%u,\"data0\":\"0x%08X\",\"data1\":\"0x%08X\"}", r->event, r->data0, r->data1);
+            break;
+    }
+}
+
+static void emitLost(Decoder* d, double us, unsigned long n) {
+    if (d->fmt == FMT_CSV) {
+        printf("-,%.3f,LOST,%lu,0\n", us, n);
+    } else {
+        printf(",\n{\"name\":\"LOST\",\"cat\":\"trace\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":0,"
+               "\"args\":{\"records\":%lu}}", us, n);
+    }
+}
+
+static void handleRecord(Decoder* d, const Record* r) {
+    if (r->event == TRACE_EV_START) {
+        // Target (re)started: new clock, no sequence continuity
+        if (r->data0 != 0U) d->cyclesPerUs = r->data0 / 1e6;
+        d->ticksPerUs = (r->data1 >= 2U) ? 1.0 : d->cyclesPerUs;
+        d->haveSeq = 0;
+        d->haveTime = 0;
+    }
+    if (d->haveTime) {
+        d->us += (uint32_t)(r->time - d->lastTime) / d->ticksPerUs;    // Modulo 2^32: unwraps the time
+    }
+    d->haveTime = 1;
+    d->lastTime = r->time;
+    double us = d->us;
+
+    if (d->haveSeq && r->seq != (uint16_t)(d->lastSeq + 1U)) {
+        unsigned long gap = (uint16_t)(r->seq - d->lastSeq - 1U);
+        d->lost += gap;
+        emitLost(d, us, gap);
+    }
+    d->haveSeq = 1;
+    d->lastSeq = r->seq;
+    d->records++;
+
+    if (d->fmt == FMT_CSV) {
+        printf("%u,%.3f,%s,0x%08X,0x%08X\n", r->seq, us, eventName(r->event), r->data0, r->data1);
+    } else if (r->event == TRACE_EV_TASK || r->event == TRACE_EV_ISR) {
+        // Emitted at the end of the task / ISR: draw it as a slice of its execution time
+        double dur = r->data1 / d->cyclesPerUs;
+        printf(",\n{\"name\":\"%s %u\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d,\"args\":",
+               r->event == TRACE_EV_TASK ? "task" : "isr", r->data0, eventName(r->event), us - dur, dur, eventLane(r));
+        emitJsonArgs(r);
+        printf("}");
+    } else {
+        printf(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%d,\"args\":",
+               eventName(r->event), eventName(r->event), us, eventLane(r));
+        emitJsonArgs(r);
+        printf("}");
+    }
+}
+
+/*
+ * Consumes whole records from buf[0..len) and returns the bytes used. A start
+ * is accepted when it carries TRACE_SYNC and the byte after the record does
+ * too (or the stream ends there), so a 0xA5 inside a payload does not shift
+ * the framing for long.
+ */
+static size_t decode(Decoder* d, const uint8_t* buf, size_t len, int atEof) {
+    size_t pos = 0;
+    while (len - pos >= TRACE_RECORD_SIZE) {
+        if (buf[pos] != TRACE_SYNC) {
+            pos++;
+            d->skipped++;
+            continue;
+        }
+        if (len - pos < 2U * TRACE_RECORD_SIZE && !atEof) {
+            break;  // Wait for the next record to confirm the framing
+        }
+        if (len - pos > TRACE_RECORD_SIZE && buf[pos + TRACE_RECORD_SIZE] != TRACE_SYNC) {
+            pos++;
+            d->skipped++;
+            continue;
+        }
+        Record r;
+        r.event = buf[pos + 1];
+        r.seq = (uint16_t)(buf[pos + 2] | (buf[pos + 3] << 8));
+        r.time = rd32(&buf[pos + 4]);
+        r.data0 = rd32(&buf[pos + 8]);
+        r.data1 = rd32(&buf[pos + 12]);
+        handleRecord(d, &r);
+        pos += TRACE_RECORD_SIZE;
+    }
+    return pos;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr, "usage: %s [-f csv|json] [input]   (input defaults to stdin)\n", prog);
+}
+
+int main(int argc, char** argv) {
+    Decoder d;
+    memset(&d, 0, sizeof(d));
+    d.fmt = FMT_CSV;
+    d.cyclesPerUs = TRACE_DEFAULT_HZ / 1e6;
+    d.ticksPerUs = 1.0;
+
+    const char* path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            const char* f = argv[++i];
+            if (strcmp(f, "csv") == 0) {
+                d.fmt = FMT_CSV;
+            } else if (strcmp(f, "json") == 0) {
+                d.fmt = FMT_JSON;
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    FILE* in = stdin;
+    if (path != NULL && strcmp(path, "-") != 0) {
+        in = fopen(path, "rb");
+        if (in == NULL) {
+            perror(path);
+            return 1;
+        }
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = onSignal;   // No SA_RESTART: a blocking read on a tty returns
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    if (d.fmt == FMT_CSV) {
+        printf("seq,time_us,event,data0,data1\n");
+    } else {
+        emitJsonHeader();
+    }
+
+    uint8_t buf[4096];
+    size_t len = 0;
+    while (!stopRequested) {
+        size_t n = fread(buf + len, 1, sizeof(buf) - len, in);
+        if (n == 0) {
+            break;
+        }
+        len += n;
+        size_t used = decode(&d, buf, len, 0);
+        memmove(buf, buf + used, len - used);
+        len -= used;
+        fflush(stdout);
+    }
+    decode(&d, buf, len, 1);
+
+    if (d.fmt == FMT_JSON) {
+        printf("\n]}\n");
+    }
+    fprintf(stderr, "%lu records, %lu lost, %lu bytes skipped\n", d.records, d.lost, d.skipped);
+    if (in != stdin) {
+        fclose(in);
+    }
+    return 0;
+}
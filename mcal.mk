@@ -0,0 +1,76 @@
+# mcal.mk - Cấu hình build dùng chung cho thư viện MCAL (libmcal.a) và các demo
+#
+# Thư mục gốc repo build MCAL/, SPL/, Trace/, Sched/, Boot/ một lần thành
+# build/<variant>/libmcal.a; mỗi demo đặt ROOT (đường dẫn tới thư mục gốc)
+# rồi include file này, biên dịch main.c + Config/ của mình và link với thư viện.
+# Linker chỉ lấy từ thư viện các object mà demo thực sự gọi tới.
+#
+# Chọn khi gọi make (cả ở thư mục gốc lẫn trong demo):
+#   PROFILE=debug|release|size   (mặc định debug)
+#   TRACE=1                      bật hook trace trong driver (TRACE_ENABLE=1)
+#   RAMFUNC=1                    chạy các hàm RAMFUNC (ISR CAN RX, ADC, DMA, timer) từ RAM
+# Mỗi tổ hợp là một variant riêng: build/debug, build/release-trace, build/release-trace-ram, ...
+# So sánh thời gian ISR: make TRACE=1 và make TRACE=1 RAMFUNC=1, rồi make report CYCLES=trace.csv
+
+PROFILE ?= debug
+TRACE   ?= 0
+RAMFUNC ?= 0
+
+# Toolchain (gcc-ar để thư viện giữ được LTO)
+CC      = arm-none-eabi-gcc
+AR      = arm-none-eabi-gcc-ar
+OBJCOPY = arm-none-eabi-objcopy
+SIZE    = arm-none-eabi-size
+
+ifeq ($(PROFILE),debug)
+OPTFLAGS = -O0 -g3
+else ifeq ($(PROFILE),release)
+OPTFLAGS = -O2 -g -flto
+else ifeq ($(PROFILE),size)
+OPTFLAGS = -Os -g -flto
+else
+$(error PROFILE phải là debug, release hoặc size)
+endif
+
+FEATURE_DEFS :=
+VARIANT      := $(PROFILE)
+ifeq ($(TRACE),1)
+FEATURE_DEFS += -DTRACE_ENABLE=1
+VARIANT      := $(VARIANT)-trace
+endif
+ifeq ($(RAMFUNC),1)
+FEATURE_DEFS += -DRAMFUNC_ENABLE=1
+VARIANT      := $(VARIANT)-ram
+endif
+
+ARCH = -mcpu=cortex-m3 -mthumb
+
+# -ffunction-sections -fdata-sections: --gc-sections bỏ phần không dùng; -MMD -MP: file .d cho build tăng dần
+MCAL_CFLAGS  = $(ARCH) $(OPTFLAGS) -Wall -ffreestanding -ffunction-sections -fdata-sections -MMD -MP
+MCAL_DEFS    = -DSTM32F10X_MD -DUSE_STDPERIPH_DRIVER $(FEATURE_DEFS)
+MCAL_MODULES = Mcu Dio Port Adc Pwm Icu Gpt Dma Uart Can
+MCAL_INC     = -I$(ROOT)/CMSIS -I$(ROOT)/SPL/inc $(addprefix -I$(ROOT)/MCAL/,$(MCAL_MODULES)) \
+               -I$(ROOT)/Trace -I$(ROOT)/Sched -I$(ROOT)/Boot
+
+MCAL_BUILD = $(ROOT)/build/$(VARIANT)
+MCAL_LIB   = $(MCAL_BUILD)/libmcal.a
+MAPREPORT  = $(ROOT)/build/host/mapreport
+COMGEN     = $(ROOT)/build/host/comgen
+
+# Mục tiêu mặc định vẫn là "all" của makefile include file này
+.DEFAULT_GOAL := all
+
+# Trong demo: nhờ make ở thư mục gốc cập nhật thư viện (chỉ biên dịch lại file đã đổi)
+ifneq ($(ROOT),.)
+$(MCAL_LIB): FORCE
+	$(MAKE) -C $(ROOT) lib PROFILE=$(PROFILE) TRACE=$(TRACE) RAMFUNC=$(RAMFUNC)
+
+$(MAPREPORT): FORCE
+	$(MAKE) -C $(ROOT) mapreport
+
+$(COMGEN): FORCE
+	$(MAKE) -C $(ROOT) comgen
+
+FORCE:
+.PHONY: FORCE
+endif